@@ -69,6 +69,18 @@ sum_ckpt_ops(WTPERF *wtperf)
 	return (total);
 }
 
+/*
+ * Return total scan operations.
+ */
+uint64_t
+sum_scan_ops(WTPERF *wtperf)
+{
+	WTPERF_THREAD *thread;
+
+	thread = wtperf->scanthreads;
+	return (thread == NULL ? 0 : thread->scan.ops);
+}
+
 /*
  * Return total operations count for the worker threads.
  */
@@ -41,6 +41,7 @@ static WT_THREAD_RET monitor(void *);
 static WT_THREAD_RET populate_thread(void *);
 static void	 randomize_value(WTPERF_THREAD *, char *);
 static void	 recreate_dir(const char *);
+static WT_THREAD_RET scan_worker(void *);
 static int	 start_all_runs(WTPERF *);
 static int	 start_run(WTPERF *);
 static void	 start_threads(WTPERF *, WORKLOAD *,
@@ -1531,6 +1532,83 @@ err:		wtperf->error = wtperf->stop = true;
 	return (WT_THREAD_RET_VALUE);
 }
 
+static WT_THREAD_RET
+scan_worker(void *arg)
+{
+	CONFIG_OPTS *opts;
+	WTPERF *wtperf;
+	WTPERF_THREAD *thread;
+	WT_CONNECTION *conn;
+	WT_CURSOR *cursor;
+	WT_SESSION *session;
+	size_t j;
+	uint64_t items;
+	uint32_t i;
+	int ret;
+
+	thread = (WTPERF_THREAD *)arg;
+	wtperf = thread->wtperf;
+	opts = wtperf->opts;
+	conn = wtperf->conn;
+	session = NULL;
+
+	if ((ret = conn->open_session(
+	    conn, NULL, opts->sess_config, &session)) != 0) {
+		lprintf(wtperf, ret, 0,
+		    "open_session failed in scan thread.");
+		goto err;
+	}
+
+	while (!wtperf->stop) {
+		/* Break the sleep up, so we notice interrupts faster. */
+		for (i = 0; i < opts->scan_interval; i++) {
+			sleep(1);
+			if (wtperf->stop)
+				break;
+		}
+		if (wtperf->stop)
+			break;
+
+		/* Read every item of every table, once. */
+		for (j = 0, items = 0; j < opts->table_count; j++) {
+			if ((ret = session->open_cursor(session,
+			    wtperf->uris[j], NULL, NULL, &cursor)) != 0) {
+				lprintf(wtperf, ret, 0,
+				    "scan: WT_SESSION.open_cursor: %s",
+				    wtperf->uris[j]);
+				goto err;
+			}
+			while (!wtperf->stop &&
+			    (ret = cursor->next(cursor)) == 0)
+				++items;
+			if (ret != 0 && ret != WT_NOTFOUND) {
+				lprintf(wtperf, ret, 0,
+				    "scan: WT_CURSOR.next: %s",
+				    wtperf->uris[j]);
+				goto err;
+			}
+			if ((ret = cursor->close(cursor)) != 0)
+				goto err;
+		}
+		++thread->scan.ops;
+		lprintf(wtperf, 0, 1, "Scan read %" PRIu64 " items", items);
+	}
+
+	if (session != NULL &&
+	    ((ret = session->close(session, NULL)) != 0)) {
+		lprintf(wtperf, ret, 0,
+		    "Error closing session in scan worker.");
+		goto err;
+	}
+
+	/* Notify our caller we failed and shut the system down. */
+	if (0) {
+err:		wtperf->error = wtperf->stop = true;
+	}
+
+	return (WT_THREAD_RET_VALUE);
+}
+
 //     //execute_workloadִworkload, execute_populateִpopulate
 static int
 execute_populate(WTPERF *wtperf)
@@ -2111,6 +2189,7 @@ wtperf_copy(const WTPERF *src, WTPERF **retp)
 		dest->async_config = dstrdup(src->async_config);
 
 	dest->ckptthreads = NULL;
+	dest->scanthreads = NULL;
 	dest->popthreads = NULL;
 
 	dest->workers = NULL;
@@ -2156,6 +2235,7 @@ wtperf_free(WTPERF *wtperf)
 	free(wtperf->async_config);
 
 	free(wtperf->ckptthreads);
+	free(wtperf->scanthreads);
 	free(wtperf->popthreads);
 
 	free(wtperf->workers);
@@ -2356,6 +2436,13 @@ start_run(WTPERF *wtperf)
 			start_threads(wtperf, NULL, wtperf->ckptthreads,
 			    opts->checkpoint_threads, checkpoint_worker);
 		}
+		/* Start the scan thread. */
+		if (opts->scan_interval != 0) {
+			lprintf(wtperf, 0, 1, "Starting 1 scan thread");
+			wtperf->scanthreads = dcalloc(1, sizeof(WTPERF_THREAD));
+			start_threads(wtperf,
+			    NULL, wtperf->scanthreads, 1, scan_worker);
+		}
 		if (opts->pre_load_data && (ret = pre_load_data(wtperf)) != 0)
 			goto err;
 		/* Execute the workload. */
@@ -2368,6 +2455,7 @@ start_run(WTPERF *wtperf)
 		wtperf->truncate_ops = sum_truncate_ops(wtperf);
 		wtperf->update_ops = sum_update_ops(wtperf);
 		wtperf->ckpt_ops = sum_ckpt_ops(wtperf);
+		wtperf->scan_ops = sum_scan_ops(wtperf);
 		total_ops =
 		    wtperf->read_ops + wtperf->insert_ops + wtperf->update_ops;
 
@@ -2396,6 +2484,9 @@ start_run(WTPERF *wtperf)
 		lprintf(wtperf, 0, 1,
 		    "Executed %" PRIu64 " checkpoint operations",
 		    wtperf->ckpt_ops);
+		lprintf(wtperf, 0, 1,
+		    "Executed %" PRIu64 " scan operations",
+		    wtperf->scan_ops);
 
 		latency_print(wtperf);
 	}
@@ -2409,6 +2500,7 @@ err:		if (ret == 0)
 	wtperf->stop = true;
 
 	stop_threads(1, wtperf->ckptthreads);
+	stop_threads(1, wtperf->scanthreads);
 
 	if (monitor_created != 0)
 		testutil_check(__wt_thread_join(NULL, monitor_thread));
@@ -141,6 +141,7 @@ struct __wtperf {			/* Per-database structure */
 	const char *compress_table;	/* Compression arg to table create */
 
 	WTPERF_THREAD *ckptthreads;	/* Checkpoint threads */
+	WTPERF_THREAD *scanthreads;	/* Scan threads */
 	//populate_threadpopulate_async
 	WTPERF_THREAD *popthreads;	/* Populate threads */
 
@@ -159,6 +160,7 @@ struct __wtperf {			/* Per-database structure */
 	uint64_t ckpt_ops;		/* checkpoint operations */
 	uint64_t insert_ops;		/* insert operations */
 	uint64_t read_ops;		/* read operations */
+	uint64_t scan_ops;		/* scan operations */
 	uint64_t truncate_ops;		/* truncate operations */
 	uint64_t update_ops;		/* update operations */
 
@@ -264,6 +266,7 @@ struct __wtperf_thread {		/* Per-thread structure */
 	TRACK ckpt;			/* Checkpoint operations */
 	TRACK insert;			/* Insert operations */
 	TRACK read;			/* Read operations */
+	TRACK scan;			/* Scan operations */
 	TRACK update;			/* Update operations */
 	TRACK truncate;			/* Truncate operations */
 	TRACK truncate_sleep;		/* Truncate sleep operations */
@@ -295,6 +298,7 @@ uint64_t sum_ckpt_ops(WTPERF *);
 uint64_t sum_insert_ops(WTPERF *);
 uint64_t sum_pop_ops(WTPERF *);
 uint64_t sum_read_ops(WTPERF *);
+uint64_t sum_scan_ops(WTPERF *);
 uint64_t sum_truncate_ops(WTPERF *);
 uint64_t sum_update_ops(WTPERF *);
 
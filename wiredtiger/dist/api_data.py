@@ -158,11 +158,20 @@ file_runtime_config = [
 # Per-file configuration
 file_config = format_meta + file_runtime_config + [
     Config('block_allocation', 'best', r'''
-        configure block allocation. Permitted values are \c "first" or
-        \c "best"; the \c "first" configuration uses a first-available
-        algorithm during block allocation, the \c "best" configuration
-        uses a best-fit algorithm''',
-        choices=['first', 'best',]),
+        configure block allocation. Permitted values are \c "first",
+        \c "best" or \c "size_class"; the \c "first" configuration uses
+        a first-available algorithm during block allocation, the \c "best"
+        configuration uses a best-fit algorithm, the \c "size_class"
+        configuration allocates from lists of free blocks segregated by
+        size, a best-fit algorithm for smaller blocks that doesn't search
+        the free space''',
+        choices=['first', 'best', 'size_class']),
+    Config('block_avail_delta', 'false', r'''
+        write checkpoints' lists of available file blocks as the changes
+        to a previously written list, writing a complete list again when
+        the changes grow large.  Files written with this configuration
+        cannot be opened by releases that don't support it''',
+        type='boolean'),
     Config('allocation_size', '4KB', r'''
         the file unit allocation size, in bytes, must a power-of-two;
         smaller values decrease the file space required by overflow
@@ -175,6 +184,13 @@ file_config = format_meta + file_runtime_config + [
         WT_CONNECTION::add_compressor.  If WiredTiger has builtin support for
         \c "lz4", \c "snappy", \c "zlib" or \c "zstd" compression, these names
         are also available.  See @ref compression for more information'''),
+    Config('change_buffer_max', '0', r'''
+        the maximum memory used to buffer blind writes (inserts and removes
+        with \c overwrite configured) to row-store leaf pages that are not
+        in the cache, in bytes.  Buffered writes are merged into the page
+        when it is next read, and before the object is checkpointed.  The
+        default value of 0 disables the change buffer''',
+        min='0', max='10TB'),
     Config('checksum', 'uncompressed', r'''
         configure block checksums; permitted values are <code>on</code>
         (checksum all blocks), <code>off</code> (checksum no blocks) and
@@ -274,6 +290,13 @@ file_config = format_meta + file_runtime_config + [
     Config('leaf_item_max', '0', r'''
         historic term for leaf_key_max and leaf_value_max''',
         min=0, undoc=True),
+    Config('leaf_hash_search', '0', r'''
+        build an in-memory hash index of a row-store leaf page's keys
+        after the page has been searched the specified number of times,
+        so later exact-match searches of the page can skip the binary
+        search.  The index is not used with custom collators.  The
+        default value of 0 disables the hash index''',
+        min='0'),
     Config('memory_page_max', '5MB', r'''
         the maximum size a page can grow to in memory before being
         reconciled to disk.  The specified size will be adjusted to a lower
@@ -410,6 +433,19 @@ connection_runtime_config = [
                 both log_size and wait to set an upper bound for checkpoints;
                 setting this value above 0 configures periodic checkpoints''',
             min='0', max='2GB'),
+        Config('pace', 'false', r'''
+            write dirty leaf pages between checkpoints, at a rate that
+            spreads the writes over the interval configured by \c wait,
+            so each checkpoint only has to write the pages dirtied since
+            they were last written.  Ignored unless \c wait is set''',
+            type='boolean'),
+        Config('threads', '1', r'''
+            the number of threads used to write dirty objects during a
+            checkpoint, including the thread running the checkpoint.
+            Objects are written and flushed to stable storage in parallel,
+            their metadata is updated in order by the thread running the
+            checkpoint''',
+            min='1', max='20'),
         Config('wait', '0', r'''
             seconds to wait between each checkpoint; setting this value
             above 0 configures periodic checkpoints''',
@@ -428,6 +464,14 @@ connection_runtime_config = [
     Config('eviction', '', r'''
         eviction configuration options''',
         type='category', subconfig=[
+            Config('policy', 'lru', r'''
+                how pages are chosen for eviction. The \c lru policy orders
+                pages by how recently they were read. The \c scan_resistant
+                policy additionally separates pages referenced once from
+                pages referenced repeatedly, and remembers recently evicted
+                pages, so a single pass over a large object does not
+                displace frequently used pages from cache''',
+                choices=['lru', 'scan_resistant']),
             Config('threads_max', '8', r'''
                 maximum number of threads WiredTiger will start to help evict
                 pages from cache. The number of threads started will vary
@@ -479,6 +523,22 @@ connection_runtime_config = [
             interval in seconds at which to check for files that are
             inactive and close them''', min=1, max=100000),
         ]),
+    Config('io_scheduler', '', r'''
+        schedule the block manager's reads and writes: reads by application
+        threads, writes by eviction and writes by checkpoints are counted
+        and timed separately''',
+        type='category', subconfig=[
+        Config('checkpoint_rate', '0', r'''
+            limit checkpoint writes to this many bytes per second, allowing
+            bursts of a tenth of a second of writes. A setting of 0 means
+            checkpoint writes are not limited''',
+            min='0', max='100GB'),
+        Config('read_priority', 'false', r'''
+            give application reads priority over checkpoint writes and
+            writes by eviction threads: the writes wait briefly for reads
+            in progress to complete''',
+            type='boolean'),
+        ]),
     Config('lsm_manager', '', r'''
         configure database wide options for LSM tree management. The LSM
         manager is started automatically the first time an LSM tree is opened.
@@ -589,6 +649,13 @@ log_configuration_common = [
     Config('archive', 'true', r'''
         automatically archive unneeded log files''',
         type='boolean'),
+    Config('group_commit_delay', '0', r'''
+        the maximum time in microseconds a synchronous commit may be delayed
+        so concurrent commits share its log sync.  The delay adapts to the
+        observed rate of synchronous commits and log sync time, and commits
+        are only delayed when others are expected to arrive during a log
+        sync.  A value of 0 disables delaying commits''',
+        min='0', max='100000'),
     Config('prealloc', 'true', r'''
         pre-allocate log files''',
         type='boolean'),
@@ -612,6 +679,12 @@ wiredtiger_open_log_configuration = [
         Config('enabled', 'false', r'''
             enable logging subsystem''',
             type='boolean'),
+        Config('compress_slots', 'false', r'''
+            compress the records buffered in a log slot as a single frame
+            when the slot is written, rather than compressing each record.
+            Requires a \c compressor, and is ignored with log encryption or
+            while a log version of an older release is written''',
+            type='boolean'),
         Config('compressor', 'none', r'''
             configure a compressor for log records.  Permitted values are
             \c "none" or custom compression engine name created with
@@ -622,6 +695,18 @@ wiredtiger_open_log_configuration = [
         Config('file_max', '100MB', r'''
             the maximum size of log files''',
             min='100KB', max='2GB'),
+        Config('io_uring', 'false', r'''
+            write and sync log files asynchronously through a Linux io_uring,
+            linking the sync of a synchronous commit to its write.  Ignored
+            where io_uring is not available''',
+            type='boolean'),
+        Config('join_groups', '0', r'''
+            the number of groups sessions are spread across when joining
+            the active log slot.  Concurrent joins in a group are combined
+            into a single update of the slot by one of the joining threads,
+            reducing contention on the slot with many writing threads.  A
+            value of 0 disables combining''',
+            min='0', max='64'),
             Config('path', '"."', r'''
                 the name of a directory into which log files are written. The
                 directory must already exist. If the value is not an absolute
@@ -630,7 +715,28 @@ wiredtiger_open_log_configuration = [
         Config('recover', 'on', r'''
             run recovery or error if recovery needs to run after an
             unclean shutdown''',
-            choices=['error','on'])
+            choices=['error','on']),
+        Config('recover_threads', '1', r'''
+            the number of threads applying log records during recovery.
+            With more than one thread, the log is read by a separate thread
+            and operations are applied by the configured threads, each
+            applying all of the operations for a subset of the files''',
+            min='1', max='20'),
+        Config('recycle', 'false', r'''
+            reuse archived log files as pre-allocated log files instead of
+            removing them.  Records are checksummed with the log file number
+            so the old records in a recycled file are never read as records
+            of the new file.  Requires both \c archive and \c prealloc,
+            configuring it without them is an error.  Ignored while the log
+            version of an older release is written''',
+            type='boolean'),
+        Config('streams', '1', r'''
+            the number of log streams transactions commit into.  Commits
+            are assigned a stream by the files they modify, and each stream
+            consolidates its commits in its own active slot, reducing
+            contention on a single slot.  Other log records are written in
+            order across all of the streams''',
+            min='1', max='16'),
     ]),
 ]
 
@@ -750,6 +856,22 @@ wiredtiger_open_common =\
             It must also be provided to any "wt" commands used with
             this database'''),
         ]),
+    Config('eviction_queues', '', r'''
+        eviction candidate queue configuration''',
+        type='category', subconfig=[
+        Config('numa', 'false', r'''
+            assign shards to NUMA nodes, rounding the number of shards up to
+            a multiple of the number of nodes; threads prefer shards on the
+            node they are running on.  Ignored on systems without NUMA
+            support''',
+            type='boolean'),
+        Config('shards', '1', r'''
+            number of independently locked sets of eviction candidate
+            queues.  Threads helping with eviction take pages from a home
+            shard and steal from other shards when it is empty, reducing
+            contention on eviction queue locks with many threads''',
+            min='1', max='64'),
+        ]),
     Config('extensions', '', r'''
         list of shared library extensions to load (using dlopen).
         Any values specified to a library extension are passed to
@@ -775,6 +897,21 @@ wiredtiger_open_common =\
         RPC server for primary processes and use RPC for secondary
         processes). <b>Not yet supported in WiredTiger</b>''',
         type='boolean'),
+    Config('read_ahead', '', r'''
+        asynchronous read-ahead of leaf pages for cursors scanning an
+        object. Read-ahead starts when a cursor moves sequentially across
+        leaf pages, or immediately for cursors opened with \c read_ahead''',
+        type='category', subconfig=[
+        Config('pages', '8', r'''
+            number of leaf pages following a scanning cursor to read into
+            the cache''',
+            min='1', max='64'),
+        Config('threads', '0', r'''
+            number of threads reading pages ahead of scanning cursors, zero
+            disables read-ahead. Each thread uses a session from the
+            configured session_max''',
+            min='0', max='20'),
+        ]),
     Config('readonly', 'false', r'''
         open connection in read-only mode.  The database must exist.  All
         methods that may modify a database are disabled.  See @ref readonly
@@ -787,6 +924,19 @@ wiredtiger_open_common =\
     Config('session_scratch_max', '2MB', r'''
         maximum memory to cache in each session''',
         type='int', undoc=True),
+    Config('transaction_snapshot', '', r'''
+        how running transactions are found when allocating snapshots and
+        updating the oldest transaction ID''',
+        type='category', subconfig=[
+        Config('method', 'scan', r'''
+            the \c scan method checks the transaction state of every
+            session; the \c active method tracks which sessions have
+            published a transaction ID or pinned snapshot and checks only
+            those, cheaper when many sessions are open but few run
+            transactions concurrently, at the cost of an atomic update of
+            shared state when transactions start and finish''',
+            choices=['active', 'scan']),
+        ]),
     Config('transaction_sync', '', r'''
         how to sync log records when the transaction commits''',
         type='category', subconfig=[
@@ -1016,6 +1166,11 @@ methods = {
         ignore the encodings for the key and value, manage data as if
         the formats were \c "u".  See @ref cursor_raw for details''',
         type='boolean'),
+    Config('read_ahead', 'false', r'''
+        start reading leaf pages ahead of the cursor as soon as it begins
+        scanning, rather than waiting to detect sequential access. Ignored
+        unless \c read_ahead threads are configured for the connection''',
+        type='boolean'),
     Config('readonly', 'false', r'''
         only query operations are supported by this cursor. An error is
         returned if a modification is attempted using the cursor.  The
@@ -1044,9 +1199,16 @@ methods = {
         cleared).  See @ref statistics for more information''',
         type='list',
         choices=['all', 'cache_walk', 'fast', 'clear', 'size', 'tree_walk']),
+    Config('tail_wait', '0', r'''
+        for log cursors, the number of milliseconds WT_CURSOR::next and
+        WT_CURSOR::next_batch wait for new log records to be written when
+        the cursor reaches the end of the log, before returning
+        ::WT_NOTFOUND''',
+        min='0', max='3600000'),
     Config('target', '', r'''
         if non-empty, backup the list of objects; valid only for a
-        backup data source''',
+        backup data source.  For log cursors, return only the operations
+        on the listed tables, column groups, indices or files''',
         type='list'),
 ]),
 
@@ -32,6 +32,7 @@ flags = {
         'READ_NO_WAIT',
         'READ_PREV',
         'READ_RESTART_OK',
+        'READ_SKIP_CLEAN',
         'READ_SKIP_INTL',
         'READ_TRUNCATE',
         'READ_WONT_NEED',
@@ -124,6 +125,7 @@ flags = {
     ],
     'session' : [
         'SESSION_CAN_WAIT',
+        'SESSION_CHECKPOINT_WORKER',
         'SESSION_INTERNAL',
         'SESSION_IGNORE_CACHE_SIZE',
         'SESSION_LOCKED_CHECKPOINT',
@@ -180,6 +180,19 @@ connection_stats = [
     BlockStat('block_map_read', 'mapped blocks read'),
     BlockStat('block_preload', 'blocks pre-loaded'),
     BlockStat('block_read', 'blocks read'),
+    BlockStat('block_sched_checkpoint', 'I/O scheduler checkpoint writes'),
+    BlockStat('block_sched_checkpoint_active', 'I/O scheduler checkpoint writes in progress', 'no_clear,no_scale'),
+    BlockStat('block_sched_checkpoint_throttle', 'I/O scheduler checkpoint writes rate limited'),
+    BlockStat('block_sched_checkpoint_throttle_time', 'I/O scheduler checkpoint write rate limit time (usecs)'),
+    BlockStat('block_sched_checkpoint_time', 'I/O scheduler checkpoint write time (usecs)'),
+    BlockStat('block_sched_evict', 'I/O scheduler eviction writes'),
+    BlockStat('block_sched_evict_active', 'I/O scheduler eviction writes in progress', 'no_clear,no_scale'),
+    BlockStat('block_sched_evict_time', 'I/O scheduler eviction write time (usecs)'),
+    BlockStat('block_sched_read', 'I/O scheduler application reads'),
+    BlockStat('block_sched_read_active', 'I/O scheduler application reads in progress', 'no_clear,no_scale'),
+    BlockStat('block_sched_read_time', 'I/O scheduler application read time (usecs)'),
+    BlockStat('block_sched_write_yield', 'I/O scheduler writes delayed for application reads'),
+    BlockStat('block_sched_write_yield_time', 'I/O scheduler write delay time for application reads (usecs)'),
     BlockStat('block_write', 'blocks written'),
 
     ##########################################
@@ -195,6 +208,9 @@ connection_stats = [
     CacheStat('cache_bytes_other', 'bytes not belonging to page images in the cache', 'no_clear,no_scale,size'),
     CacheStat('cache_bytes_read', 'bytes read into cache', 'size'),
     CacheStat('cache_bytes_write', 'bytes written from cache', 'size'),
+    CacheStat('cache_change_buffer_merge', 'change buffer pages merged'),
+    CacheStat('cache_change_buffer_skip_full', 'change buffer writes not buffered because the buffer is full'),
+    CacheStat('cache_change_buffer_write', 'change buffer writes buffered for pages not in the cache'),
     CacheStat('cache_eviction_active_workers', 'eviction worker thread active', 'no_clear'),
     CacheStat('cache_eviction_aggressive_set', 'eviction currently operating in aggressive mode', 'no_clear,no_scale'),
     CacheStat('cache_eviction_app', 'pages evicted by application threads'),
@@ -222,10 +238,18 @@ connection_stats = [
     CacheStat('cache_eviction_pages_queued_oldest', 'pages queued for urgent eviction during walk'),
     CacheStat('cache_eviction_pages_queued_urgent', 'pages queued for urgent eviction'),
     CacheStat('cache_eviction_pages_seen', 'pages seen by eviction walk'),
+    CacheStat('cache_eviction_policy_demote', 'eviction policy hot pages demoted after not being referenced'),
+    CacheStat('cache_eviction_policy_ghost_add', 'eviction policy evicted pages remembered'),
+    CacheStat('cache_eviction_policy_ghost_hit', 'eviction policy remembered pages read again'),
+    CacheStat('cache_eviction_policy_hot_pages', 'eviction policy hot pages currently in cache', 'no_clear,no_scale'),
+    CacheStat('cache_eviction_policy_promote', 'eviction policy pages promoted to hot after being referenced again'),
     CacheStat('cache_eviction_queue_empty', 'eviction server candidate queue empty when topping up'),
     CacheStat('cache_eviction_queue_not_empty', 'eviction server candidate queue not empty when topping up'),
     CacheStat('cache_eviction_server_evicting', 'eviction server evicting pages'),
     CacheStat('cache_eviction_server_slept', 'eviction server slept, because we did not make progress with eviction'),
+    CacheStat('cache_eviction_shard_depth_max', 'eviction shard maximum queued candidates', 'no_clear,no_scale'),
+    CacheStat('cache_eviction_shard_depth_min', 'eviction shard minimum queued candidates', 'no_clear,no_scale'),
+    CacheStat('cache_eviction_shard_steal', 'eviction calls to get a page took it from another shard'),
     CacheStat('cache_eviction_slow', 'eviction server unable to reach eviction goal'),
     CacheStat('cache_eviction_split_internal', 'internal pages split during eviction'),
     CacheStat('cache_eviction_split_leaf', 'leaf pages split during eviction'),
@@ -264,6 +288,10 @@ connection_stats = [
     CacheStat('cache_pages_inuse', 'pages currently held in the cache', 'no_clear,no_scale'),
     CacheStat('cache_pages_requested', 'pages requested from the cache'),
     CacheStat('cache_read', 'pages read into cache'),
+    CacheStat('cache_read_ahead_queued', 'read-ahead pages queued'),
+    CacheStat('cache_read_ahead_run', 'read-ahead pages searched by read-ahead threads'),
+    CacheStat('cache_read_ahead_skip_cache', 'read-ahead pages skipped because the cache is full'),
+    CacheStat('cache_read_ahead_skip_queue', 'read-ahead pages skipped because the queue is full'),
     CacheStat('cache_read_app_count', 'application threads page read from disk to cache count'),
     CacheStat('cache_read_app_time', 'application threads page read from disk to cache time (usecs)'),
     CacheStat('cache_read_lookaside', 'pages read into cache requiring lookaside entries'),
@@ -279,14 +307,21 @@ connection_stats = [
     ##########################################
     CursorStat('cursor_create', 'cursor create calls'),
     CursorStat('cursor_insert', 'cursor insert calls'),
+    CursorStat('cursor_insert_batch', 'cursor insert-batch calls'),
+    CursorStat('cursor_insert_batch_pinned', 'cursor insert-batch keys inserted without searching from the root'),
     CursorStat('cursor_modify', 'cursor modify calls'),
     CursorStat('cursor_next', 'cursor next calls'),
+    CursorStat('cursor_next_batch', 'cursor next-batch calls'),
     CursorStat('cursor_prev', 'cursor prev calls'),
     CursorStat('cursor_remove', 'cursor remove calls'),
     CursorStat('cursor_reserve', 'cursor reserve calls'),
     CursorStat('cursor_reset', 'cursor reset calls'),
     CursorStat('cursor_restart', 'cursor restarted searches'),
     CursorStat('cursor_search', 'cursor search calls'),
+    CursorStat('cursor_search_batch', 'cursor search-batch calls'),
+    CursorStat('cursor_search_hash_build', 'cursor search leaf page hash indexes built'),
+    CursorStat('cursor_search_hash_hit', 'cursor search leaf page hash index hits'),
+    CursorStat('cursor_search_hash_miss', 'cursor search leaf page hash index misses'),
     CursorStat('cursor_search_near', 'cursor search near calls'),
     CursorStat('cursor_truncate', 'truncate calls'),
     CursorStat('cursor_update', 'cursor update calls'),
@@ -313,6 +348,12 @@ connection_stats = [
     LockStat('lock_dhandle_wait_application', 'dhandle lock application thread time waiting for the dhandle lock (usecs)'),
     LockStat('lock_dhandle_wait_internal', 'dhandle lock internal thread time waiting for the dhandle lock (usecs)'),
     LockStat('lock_dhandle_write_count', 'dhandle write lock acquisitions'),
+    LockStat('lock_evict_queue_count', 'eviction candidate queue lock acquisitions'),
+    LockStat('lock_evict_queue_wait_application', 'eviction candidate queue lock application thread wait time (usecs)'),
+    LockStat('lock_evict_queue_wait_internal', 'eviction candidate queue lock internal thread wait time (usecs)'),
+    LockStat('lock_evict_shard_count', 'eviction shard lock acquisitions'),
+    LockStat('lock_evict_shard_wait_application', 'eviction shard lock application thread wait time (usecs)'),
+    LockStat('lock_evict_shard_wait_internal', 'eviction shard lock internal thread wait time (usecs)'),
     LockStat('lock_metadata_count', 'metadata lock acquisitions'),
     LockStat('lock_metadata_wait_application', 'metadata lock application thread wait time (usecs)'),
     LockStat('lock_metadata_wait_internal', 'metadata lock internal thread wait time (usecs)'),
@@ -331,8 +372,15 @@ connection_stats = [
     LogStat('log_bytes_payload', 'log bytes of payload data', 'size'),
     LogStat('log_bytes_written', 'log bytes written', 'size'),
     LogStat('log_close_yields', 'yields waiting for previous log file close'),
+    LogStat('log_commit_latency_ge10000', 'synchronous commit latency histogram - 10000us and higher'),
+    LogStat('log_commit_latency_lt100', 'synchronous commit latency histogram - 0-99us'),
+    LogStat('log_commit_latency_lt1000', 'synchronous commit latency histogram - 250-999us'),
+    LogStat('log_commit_latency_lt10000', 'synchronous commit latency histogram - 1000-9999us'),
+    LogStat('log_commit_latency_lt250', 'synchronous commit latency histogram - 100-249us'),
     LogStat('log_compress_len', 'total size of compressed records', 'size'),
     LogStat('log_compress_mem', 'total in-memory size of compressed records', 'size'),
+    LogStat('log_compress_slot_fails', 'log slot buffers not compressed'),
+    LogStat('log_compress_slots', 'log slot buffers compressed'),
     LogStat('log_compress_small', 'log records too small to compress'),
     LogStat('log_compress_write_fails', 'log records not compressed'),
     LogStat('log_compress_writes', 'log records compressed'),
@@ -340,10 +388,16 @@ connection_stats = [
     LogStat('log_force_ckpt_sleep', 'force checkpoint calls slept'),
     LogStat('log_force_write', 'log force write operations'),
     LogStat('log_force_write_skip', 'log force write operations skipped'),
+    LogStat('log_group_commit_delay', 'group commit delays'),
+    LogStat('log_group_commit_delay_time', 'group commit delay time (usecs)', 'no_clear,no_scale'),
+    LogStat('log_io_uring_enabled', 'log I/O through io_uring', 'no_clear,no_scale'),
+    LogStat('log_io_uring_sync', 'log syncs linked to log writes'),
+    LogStat('log_io_uring_write', 'log writes submitted asynchronously'),
     LogStat('log_max_filesize', 'maximum log file size', 'no_clear,no_scale,size'),
     LogStat('log_prealloc_files', 'pre-allocated log files prepared'),
     LogStat('log_prealloc_max', 'number of pre-allocated log files to create', 'no_clear,no_scale'),
     LogStat('log_prealloc_missed', 'pre-allocated log files not ready and missed'),
+    LogStat('log_prealloc_recycled', 'pre-allocated log files recycled'),
     LogStat('log_prealloc_used', 'pre-allocated log files used'),
     LogStat('log_release_write_lsn', 'log release advances write LSN'),
     LogStat('log_scan_records', 'records processed by log scan'),
@@ -354,8 +408,13 @@ connection_stats = [
     LogStat('log_slot_close_unbuf', 'slot close unbuffered waits'),
     LogStat('log_slot_closes', 'slot closures'),
     LogStat('log_slot_coalesced', 'written slots coalesced'),
+    LogStat('log_slot_combine', 'slot join combining passes'),
+    LogStat('log_slot_combine_wait', 'slot join calls waited for combining'),
+    LogStat('log_slot_combine_wait_duration', 'slot join combining wait time (usecs)', 'no_clear,no_scale'),
+    LogStat('log_slot_combined', 'slot joins combined'),
     LogStat('log_slot_consolidated', 'logging bytes consolidated', 'size'),
     LogStat('log_slot_immediate', 'slot join calls did not yield'),
+    LogStat('log_slot_join_retries', 'slot join retries'),
     LogStat('log_slot_no_free_slots', 'slot transitions unable to find free slot'),
     LogStat('log_slot_races', 'slot join atomic update races'),
     LogStat('log_slot_switch_busy', 'busy returns attempting to switch slots'),
@@ -365,7 +424,14 @@ connection_stats = [
     LogStat('log_slot_yield_duration', 'slot joins yield time (usecs)', 'no_clear,no_scale'),
     LogStat('log_slot_yield_race', 'slot join calls atomic updates raced'),
     LogStat('log_slot_yield_sleep', 'slot join calls slept'),
+    LogStat('log_stream_ordered', 'log records written in order across log streams'),
+    LogStat('log_stream_writes', 'log records written to a log stream'),
     LogStat('log_sync', 'log sync operations'),
+    LogStat('log_sync_commits_ge16', 'synchronous commits per log sync histogram - 16 and higher'),
+    LogStat('log_sync_commits_lt16', 'synchronous commits per log sync histogram - 8-15'),
+    LogStat('log_sync_commits_lt2', 'synchronous commits per log sync histogram - 0-1'),
+    LogStat('log_sync_commits_lt4', 'synchronous commits per log sync histogram - 2-3'),
+    LogStat('log_sync_commits_lt8', 'synchronous commits per log sync histogram - 4-7'),
     LogStat('log_sync_dir', 'log sync_dir operations'),
     LogStat('log_sync_dir_duration', 'log sync_dir time duration (usecs)', 'no_clear,no_scale'),
     LogStat('log_sync_duration', 'log sync time duration (usecs)', 'no_clear,no_scale'),
@@ -435,17 +501,30 @@ connection_stats = [
     ##########################################
     TxnStat('txn_begin', 'transaction begins'),
     TxnStat('txn_checkpoint', 'transaction checkpoints'),
+    TxnStat('txn_checkpoint_fsync_parallel', 'transaction checkpoint objects flushed in parallel'),
     TxnStat('txn_checkpoint_fsync_post', 'transaction fsync calls for checkpoint after allocating the transaction ID'),
     TxnStat('txn_checkpoint_fsync_post_duration', 'transaction fsync duration for checkpoint after allocating the transaction ID (usecs)', 'no_clear,no_scale'),
     TxnStat('txn_checkpoint_generation', 'transaction checkpoint generation', 'no_clear,no_scale'),
+    TxnStat('txn_checkpoint_leaf_parallel', 'transaction checkpoint leaf pages written in parallel'),
+    TxnStat('txn_checkpoint_pace_bytes', 'transaction checkpoint paced bytes written', 'size'),
+    TxnStat('txn_checkpoint_pace_pages', 'transaction checkpoint paced pages written'),
+    TxnStat('txn_checkpoint_pace_rate', 'transaction checkpoint paced write rate (bytes per second)', 'no_clear,no_scale'),
+    TxnStat('txn_checkpoint_pace_remaining', 'transaction checkpoint dirty bytes remaining after pacing', 'no_clear,no_scale,size'),
     TxnStat('txn_checkpoint_running', 'transaction checkpoint currently running', 'no_clear,no_scale'),
     TxnStat('txn_checkpoint_scrub_target', 'transaction checkpoint scrub dirty target', 'no_clear,no_scale'),
     TxnStat('txn_checkpoint_scrub_time', 'transaction checkpoint scrub time (msecs)', 'no_clear,no_scale'),
+    TxnStat('txn_checkpoint_thread_bytes_max', 'transaction checkpoint thread max bytes written', 'no_clear,no_scale,size'),
+    TxnStat('txn_checkpoint_thread_bytes_min', 'transaction checkpoint thread min bytes written', 'no_clear,no_scale,size'),
+    TxnStat('txn_checkpoint_thread_time_max', 'transaction checkpoint thread max time (msecs)', 'no_clear,no_scale'),
+    TxnStat('txn_checkpoint_thread_time_min', 'transaction checkpoint thread min time (msecs)', 'no_clear,no_scale'),
+    TxnStat('txn_checkpoint_thread_trees', 'transaction checkpoint objects written in parallel'),
     TxnStat('txn_checkpoint_skipped', 'transaction checkpoints skipped because database was clean'),
     TxnStat('txn_checkpoint_time_max', 'transaction checkpoint max time (msecs)', 'no_clear,no_scale'),
     TxnStat('txn_checkpoint_time_min', 'transaction checkpoint min time (msecs)', 'no_clear,no_scale'),
     TxnStat('txn_checkpoint_time_recent', 'transaction checkpoint most recent time (msecs)', 'no_clear,no_scale'),
     TxnStat('txn_checkpoint_time_total', 'transaction checkpoint total time (msecs)', 'no_clear,no_scale'),
+    TxnStat('txn_checkpoint_walk_pages', 'transaction checkpoint tree walk pages visited'),
+    TxnStat('txn_checkpoint_walk_skipped', 'transaction checkpoint tree walk clean subtrees skipped'),
     TxnStat('txn_commit', 'transactions committed'),
     TxnStat('txn_commit_queue_head', 'transactions commit timestamp queue inserts to head'),
     TxnStat('txn_commit_queue_inserts', 'transactions commit timestamp queue inserts total'),
@@ -459,6 +538,7 @@ connection_stats = [
     TxnStat('txn_read_queue_head', 'transactions read timestamp queue inserts to head'),
     TxnStat('txn_read_queue_inserts', 'transactions read timestamp queue inserts total'),
     TxnStat('txn_read_queue_len', 'transactions read timestamp queue length'),
+    TxnStat('txn_recover_parallel_ops', 'recovery operations applied in parallel'),
     TxnStat('txn_rollback', 'transactions rolled back'),
     TxnStat('txn_snapshots_created', 'number of named snapshots created'),
     TxnStat('txn_snapshots_dropped', 'number of named snapshots dropped'),
@@ -496,6 +576,8 @@ dsrc_stats = [
     ##########################################
     BlockStat('allocation_size', 'file allocation unit size', 'max_aggregate,no_scale,size'),
     BlockStat('block_alloc', 'blocks allocated'),
+    BlockStat('block_avail_base', 'avail extent list bases written'),
+    BlockStat('block_avail_delta', 'avail extent lists written as changes'),
     BlockStat('block_checkpoint_size', 'checkpoint size', 'no_scale,size'),
     BlockStat('block_extension', 'allocations requiring file extension'),
     BlockStat('block_free', 'blocks freed'),
@@ -534,6 +616,10 @@ dsrc_stats = [
     CacheStat('cache_bytes_inuse', 'bytes currently in the cache', 'no_clear,no_scale,size'),
     CacheStat('cache_bytes_read', 'bytes read into cache', 'size'),
     CacheStat('cache_bytes_write', 'bytes written from cache', 'size'),
+    CacheStat('cache_change_buffer_bytes', 'change buffer bytes', 'no_clear,no_scale,size'),
+    CacheStat('cache_change_buffer_merge', 'change buffer pages merged'),
+    CacheStat('cache_change_buffer_skip_full', 'change buffer writes not buffered because the buffer is full'),
+    CacheStat('cache_change_buffer_write', 'change buffer writes buffered for pages not in the cache'),
     CacheStat('cache_eviction_checkpoint', 'checkpoint blocked page eviction'),
     CacheStat('cache_eviction_clean', 'unmodified pages evicted'),
     CacheStat('cache_eviction_deepen', 'page split during eviction deepened the tree'),
@@ -608,10 +694,12 @@ dsrc_stats = [
     ##########################################
     CursorStat('cursor_create', 'create calls'),
     CursorStat('cursor_insert', 'insert calls'),
+    CursorStat('cursor_insert_batch', 'insert-batch calls'),
     CursorStat('cursor_insert_bulk', 'bulk-loaded cursor-insert calls'),
     CursorStat('cursor_insert_bytes', 'cursor-insert key and value bytes inserted', 'size'),
     CursorStat('cursor_modify', 'modify calls'),
     CursorStat('cursor_next', 'next calls'),
+    CursorStat('cursor_next_batch', 'next-batch calls'),
     CursorStat('cursor_prev', 'prev calls'),
     CursorStat('cursor_remove', 'remove calls'),
     CursorStat('cursor_remove_bytes', 'cursor-remove key bytes removed', 'size'),
@@ -619,6 +707,10 @@ dsrc_stats = [
     CursorStat('cursor_reset', 'reset calls'),
     CursorStat('cursor_restart', 'restarted searches'),
     CursorStat('cursor_search', 'search calls'),
+    CursorStat('cursor_search_batch', 'search-batch calls'),
+    CursorStat('cursor_search_hash_build', 'search leaf page hash indexes built'),
+    CursorStat('cursor_search_hash_hit', 'search leaf page hash index hits'),
+    CursorStat('cursor_search_hash_miss', 'search leaf page hash index misses'),
     CursorStat('cursor_search_near', 'search near calls'),
     CursorStat('cursor_truncate', 'truncate calls'),
     CursorStat('cursor_update', 'update calls'),
@@ -269,6 +269,23 @@ cursor_ops(WT_SESSION *session)
 	/*! [Insert a new record or overwrite an existing record] */
 	}
 
+	{
+	/*! [Insert a batch of records] */
+	WT_ITEM keys[2], values[2];
+
+	/* Keys and values are in raw format, sorted in ascending order. */
+	keys[0].data = "batch key 1";
+	keys[0].size = strlen("batch key 1") + 1;
+	values[0].data = "batch value 1";
+	values[0].size = strlen("batch value 1") + 1;
+	keys[1].data = "batch key 2";
+	keys[1].size = strlen("batch key 2") + 1;
+	values[1].data = "batch value 2";
+	values[1].size = strlen("batch value 2") + 1;
+	error_check(cursor->insert_batch(cursor, keys, values, 2));
+	/*! [Insert a batch of records] */
+	}
+
 	{
 	/*! [Search for an exact match] */
 	const char *key = "some key";
@@ -277,6 +294,38 @@ cursor_ops(WT_SESSION *session)
 	/*! [Search for an exact match] */
 	}
 
+	{
+	/*! [Return a batch of records] */
+	WT_ITEM keys[100], values[100];
+	size_t i, count;
+
+	error_check(cursor->reset(cursor));
+	while ((ret = cursor->next_batch(
+	    cursor, keys, values, 100, &count)) == 0)
+		for (i = 0; i < count; ++i) {
+			/* Keys and values are returned in raw format. */
+		}
+	scan_end_check(ret == WT_NOTFOUND);
+	/*! [Return a batch of records] */
+	}
+
+	{
+	/*! [Search for a batch of keys] */
+	WT_ITEM keys[2], values[2];
+	int results[2];
+
+	/* Keys are in raw format, sorted in ascending order. */
+	keys[0].data = "new key";
+	keys[0].size = strlen("new key") + 1;
+	keys[1].data = "some key";
+	keys[1].size = strlen("some key") + 1;
+	error_check(cursor->search_batch(cursor, keys, values, results, 2));
+	if (results[1] == 0) {
+		/* The value of the second key is in values[1]. */
+	}
+	/*! [Search for a batch of keys] */
+	}
+
 	cursor_search_near(cursor);
 
 	{
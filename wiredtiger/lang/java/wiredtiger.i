@@ -177,6 +177,18 @@ typedef struct __wt_java_modify_impl {
 	}
 %}
 
+/* Return byte[][] from the cursor batch methods. */
+%typemap(jni) jobjectArray "jobjectArray"
+%typemap(jtype) jobjectArray "byte[][]"
+%typemap(jstype) jobjectArray "byte[][]"
+
+%typemap(javain) jobjectArray "$javainput"
+%typemap(javaout) jobjectArray {
+	return ($jnicall);
+}
+%typemap(in) jobjectArray %{ $1 = $input; %}
+%typemap(out) jobjectArray %{ $result = $1; %}
+
 /*
  * In some cases, for an internal interface, we need something like a WT_ITEM,
  * but we need to hold onto the memory past the method call, and release it
@@ -347,6 +359,9 @@ WT_CLASS(struct __wt_async_op, WT_ASYNC_OP, op)
 %ignore __wt_cursor::search;
 %ignore __wt_cursor::search_near;
 %ignore __wt_cursor::update;
+%ignore __wt_cursor::next_batch;
+%ignore __wt_cursor::search_batch;
+%ignore __wt_cursor::insert_batch;
 %javamethodmodifiers __wt_cursor::next "protected";
 %rename (next_wrap) __wt_cursor::next;
 %javamethodmodifiers __wt_cursor::prev "protected";
@@ -1242,6 +1257,165 @@ WT_ASYNC_CALLBACK javaApiAsyncHandler = {javaAsyncHandler};
 		return ($self->update($self));
 	}
 
+	%javamethodmodifiers next_batch_wrap "protected";
+	jobjectArray next_batch_wrap(JNIEnv *jenv, int count) {
+		WT_ITEM *items;
+		jbyteArray b;
+		jclass cls;
+		jobjectArray result;
+		size_t i, n;
+		int ret;
+
+		if (count <= 0) {
+			throwWiredTigerException(jenv, EINVAL);
+			return (NULL);
+		}
+		if ((ret = __wt_calloc_def(NULL,
+		    2 * (size_t)count, &items)) != 0) {
+			throwWiredTigerException(jenv, ret);
+			return (NULL);
+		}
+		n = 0;
+		result = NULL;
+		ret = $self->next_batch(
+		    $self, items, items + count, (size_t)count, &n);
+		if (ret != 0 && ret != WT_NOTFOUND) {
+			throwWiredTigerException(jenv, ret);
+			goto err;
+		}
+
+		/* Keys and values alternate in the returned array. */
+		cls = (*jenv)->FindClass(jenv, "[B");
+		if ((result = (*jenv)->NewObjectArray(
+		    jenv, (jsize)(2 * n), cls, NULL)) == NULL)
+			goto err;
+		for (i = 0; i < 2 * n; i++) {
+			WT_ITEM *item = (i % 2 == 0) ?
+			    &items[i / 2] : &items[count + i / 2];
+			if ((b = (*jenv)->NewByteArray(
+			    jenv, (jsize)item->size)) == NULL)
+				goto err;
+			(*jenv)->SetByteArrayRegion(
+			    jenv, b, 0, (jsize)item->size, item->data);
+			(*jenv)->SetObjectArrayElement(jenv, result, (jsize)i, b);
+			(*jenv)->DeleteLocalRef(jenv, b);
+		}
+
+err:		__wt_free(NULL, items);
+		return (result);
+	}
+
+	%javamethodmodifiers search_batch_wrap "protected";
+	jobjectArray search_batch_wrap(JNIEnv *jenv, jobjectArray keys) {
+		WT_ITEM *items;
+		jbyteArray b;
+		jclass cls;
+		jobjectArray result;
+		jsize i, n;
+		int *results, ret;
+
+		cls = (*jenv)->FindClass(jenv, "[B");
+		if ((n = (*jenv)->GetArrayLength(jenv, keys)) == 0)
+			return ((*jenv)->NewObjectArray(jenv, 0, cls, NULL));
+		items = NULL;
+		results = NULL;
+		result = NULL;
+		if ((ret = __wt_calloc_def(NULL, 2 * (size_t)n, &items)) != 0 ||
+		    (ret = __wt_calloc_def(NULL, (size_t)n, &results)) != 0) {
+			throwWiredTigerException(jenv, ret);
+			goto err;
+		}
+		for (i = 0; i < n; i++) {
+			b = (*jenv)->GetObjectArrayElement(jenv, keys, i);
+			if (b == NULL) {
+				SWIG_JavaThrowException(jenv,
+				    SWIG_JavaNullPointerException,
+				    "key is null");
+				goto err;
+			}
+			items[i].size = (size_t)(*jenv)->GetArrayLength(jenv, b);
+			if ((ret = __wt_malloc(NULL,
+			    items[i].size + 1, &items[i].mem)) != 0) {
+				throwWiredTigerException(jenv, ret);
+				goto err;
+			}
+			(*jenv)->GetByteArrayRegion(jenv,
+			    b, 0, (jsize)items[i].size, items[i].mem);
+			items[i].data = items[i].mem;
+			(*jenv)->DeleteLocalRef(jenv, b);
+		}
+
+		if ((ret = $self->search_batch($self,
+		    items, items + n, results, (size_t)n)) != 0) {
+			throwWiredTigerException(jenv, ret);
+			goto err;
+		}
+
+		/* Keys that weren't found have a null value. */
+		if ((result = (*jenv)->NewObjectArray(
+		    jenv, n, cls, NULL)) == NULL)
+			goto err;
+		for (i = 0; i < n; i++) {
+			WT_ITEM *item = &items[n + i];
+			if (results[i] != 0)
+				continue;
+			if ((b = (*jenv)->NewByteArray(
+			    jenv, (jsize)item->size)) == NULL)
+				goto err;
+			(*jenv)->SetByteArrayRegion(
+			    jenv, b, 0, (jsize)item->size, item->data);
+			(*jenv)->SetObjectArrayElement(jenv, result, i, b);
+			(*jenv)->DeleteLocalRef(jenv, b);
+		}
+
+err:		if (items != NULL)
+			for (i = 0; i < n; i++)
+				__wt_free(NULL, items[i].mem);
+		__wt_free(NULL, items);
+		__wt_free(NULL, results);
+		return (result);
+	}
+
+	%javamethodmodifiers insert_batch_wrap "protected";
+	int insert_batch_wrap(
+	    JNIEnv *jenv, jobjectArray keys, jobjectArray values) {
+		WT_ITEM *items;
+		jbyteArray b;
+		jsize i, n;
+		int ret;
+
+		n = (*jenv)->GetArrayLength(jenv, keys);
+		if (n != (*jenv)->GetArrayLength(jenv, values))
+			return (EINVAL);
+		if (n == 0)
+			return (0);
+		if ((ret = __wt_calloc_def(NULL, 2 * (size_t)n, &items)) != 0)
+			return (ret);
+		for (i = 0; i < 2 * n; i++) {
+			b = (*jenv)->GetObjectArrayElement(
+			    jenv, i < n ? keys : values, i % n);
+			if (b == NULL) {
+				ret = EINVAL;
+				goto err;
+			}
+			items[i].size = (size_t)(*jenv)->GetArrayLength(jenv, b);
+			if ((ret = __wt_malloc(NULL,
+			    items[i].size + 1, &items[i].mem)) != 0)
+				goto err;
+			(*jenv)->GetByteArrayRegion(jenv,
+			    b, 0, (jsize)items[i].size, items[i].mem);
+			items[i].data = items[i].mem;
+			(*jenv)->DeleteLocalRef(jenv, b);
+		}
+
+		ret = $self->insert_batch($self, items, items + n, (size_t)n);
+
+err:		for (i = 0; i < 2 * n; i++)
+			__wt_free(NULL, items[i].mem);
+		__wt_free(NULL, items);
+		return (ret);
+	}
+
 	%javamethodmodifiers compare_wrap "protected";
 	int compare_wrap(JNIEnv *jenv, WT_CURSOR *other) {
 		int cmp, ret = $self->compare($self, other, &cmp);
@@ -1818,6 +1992,60 @@ WT_ASYNC_CALLBACK javaApiAsyncHandler = {javaAsyncHandler};
 		return ret;
 	}
 
+	/**
+	 * Retrieve up to \c count records following the current position in
+	 * the table.  Keys and values are returned in raw (packed) format,
+	 * alternating in the returned array; the array is empty when there
+	 * are no more records.
+	 *
+	 * \param count The maximum number of records to return.
+	 * \return The keys and values.
+	 */
+	public byte[][] nextBatch(int count)
+	throws WiredTigerException {
+		byte[][] ret = next_batch_wrap(count);
+		keyPacker.reset();
+		valuePacker.reset();
+		keyUnpacker = initKeyUnpacker(ret.length != 0);
+		valueUnpacker = initValueUnpacker(ret.length != 0);
+		return ret;
+	}
+
+	/**
+	 * Search for a batch of keys.  Keys and values are in raw (packed)
+	 * format.  The cursor is left unpositioned.
+	 *
+	 * \param keys The keys to search for.
+	 * \return The value for each key, or null if the key was not found.
+	 */
+	public byte[][] searchBatch(byte[][] keys)
+	throws WiredTigerException {
+		byte[][] ret = search_batch_wrap(keys);
+		keyPacker.reset();
+		valuePacker.reset();
+		keyUnpacker = initKeyUnpacker(false);
+		valueUnpacker = initValueUnpacker(false);
+		return ret;
+	}
+
+	/**
+	 * Insert a batch of records, sorted by key.  Keys and values are in
+	 * raw (packed) format.  The cursor is left unpositioned.
+	 *
+	 * \param keys The keys to insert.
+	 * \param values The value for each key.
+	 * \return The status of the operation.
+	 */
+	public int insertBatch(byte[][] keys, byte[][] values)
+	throws WiredTigerException {
+		int ret = insert_batch_wrap(keys, values);
+		keyPacker.reset();
+		valuePacker.reset();
+		keyUnpacker = initKeyUnpacker(false);
+		valueUnpacker = initValueUnpacker(false);
+		return ret;
+	}
+
 	/**
 	 * Retrieve the previous item in the table.
 	 *
@@ -528,6 +528,9 @@ COMPARE_NOTFOUND_OK(__wt_cursor::_search_near)
 %ignore __wt_cursor::set_key;
 %ignore __wt_cursor::set_value;
 %ignore __wt_cursor::modify(WT_CURSOR *, WT_MODIFY *, int);
+%ignore __wt_cursor::next_batch;
+%ignore __wt_cursor::search_batch;
+%ignore __wt_cursor::insert_batch;
 %rename (modify) __wt_cursor::_modify;
 %ignore __wt_modify::data;
 %ignore __wt_modify::offset;
@@ -565,6 +568,13 @@ OVERRIDE_METHOD(__wt_cursor, WT_CURSOR, search_near, (self))
 		$result = SWIG_FromCharPtr($1);
 }
 
+/* Handle lists returned by the batched cursor methods. */
+%typemap(in,numinputs=0) (PyObject **batchp) (PyObject *batch) {
+	batch = NULL;
+	$1 = &batch;
+}
+%typemap(argout) (PyObject **batchp) { $result = *$1; }
+
 %{
 typedef int int_void;
 %}
@@ -872,6 +882,150 @@ typedef int int_void;
 		return (self->modify(self, &list[1], count));
 	}
 
+	/*
+	 * next_batch: return a list of raw (key, value) string pairs, the list
+	 * is empty at the end of the object.
+	 */
+	int_void _next_batch(int count, PyObject **batchp) {
+		PyObject *pair;
+		WT_ITEM *keys, *values;
+		size_t i, n;
+		int ret;
+
+		if (count <= 0)
+			return (EINVAL);
+
+		keys = values = NULL;
+		if ((ret = __wt_calloc_def((WT_SESSION_IMPL *)$self->session,
+		    (size_t)count, &keys)) != 0 ||
+		    (ret = __wt_calloc_def((WT_SESSION_IMPL *)$self->session,
+		    (size_t)count, &values)) != 0)
+			goto err;
+
+		n = 0;
+		if ((ret = $self->next_batch(
+		    $self, keys, values, (size_t)count, &n)) == WT_NOTFOUND)
+			ret = 0;
+		if (ret == 0 && (*batchp = PyList_New((Py_ssize_t)n)) == NULL)
+			ret = ENOMEM;
+		for (i = 0; ret == 0 && i < n; i++) {
+			if ((pair = Py_BuildValue("(s#s#)",
+			    keys[i].data, (int)keys[i].size,
+			    values[i].data, (int)values[i].size)) == NULL)
+				ret = ENOMEM;
+			else
+				PyList_SET_ITEM(*batchp, (Py_ssize_t)i, pair);
+		}
+
+err:		if (ret != 0) {
+			Py_XDECREF(*batchp);
+			*batchp = NULL;
+		}
+		__wt_free((WT_SESSION_IMPL *)$self->session, keys);
+		__wt_free((WT_SESSION_IMPL *)$self->session, values);
+		return (ret);
+	}
+
+	/*
+	 * search_batch: given a list of raw keys, return a list of raw values,
+	 * None for keys that were not found.
+	 */
+	int_void _search_batch(PyObject *keylist, PyObject **batchp) {
+		PyObject *value;
+		WT_ITEM *keys, *values;
+		Py_ssize_t i, len, n;
+		int *results, ret;
+		char *data;
+
+		if (!PyList_Check(keylist))
+			return (EINVAL);
+		if ((n = PyList_Size(keylist)) == 0)
+			return ((*batchp = PyList_New(0)) == NULL ? ENOMEM : 0);
+
+		keys = values = NULL;
+		results = NULL;
+		if ((ret = __wt_calloc_def((WT_SESSION_IMPL *)$self->session,
+		    (size_t)n, &keys)) != 0 ||
+		    (ret = __wt_calloc_def((WT_SESSION_IMPL *)$self->session,
+		    (size_t)n, &values)) != 0 ||
+		    (ret = __wt_calloc_def((WT_SESSION_IMPL *)$self->session,
+		    (size_t)n, &results)) != 0)
+			goto err;
+
+		/* The keys are borrowed from the list for the duration. */
+		for (i = 0; i < n; i++) {
+			if (PyString_AsStringAndSize(PyList_GET_ITEM(keylist, i),
+			    &data, &len) != 0) {
+				ret = EINVAL;
+				goto err;
+			}
+			keys[i].data = data;
+			keys[i].size = (size_t)len;
+		}
+
+		if ((ret = $self->search_batch(
+		    $self, keys, values, results, (size_t)n)) != 0)
+			goto err;
+		if ((*batchp = PyList_New(n)) == NULL) {
+			ret = ENOMEM;
+			goto err;
+		}
+		for (i = 0; i < n; i++) {
+			if (results[i] != 0) {
+				Py_INCREF(Py_None);
+				value = Py_None;
+			} else if ((value = PyString_FromStringAndSize(
+			    values[i].data, (Py_ssize_t)values[i].size)) == NULL) {
+				ret = ENOMEM;
+				goto err;
+			}
+			PyList_SET_ITEM(*batchp, i, value);
+		}
+
+err:		if (ret != 0) {
+			Py_XDECREF(*batchp);
+			*batchp = NULL;
+		}
+		__wt_free((WT_SESSION_IMPL *)$self->session, keys);
+		__wt_free((WT_SESSION_IMPL *)$self->session, values);
+		__wt_free((WT_SESSION_IMPL *)$self->session, results);
+		return (ret);
+	}
+
+	int_void _insert_batch(PyObject *keylist, PyObject *valuelist) {
+		WT_ITEM *items;
+		Py_ssize_t i, len, n;
+		int ret;
+		char *data;
+
+		if (!PyList_Check(keylist) || !PyList_Check(valuelist) ||
+		    (n = PyList_Size(keylist)) != PyList_Size(valuelist))
+			return (EINVAL);
+		if (n == 0)
+			return (0);
+
+		if ((ret = __wt_calloc_def((WT_SESSION_IMPL *)$self->session,
+		    2 * (size_t)n, &items)) != 0)
+			return (ret);
+
+		/* The keys and values are borrowed from the lists. */
+		for (i = 0; i < 2 * n; i++) {
+			if (PyString_AsStringAndSize(PyList_GET_ITEM(
+			    i < n ? keylist : valuelist, i % n),
+			    &data, &len) != 0) {
+				ret = EINVAL;
+				goto err;
+			}
+			items[i].data = data;
+			items[i].size = (size_t)len;
+		}
+
+		ret = $self->insert_batch($self, items, items + n, (size_t)n);
+
+err:		__wt_free((WT_SESSION_IMPL *)$self->session, items);
+		return (ret);
+	}
+
 %pythoncode %{
 	def get_key(self):
 		'''get_key(self) -> object
@@ -941,6 +1095,66 @@ typedef int int_void;
 			self._value = pack(self.value_format, *args)
 			self._set_value(self._value)
 
+	def _batch_key(self, k):
+		if self.is_column:
+			return unpack('q', k)[0]
+		k = unpack(self.key_format, k)
+		if len(k) == 1:
+			return k[0]
+		return k
+
+	def _batch_value(self, v):
+		v = unpack(self.value_format, v)
+		if len(v) == 1:
+			return v[0]
+		return v
+
+	def next_batch(self, count):
+		'''next_batch(self, count) -> [(key, value), ...]
+		
+		@copydoc WT_CURSOR::next_batch
+		Returns a list of up to count (key, value) pairs, the list is
+		empty at the end of the object.'''
+		return [(self._batch_key(k), self._batch_value(v))
+		    for k, v in self._next_batch(count)]
+
+	def search_batch(self, keys):
+		'''search_batch(self, keys) -> [value, ...]
+		
+		@copydoc WT_CURSOR::search_batch
+		Returns a list of the value of each key, None for keys that were
+		not found.'''
+		packed = []
+		for k in keys:
+			if self.is_column:
+				packed.append(pack('q', long(k)))
+			elif type(k) == tuple:
+				packed.append(pack(self.key_format, *k))
+			else:
+				packed.append(pack(self.key_format, k))
+		return [None if v is None else self._batch_value(v)
+		    for v in self._search_batch(packed)]
+
+	def _batch_pack(self, format, item):
+		if type(item) == tuple:
+			return pack(format, *item)
+		return pack(format, item)
+
+	def insert_batch(self, records):
+		'''insert_batch(self, records) -> None
+		
+		@copydoc WT_CURSOR::insert_batch
+		Inserts a list of (key, value) pairs.'''
+		keys = []
+		values = []
+		for k, v in records:
+			if self.is_column:
+				keys.append(pack('q', long(k)))
+			else:
+				keys.append(self._batch_pack(self.key_format, k))
+			values.append(self._batch_pack(self.value_format, v))
+		self._insert_batch(keys, values)
+
 	def __iter__(self):
 		'''Cursor objects support iteration, equivalent to calling
 		WT_CURSOR::next until it returns ::WT_NOTFOUND.'''
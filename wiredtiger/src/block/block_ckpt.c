@@ -35,6 +35,8 @@ __wt_block_ckpt_init(
 	    session, &ci->discard, name, "discard", false));
 	WT_RET(__wt_block_extlist_init(
 	    session, &ci->ckpt_avail, name, "ckpt_avail", true));
+	WT_RET(__wt_block_extlist_init(
+	    session, &ci->avail_base, name, "avail_base", false));
 
 	return (0);
 }
@@ -99,6 +101,8 @@ __wt_block_checkpoint_load(WT_SESSION_IMPL *session, WT_BLOCK *block,
 #endif
 		ci = &block->live;
 		WT_ERR(__wt_block_ckpt_init(session, ci, "live"));
+		__wt_block_extlist_size_class(session, block, &ci->avail);
+		__wt_block_extlist_size_class(session, block, &ci->ckpt_avail);
 	}
 
 	/*
@@ -131,8 +135,8 @@ __wt_block_checkpoint_load(WT_SESSION_IMPL *session, WT_BLOCK *block,
 		 */
 		/*block Ӧļжȡavail skip listϢ,ci->avail.off/sizeжȡ,liveģʽ*/
 		if (!checkpoint)
-			WT_ERR(__wt_block_extlist_read_avail(
-			    session, block, &ci->avail, ci->file_size));
+			WT_ERR(__wt_block_extlist_read_avail(session,
+			    block, &ci->avail, &ci->avail_base, ci->file_size));
 	}
 
 	/*
@@ -213,6 +217,7 @@ __wt_block_ckpt_destroy(WT_SESSION_IMPL *session, WT_BLOCK_CKPT *ci)
 	__wt_block_extlist_free(session, &ci->ckpt_alloc);
 	__wt_block_extlist_free(session, &ci->ckpt_avail);
 	__wt_block_extlist_free(session, &ci->ckpt_discard);
+	__wt_block_extlist_free(session, &ci->avail_base);
 }
 
 /*
@@ -471,6 +476,7 @@ __ckpt_process(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_CKPT *ckptbase)
 	__wt_block_extlist_free(session, &ci->ckpt_avail);
 	WT_RET(__wt_block_extlist_init(
 	    session, &ci->ckpt_avail, "live", "ckpt_avail", true));
+	__wt_block_extlist_size_class(session, block, &ci->ckpt_avail);
 	__wt_block_extlist_free(session, &ci->ckpt_alloc);
 	__wt_block_extlist_free(session, &ci->ckpt_discard);
 
@@ -781,10 +787,13 @@ __ckpt_update(WT_SESSION_IMPL *session,
 	 * completes.  We can't merge that second list into the real list yet,
 	 * it's not truly available until the new checkpoint locations have been
 	 * saved to the metadata.
+	 *
+	 * The live system's avail list may be written as the changes to a base
+	 * list, see the extent list code for details.
 	 */
 	if (is_live)
-		WT_RET(__wt_block_extlist_write(
-		    session, block, &ci->avail, &ci->ckpt_avail));
+		WT_RET(__wt_block_extlist_write_avail(session,
+		    block, &ci->avail, &ci->ckpt_avail, &ci->avail_base));
 
 	/*
 	 * Set the file size for the live system.
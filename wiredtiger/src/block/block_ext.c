@@ -25,6 +25,8 @@ static int __block_ext_overlap(WT_SESSION_IMPL *,
 	WT_BLOCK *, WT_EXTLIST *, WT_EXT **, WT_EXTLIST *, WT_EXT **);
 static int __block_extlist_dump(
 	WT_SESSION_IMPL *, WT_BLOCK *, WT_EXTLIST *, const char *);
+static int __block_extlist_read(WT_SESSION_IMPL *,
+	WT_BLOCK *, WT_EXTLIST *, WT_EXTLIST *, wt_off_t, bool *);
 static int __block_merge(WT_SESSION_IMPL *,
 	WT_BLOCK *, WT_EXTLIST *, wt_off_t, wt_off_t);
 
@@ -130,6 +132,112 @@ __block_size_srch(WT_SIZE **head, wt_off_t size, WT_SIZE ***stack)
 			stack[i--] = szp--;
 }
 
+/*
+ * __block_size_class --
+ *	Return the size class of an extent size.
+ */
+static inline u_int
+__block_size_class(WT_EXTLIST *el, wt_off_t size)
+{
+	uint64_t units;
+	u_int c;
+
+	units = (uint64_t)size / el->class_size;
+	if (units <= WT_BLOCK_SIZE_CLASS_EXACT)
+		return (units == 0 ? 0 : (u_int)units - 1);
+
+	c = WT_BLOCK_SIZE_CLASS_EXACT;
+	for (units /= 2 * WT_BLOCK_SIZE_CLASS_EXACT; units > 0; units >>= 1)
+		++c;
+	return (WT_MIN(c, WT_BLOCK_SIZE_CLASSES - 1));
+}
+
+/*
+ * __block_class_next --
+ *	Return the first non-empty size class at or after a size class.
+ */
+static inline u_int
+__block_class_next(WT_EXTLIST *el, u_int c)
+{
+	uint64_t bits;
+
+	for (; c < WT_BLOCK_SIZE_CLASSES; c = (c | 63) + 1)
+		if ((bits = el->class_map[c / 64] >> (c % 64)) != 0) {
+			for (; (bits & 1) == 0; bits >>= 1)
+				++c;
+			return (c);
+		}
+	return (WT_BLOCK_SIZE_CLASSES);
+}
+
+/*
+ * __block_class_srch --
+ *	Search the size-class lists for an extent at least as large as the
+ * specified size.
+ */
+static inline WT_EXT *
+__block_class_srch(WT_EXTLIST *el, wt_off_t size)
+{
+	WT_EXT *ext;
+	u_int c, next;
+
+	/*
+	 * Every extent in one of the exact classes is the class' size, so the
+	 * first extent in the size's class is a best fit.  Larger sizes share
+	 * a class with smaller extents: take the first extent in the class if
+	 * it's large enough, else any extent in a larger class, and only walk
+	 * the class as a last resort.
+	 */
+	c = __block_size_class(el, size);
+	if ((ext = el->classes[c]) != NULL && ext->size >= size)
+		return (ext);
+	if ((next = __block_class_next(el, c + 1)) < WT_BLOCK_SIZE_CLASSES)
+		return (el->classes[next]);
+	for (; ext != NULL; ext = ext->class_next)
+		if (ext->size >= size)
+			return (ext);
+	return (NULL);
+}
+
+/*
+ * __block_class_insert --
+ *	Insert an extent into its size-class list.
+ */
+static inline void
+__block_class_insert(WT_EXTLIST *el, WT_EXT *ext)
+{
+	u_int c;
+
+	c = __block_size_class(el, ext->size);
+	ext->class_prev = NULL;
+	if ((ext->class_next = el->classes[c]) != NULL)
+		ext->class_next->class_prev = ext;
+	el->classes[c] = ext;
+	el->class_map[c / 64] |= (uint64_t)1 << (c % 64);
+}
+
+/*
+ * __block_class_remove --
+ *	Remove an extent from its size-class list.
+ */
+static inline void
+__block_class_remove(WT_SESSION_IMPL *session, WT_EXTLIST *el, WT_EXT *ext)
+{
+	u_int c;
+
+	c = __block_size_class(el, ext->size);
+	if (ext->class_next != NULL)
+		ext->class_next->class_prev = ext->class_prev;
+	if (ext->class_prev != NULL)
+		ext->class_prev->class_next = ext->class_next;
+	else {
+		WT_ASSERT(session, el->classes[c] == ext);
+		if ((el->classes[c] = ext->class_next) == NULL)
+			el->class_map[c / 64] &= ~((uint64_t)1 << (c % 64));
+	}
+	ext->class_next = ext->class_prev = NULL;
+}
+
 /*
  * __block_off_srch_pair --
  *	Search a by-offset skiplist for before/after records of the specified
@@ -183,7 +291,9 @@ __block_ext_insert(WT_SESSION_IMPL *session, WT_EXTLIST *el, WT_EXT *ext)
 	 * If we are inserting a new size onto the size skiplist, we'll need a
 	 * new WT_SIZE structure for that skiplist.
 	 */
-	if (el->track_size) {
+	if (el->track_size && el->class_size != 0)
+		__block_class_insert(el, ext);
+	else if (el->track_size) {
 		__block_size_srch(el->sz, ext->size, sstack);
 		szp = *sstack[0];
 		if (szp == NULL || szp->size != ext->size) {
@@ -207,7 +317,7 @@ __block_ext_insert(WT_SESSION_IMPL *session, WT_EXTLIST *el, WT_EXT *ext)
 		}
 	}
 #ifdef HAVE_DIAGNOSTIC
-	if (!el->track_size)
+	if (!el->track_size || el->class_size != 0)
 		for (i = 0; i < ext->depth; ++i)
 			ext->next[i + ext->depth] = NULL;
 #endif
@@ -341,7 +451,9 @@ __block_off_remove(WT_SESSION_IMPL *session, WT_BLOCK *block,
 	 * Find and remove the record from the size's offset skiplist; if that
 	 * empties the by-size skiplist entry, remove it as well.
 	 */
-	if (el->track_size) {
+	if (el->track_size && el->class_size != 0)
+		__block_class_remove(session, el, ext);
+	else if (el->track_size) {
 		__block_size_srch(el->sz, ext->size, sstack);
 		szp = *sstack[0];
 		if (szp == NULL || szp->size != ext->size)
@@ -360,7 +472,7 @@ __block_off_remove(WT_SESSION_IMPL *session, WT_BLOCK *block,
 		}
 	}
 #ifdef HAVE_DIAGNOSTIC
-	if (!el->track_size) {
+	if (!el->track_size || el->class_size != 0) {
 		bool not_null;
 		for (i = 0, not_null = false; i < ext->depth; ++i)
 			if (ext->next[i + ext->depth] != NULL)
@@ -533,6 +645,9 @@ __wt_block_alloc(
 	 * prefer best-fit over lower offset, but within a size we'll prefer an
 	 * offset appearing earlier in the file.
 	 *
+	 * If the avail list is tracking size classes, take an entry from the
+	 * smallest class that can satisfy the allocation.
+	 *
 	 * If we don't have anything big enough, extend the file.
 	 */ /*blockݳȻδﵽҪݿռĳȣblockӦļ,ʱݿռ*/
 	if (block->live.avail.bytes < (uint64_t)size)
@@ -542,6 +657,9 @@ __wt_block_alloc(
 		if (!__block_first_srch(block->live.avail.off, size, estack))
 			goto append;
 		ext = *estack[0];
+	} else if (block->live.avail.class_size != 0) {
+		if ((ext = __block_class_srch(&block->live.avail, size)) == NULL)
+			goto append;
 	} else {
 	    /*WT_SIZEܴsizeȵext*/
 		__block_size_srch(block->live.avail.sz, size, sstack);
@@ -945,9 +1063,11 @@ __wt_block_extlist_merge(WT_SESSION_IMPL *session, WT_BLOCK *block,
 	 * Sometimes the list we are merging is much bigger than the other: if
 	 * so, swap the lists around to reduce the amount of work we need to do
 	 * during the merge.  The size lists have to match as well, so this is
-	 * only possible if both lists are tracking sizes, or neither are.
+	 * only possible if both lists are tracking sizes the same way, or
+	 * neither are.
 	 */
-	if (a->track_size == b->track_size && a->entries > b->entries) {
+	if (a->track_size == b->track_size &&
+	    a->class_size == b->class_size && a->entries > b->entries) {
 		tmp = *a;
 		a->bytes = b->bytes;
 		b->bytes = tmp.bytes;
@@ -959,6 +1079,14 @@ __wt_block_extlist_merge(WT_SESSION_IMPL *session, WT_BLOCK *block,
 			a->sz[i] = b->sz[i];
 			b->sz[i] = tmp.sz[i];
 		}
+		for (i = 0; i < WT_BLOCK_SIZE_CLASSES; i++) {
+			a->classes[i] = b->classes[i];
+			b->classes[i] = tmp.classes[i];
+		}
+		for (i = 0; i < WT_BLOCK_SIZE_CLASSES / 64; i++) {
+			a->class_map[i] = b->class_map[i];
+			b->class_map[i] = tmp.class_map[i];
+		}
 	}
 
 	WT_EXT_FOREACH(ext, a->off)
@@ -1134,10 +1262,11 @@ __block_merge(WT_SESSION_IMPL *session, WT_BLOCK *block,
  *	Read an avail extent list, includes minor special handling.
  */
 int
-__wt_block_extlist_read_avail(WT_SESSION_IMPL *session,
-    WT_BLOCK *block, WT_EXTLIST *el, wt_off_t ckpt_size)
+__wt_block_extlist_read_avail(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    WT_EXTLIST *el, WT_EXTLIST *base, wt_off_t ckpt_size)
 {
 	WT_DECL_RET;
+	bool delta;
 
 	/* If there isn't a list, we're done. */
 	if (el->offset == WT_BLOCK_INVALID_OFFSET)
@@ -1153,7 +1282,8 @@ __wt_block_extlist_read_avail(WT_SESSION_IMPL *session,
 	__wt_spin_lock(session, &block->live_lock);
 #endif
 
-	WT_ERR(__wt_block_extlist_read(session, block, el, ckpt_size));
+	WT_ERR(__block_extlist_read(
+	    session, block, el, base, ckpt_size, &delta));
 
 	/*
 	 * Extent blocks are allocated from the available list: if reading the
@@ -1177,13 +1307,33 @@ err:
 int
 __wt_block_extlist_read(WT_SESSION_IMPL *session,
     WT_BLOCK *block, WT_EXTLIST *el, wt_off_t ckpt_size)
+{
+	bool delta;
+
+	return (__block_extlist_read(
+	    session, block, el, NULL, ckpt_size, &delta));
+}
+
+/*
+ * __block_extlist_read --
+ *	Read an extent list; if the list was written as changes to a base list
+ * and the caller wants the base list, read the base list and apply the
+ * changes, otherwise only check the changes.
+ */
+static int
+__block_extlist_read(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    WT_EXTLIST *el, WT_EXTLIST *base, wt_off_t ckpt_size, bool *deltap)
 {
 	WT_DECL_ITEM(tmp);
 	WT_DECL_RET;
+	WT_EXT *ext;
 	wt_off_t off, size;
 	int (*func)(
 	    WT_SESSION_IMPL *, WT_BLOCK *, WT_EXTLIST *, wt_off_t, wt_off_t);
 	const uint8_t *p;
+	bool base_delta, removing;
+
+	*deltap = false;
 
 	/* If there isn't a list, we're done. */
 	if (el->offset == WT_BLOCK_INVALID_OFFSET)
@@ -1202,8 +1352,10 @@ __wt_block_extlist_read(WT_SESSION_IMPL *session,
 	p = WT_BLOCK_HEADER_BYTE(tmp->mem);
 	WT_EXTLIST_READ(p, off);
 	WT_EXTLIST_READ(p, size);
-	if (off != WT_BLOCK_EXTLIST_MAGIC || size != 0)
+	if (off != WT_BLOCK_EXTLIST_MAGIC ||
+	    (size != 0 && size != WT_BLOCK_EXTLIST_DELTA))
 		goto corrupted;
+	removing = *deltap = size == WT_BLOCK_EXTLIST_DELTA;
 
 	/*
 	 * If we're not creating both offset and size skiplists, use the simpler
@@ -1216,11 +1368,40 @@ __wt_block_extlist_read(WT_SESSION_IMPL *session,
 	 * we reading the available-blocks list".
 	 */
 	func = el->track_size == 0 ? __block_append : __block_merge;
+
+	/*
+	 * A list of changes starts with the base list's address.  The base list
+	 * is a complete list; it may include ranges past the end of the file if
+	 * the file has since been truncated, the changes remove them.
+	 */
+	if (*deltap) {
+		WT_EXTLIST_READ(p, off);
+		WT_EXTLIST_READ(p, size);
+		if (base != NULL) {
+			base->offset = off;
+			base->size = (uint32_t)size;
+			WT_EXTLIST_READ(p, off);
+			base->checksum = (uint32_t)off;
+			WT_ERR(__block_extlist_read(session,
+			    block, base, NULL, INT64_MAX, &base_delta));
+			if (base_delta)
+				goto corrupted;
+			WT_EXT_FOREACH(ext, base->off)
+				WT_ERR(__block_merge(
+				    session, block, el, ext->off, ext->size));
+		} else
+			WT_EXTLIST_READ(p, off);
+	}
+
 	for (;;) {
 		WT_EXTLIST_READ(p, off);
 		WT_EXTLIST_READ(p, size);
-		if (off == WT_BLOCK_INVALID_OFFSET)
-			break;
+		if (off == WT_BLOCK_INVALID_OFFSET) {
+			if (!removing)
+				break;
+			removing = false;
+			continue;
+		}
 
 		/*
 		 * We check the offset/size pairs represent valid file ranges,
@@ -1232,7 +1413,7 @@ __wt_block_extlist_read(WT_SESSION_IMPL *session,
 		if (off < block->allocsize ||
 		    off % block->allocsize != 0 ||
 		    size % block->allocsize != 0 ||
-		    off + size > ckpt_size) {
+		    (!removing && off + size > ckpt_size)) {
 corrupted:		__wt_scr_free(session, &tmp);
 			WT_BLOCK_RET(session, block, WT_ERROR,
 			    "file contains a corrupted %s extent list, range %"
@@ -1241,7 +1422,20 @@ corrupted:		__wt_scr_free(session, &tmp);
 			    (intmax_t)off, (intmax_t)(off + size));
 		}
 
-		WT_ERR(func(session, block, el, off, size));
+		/*
+		 * Removed ranges are part of a single range on the base list.
+		 * If the caller doesn't want the base list, there's nothing to
+		 * apply the changes to.
+		 */
+		if (*deltap && base == NULL)
+			continue;
+		if (removing) {
+			if ((ret = __wt_block_off_remove_overlap(
+			    session, block, el, off, size)) == WT_NOTFOUND)
+				goto corrupted;
+			WT_ERR(ret);
+		} else
+			WT_ERR(func(session, block, el, off, size));
 	}
 
 	WT_ERR(__block_extlist_dump(session, block, el, "read"));
@@ -1250,6 +1444,52 @@ err:	__wt_scr_free(session, &tmp);
 	return (ret);
 }
 
+#define	WT_EXTLIST_WRITE(p, v)						\
+	WT_ERR(__wt_vpack_uint(&(p), 0, (uint64_t)(v)))
+
+/*
+ * __block_extlist_write_dsk --
+ *	Write a filled-in extent list page at the tail of the file.
+ */
+static int
+__block_extlist_write_dsk(WT_SESSION_IMPL *session,
+    WT_BLOCK *block, WT_EXTLIST *el, WT_ITEM *tmp, uint8_t *p)
+{
+	WT_DECL_RET;
+	WT_PAGE_HEADER *dsk;
+
+	dsk = tmp->mem;
+	dsk->u.datalen = WT_PTRDIFF32(p, WT_BLOCK_HEADER_BYTE(dsk));
+	tmp->size = dsk->mem_size = WT_PTRDIFF32(p, dsk);
+
+#ifdef HAVE_DIAGNOSTIC
+	/*
+	 * The extent list is written as a valid btree page because the salvage
+	 * functionality might move into the btree layer some day, besides, we
+	 * don't need another format and this way the page format can be easily
+	 * verified.
+	 */
+	WT_RET(__wt_verify_dsk(session, "[extent list check]", tmp));
+#endif
+
+	/* Write the extent list to disk. */
+	WT_RET(__wt_block_write_off(session, block,
+	    tmp, &el->offset, &el->size, &el->checksum, true, true, true));
+
+	/*
+	 * Remove the allocated blocks from the system's allocation list, extent
+	 * blocks never appear on any allocation list.
+	 */
+	WT_TRET(__wt_block_off_remove_overlap(
+	    session, block, &block->live.alloc, el->offset, el->size));
+
+	__wt_verbose(session, WT_VERB_BLOCK,
+	    "%s written %" PRIdMAX "/%" PRIu32,
+	    el->name, (intmax_t)el->offset, el->size);
+
+	return (ret);
+}
+
 /*
  * __wt_block_extlist_write --
  *	Write an extent list at the tail of the file.
@@ -1294,9 +1534,6 @@ __wt_block_extlist_write(WT_SESSION_IMPL *session,
 	memset(dsk, 0, WT_BLOCK_HEADER_BYTE_SIZE);
 	dsk->type = WT_PAGE_BLOCK_MANAGER;
 
-#define	WT_EXTLIST_WRITE(p, v)						\
-	WT_ERR(__wt_vpack_uint(&(p), 0, (uint64_t)(v)))
-
 	/* Fill the page's data. */
 	p = WT_BLOCK_HEADER_BYTE(dsk);
 	WT_EXTLIST_WRITE(p, WT_BLOCK_EXTLIST_MAGIC);	/* Initial value */
@@ -1313,38 +1550,219 @@ __wt_block_extlist_write(WT_SESSION_IMPL *session,
 	WT_EXTLIST_WRITE(p, WT_BLOCK_INVALID_OFFSET);	/* Ending value */
 	WT_EXTLIST_WRITE(p, 0);
 
-	dsk->u.datalen = WT_PTRDIFF32(p, WT_BLOCK_HEADER_BYTE(dsk));
-	tmp->size = dsk->mem_size = WT_PTRDIFF32(p, dsk);
+	ret = __block_extlist_write_dsk(session, block, el, tmp, p);
+
+err:	__wt_scr_free(session, &tmp);
+	return (ret);
+}
+
+/*
+ * __block_ext_next --
+ *	Return the next extent in offset order from a pair of lists.
+ */
+static inline WT_EXT *
+__block_ext_next(WT_EXT **ap, WT_EXT **bp)
+{
+	WT_EXT *ext;
+
+	if (*ap != NULL && (*bp == NULL || (*ap)->off < (*bp)->off)) {
+		ext = *ap;
+		*ap = ext->next[0];
+	} else if ((ext = *bp) != NULL)
+		*bp = ext->next[0];
+	return (ext);
+}
+
+/*
+ * __block_extlist_diff --
+ *	Write the ranges found on a pair of extent lists that aren't found on a
+ * second pair of extent lists, stopping if there are too many.
+ */
+static int
+__block_extlist_diff(WT_EXT *a, WT_EXT *a2,
+    WT_EXT *b, WT_EXT *b2, uint32_t max, uint8_t **pp, uint32_t *entriesp)
+{
+	WT_DECL_RET;
+	WT_EXT *ext, *sub;
+	wt_off_t end, start;
+	uint8_t *p;
+
+	p = *pp;
+
+#define	WT_EXTLIST_DIFF(off, size) do {					\
+	if (++*entriesp > max)						\
+		goto err;						\
+	WT_EXTLIST_WRITE(p, off);					\
+	WT_EXTLIST_WRITE(p, size);					\
+} while (0)
 
-#ifdef HAVE_DIAGNOSTIC
 	/*
-	 * The extent list is written as a valid btree page because the salvage
-	 * functionality might move into the btree layer some day, besides, we
-	 * don't need another format and this way the page format can be easily
-	 * verified.
+	 * Both pairs of lists are sorted and their ranges don't overlap, walk
+	 * the ranges in the first pair, skipping the parts covered by ranges
+	 * in the second pair.
 	 */
-	WT_ERR(__wt_verify_dsk(session, "[extent list check]", tmp));
-#endif
+	sub = __block_ext_next(&b, &b2);
+	while ((ext = __block_ext_next(&a, &a2)) != NULL)
+		for (start = ext->off, end = ext->off + ext->size;
+		    start < end; start = sub->off + sub->size) {
+			while (sub != NULL && sub->off + sub->size <= start)
+				sub = __block_ext_next(&b, &b2);
+			if (sub == NULL || sub->off >= end) {
+				WT_EXTLIST_DIFF(start, end - start);
+				break;
+			}
+			if (sub->off > start)
+				WT_EXTLIST_DIFF(start, sub->off - start);
+		}
 
-	/* Write the extent list to disk. */
-	WT_ERR(__wt_block_write_off(session, block,
-	    tmp, &el->offset, &el->size, &el->checksum, true, true, true));
+err:	*pp = p;
+	return (ret);
+}
+
+/*
+ * __block_extlist_write_delta --
+ *	Write the live system's avail list as the changes to the base list, if
+ * there aren't too many changes.
+ */
+static int
+__block_extlist_write_delta(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    WT_EXTLIST *el, WT_EXTLIST *additional, WT_EXTLIST *base,
+    bool force, bool *writtenp)
+{
+	WT_DECL_ITEM(tmp);
+	WT_DECL_RET;
+	WT_PAGE_HEADER *dsk;
+	size_t size;
+	uint32_t entries, max;
+	uint8_t *p;
+
+	*writtenp = false;
 
 	/*
-	 * Remove the allocated blocks from the system's allocation list, extent
-	 * blocks never appear on any allocation list.
+	 * If the changes are at least half the size of the list, it's time to
+	 * write a new base list; if we just wrote a new base list, the changes
+	 * can't be larger than both lists combined.
 	 */
-	WT_TRET(__wt_block_off_remove_overlap(
-	    session, block, &block->live.alloc, el->offset, el->size));
+	entries = el->entries + additional->entries;
+	max = force ? 2 * (entries + base->entries) : entries / 2;
 
-	__wt_verbose(session, WT_VERB_BLOCK,
-	    "%s written %" PRIdMAX "/%" PRIu32,
-	    el->name, (intmax_t)el->offset, el->size);
+	/*
+	 * Allocate memory for the changes plus the initial magic pair, the base
+	 * list's address and the two list-terminating pairs.
+	 */
+	size = ((size_t)max + 5) * 2 * WT_INTPACK64_MAXSIZE;
+	WT_RET(__wt_block_write_size(session, block, &size));
+	WT_RET(__wt_scr_alloc(session, size, &tmp));
+	dsk = tmp->mem;
+	memset(dsk, 0, WT_BLOCK_HEADER_BYTE_SIZE);
+	dsk->type = WT_PAGE_BLOCK_MANAGER;
+
+	p = WT_BLOCK_HEADER_BYTE(dsk);
+	WT_EXTLIST_WRITE(p, WT_BLOCK_EXTLIST_MAGIC);	/* Initial value */
+	WT_EXTLIST_WRITE(p, WT_BLOCK_EXTLIST_DELTA);
+	WT_EXTLIST_WRITE(p, base->offset);		/* Base list */
+	WT_EXTLIST_WRITE(p, base->size);
+	WT_EXTLIST_WRITE(p, base->checksum);
+
+	entries = 0;					/* Removed ranges */
+	WT_ERR(__block_extlist_diff(base->off[0], NULL,
+	    el->off[0], additional->off[0], max, &p, &entries));
+	if (entries > max)
+		goto err;
+	WT_EXTLIST_WRITE(p, WT_BLOCK_INVALID_OFFSET);
+	WT_EXTLIST_WRITE(p, 0);
+							/* Added ranges */
+	WT_ERR(__block_extlist_diff(el->off[0],
+	    additional->off[0], base->off[0], NULL, max, &p, &entries));
+	if (entries > max)
+		goto err;
+	WT_EXTLIST_WRITE(p, WT_BLOCK_INVALID_OFFSET);	/* Ending value */
+	WT_EXTLIST_WRITE(p, 0);
+
+	WT_ERR(__block_extlist_write_dsk(session, block, el, tmp, p));
+	*writtenp = true;
+
+	WT_STAT_DATA_INCR(session, block_avail_delta);
 
 err:	__wt_scr_free(session, &tmp);
 	return (ret);
 }
 
+/*
+ * __wt_block_extlist_write_avail --
+ *	Write the live system's avail list, possibly as the changes to a base
+ * list.
+ */
+int
+__wt_block_extlist_write_avail(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    WT_EXTLIST *el, WT_EXTLIST *additional, WT_EXTLIST *base)
+{
+	WT_EXT *ext;
+	size_t size;
+	bool written;
+
+	/*
+	 * Big avail lists are rewritten by every checkpoint, even though few
+	 * of their ranges change.  If configured, write the avail list as the
+	 * changes to a base list, that is, a complete list written by some
+	 * previous checkpoint and kept in memory.  Lists that fit into a single
+	 * allocation unit are always written in full, writing the changes
+	 * wouldn't write fewer blocks.
+	 */
+	size = ((size_t)el->entries + additional->entries + 2) *
+	    2 * WT_INTPACK64_MAXSIZE;
+
+	/*
+	 * Checkpoints aren't deleted during a hot backup, and the checkpoint
+	 * being copied may reference the base list through its changes, the
+	 * base list can't be freed until the backup completes.  Write the
+	 * changes whatever their size, the checkpoint being written references
+	 * the base list as well, it's freed by a later checkpoint.
+	 */
+	if (base->offset != WT_BLOCK_INVALID_OFFSET && S2C(session)->hot_backup)
+		return (__block_extlist_write_delta(
+		    session, block, el, additional, base, true, &written));
+
+	if (block->avail_delta && size > block->allocsize &&
+	    base->offset != WT_BLOCK_INVALID_OFFSET) {
+		WT_RET(__block_extlist_write_delta(
+		    session, block, el, additional, base, false, &written));
+		if (written)
+			return (0);
+	}
+
+	/*
+	 * We're writing a new base list or a complete list, free the blocks of
+	 * any previous base list.  Add them to the list of blocks available
+	 * when the checkpoint resolves, the last checkpoint references them.
+	 */
+	if (base->offset != WT_BLOCK_INVALID_OFFSET) {
+		WT_RET(__wt_block_insert_ext(session,
+		    block, additional, base->offset, (wt_off_t)base->size));
+		__wt_block_extlist_free(session, base);
+		WT_RET(__wt_block_extlist_init(
+		    session, base, "live", "avail_base", false));
+	}
+
+	if (!block->avail_delta || size <= block->allocsize)
+		return (__wt_block_extlist_write(
+		    session, block, el, additional));
+
+	/*
+	 * Copy the avail lists into a new base list and write it, then write
+	 * the changes since, at least the blocks used to write the base list.
+	 */
+	WT_EXT_FOREACH(ext, el->off)
+		WT_RET(__block_merge(session, block, base, ext->off, ext->size));
+	WT_EXT_FOREACH(ext, additional->off)
+		WT_RET(__block_merge(session, block, base, ext->off, ext->size));
+	WT_RET(__wt_block_extlist_write(session, block, base, NULL));
+	WT_STAT_DATA_INCR(session, block_avail_base);
+
+	return (__block_extlist_write_delta(
+	    session, block, el, additional, base, true, &written));
+}
+
 /*
  * __wt_block_extlist_truncate --
  *	Truncate the file based on the last available extent in the list.
@@ -1402,6 +1820,20 @@ __wt_block_extlist_init(WT_SESSION_IMPL *session,
 	return (0);
 }
 
+/*
+ * __wt_block_extlist_size_class --
+ *	Configure an empty avail list for size-class allocation.
+ */
+void
+__wt_block_extlist_size_class(
+    WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *el)
+{
+	WT_ASSERT(session, el->track_size && el->entries == 0);
+
+	if (block->allocclass)
+		el->class_size = block->allocsize;
+}
+
 /*
  * __wt_block_extlist_free --
  *	Discard an extent list.
@@ -195,6 +195,10 @@ __wt_block_open(WT_SESSION_IMPL *session,
     /*ȡãblock_allocationȷallocfirstĳʼֵ*/
 	WT_ERR(__wt_config_gets(session, cfg, "block_allocation", &cval));
 	block->allocfirst = WT_STRING_MATCH("first", cval.str, cval.len);
+	block->allocclass = WT_STRING_MATCH("size_class", cval.str, cval.len);
+
+	WT_ERR(__wt_config_gets(session, cfg, "block_avail_delta", &cval));
+	block->avail_delta = cval.val != 0;
 
 	/* Configuration: optional OS buffer cache maximum size. */
 	
@@ -159,7 +159,9 @@ int
 __wt_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
     WT_ITEM *buf, wt_off_t offset, uint32_t size, uint32_t checksum)
 {
+	struct timespec start;
 	WT_BLOCK_HEADER *blk, swap;
+	WT_DECL_RET;
 	size_t bufsize;
 	uint32_t page_checksum;
 
@@ -186,7 +188,17 @@ __wt_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
 		bufsize = WT_MAX(size, buf->memsize + 10);
 	}
 	WT_RET(__wt_buf_init(session, buf, bufsize));
-	WT_RET(__wt_read(session, block->fh, offset, size, buf->mem));
+
+	/* Schedule reads by application threads ahead of background writes. */
+	if (F_ISSET(session, WT_SESSION_INTERNAL))
+		WT_RET(__wt_read(session, block->fh, offset, size, buf->mem));
+	else {
+		__wt_block_sched_start(
+		    session, WT_IO_CLASS_READ, size, false, &start);
+		ret = __wt_read(session, block->fh, offset, size, buf->mem);
+		__wt_block_sched_end(session, WT_IO_CLASS_READ, &start);
+		WT_RET(ret);
+	}
 	buf->size = size;
 
 	/*
@@ -0,0 +1,183 @@
+/*-
+ * Copyright (c) 2014-2017 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * The block manager's I/O is synchronous, so scheduling is done by the threads
+ * issuing it: background writes wait for application reads in progress to
+ * drain, and checkpoint writes wait for the bytes they write to be available
+ * in a token bucket.
+ */
+
+/*
+ * Background writes wait at most this long for application reads to drain,
+ * so a steady stream of reads delays writes rather than starving them.
+ */
+#define	WT_BLOCK_SCHED_YIELD_MAX	1000	/* usecs */
+
+/*
+ * __wt_block_sched_config --
+ *	Configure the block manager I/O scheduler.
+ */
+int
+__wt_block_sched_config(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_BLOCK_SCHED *sched;
+	WT_CONFIG_ITEM cval;
+
+	sched = &S2C(session)->block_sched;
+
+	WT_RET(__wt_config_gets(session,
+	    cfg, "io_scheduler.read_priority", &cval));
+	sched->read_priority = cval.val != 0;
+
+	WT_RET(__wt_config_gets(session,
+	    cfg, "io_scheduler.checkpoint_rate", &cval));
+
+	/* Start with an empty bucket, it fills as time passes. */
+	__wt_spin_lock(session, &sched->ckpt_lock);
+	sched->ckpt_rate = (uint64_t)cval.val;
+	sched->ckpt_tokens = 0;
+	__wt_epoch(session, &sched->ckpt_refill);
+	__wt_spin_unlock(session, &sched->ckpt_lock);
+
+	return (0);
+}
+
+/*
+ * __block_sched_yield --
+ *	Wait for application reads in progress before a background write.
+ */
+static void
+__block_sched_yield(WT_SESSION_IMPL *session, WT_BLOCK_SCHED *sched)
+{
+	struct timespec start, stop;
+	uint64_t usecs;
+
+	if (sched->active[WT_IO_CLASS_READ] == 0)
+		return;
+
+	__wt_epoch(session, &start);
+	do {
+		__wt_sleep(0, 10);
+		__wt_epoch(session, &stop);
+		usecs = WT_TIMEDIFF_US(stop, start);
+	} while (sched->active[WT_IO_CLASS_READ] != 0 &&
+	    usecs < WT_BLOCK_SCHED_YIELD_MAX);
+
+	WT_STAT_CONN_INCR(session, block_sched_write_yield);
+	WT_STAT_CONN_INCRV(session, block_sched_write_yield_time, usecs);
+}
+
+/*
+ * __block_sched_throttle --
+ *	Take a checkpoint write's bytes from the token bucket, waiting for them
+ * if the bucket is empty.
+ */
+static void
+__block_sched_throttle(WT_SESSION_IMPL *session,
+    WT_BLOCK_SCHED *sched, size_t size, bool can_wait)
+{
+	struct timespec now;
+	uint64_t elapsed, rate, usecs;
+	int64_t tokens;
+
+	__wt_spin_lock(session, &sched->ckpt_lock);
+	if ((rate = sched->ckpt_rate) == 0) {
+		__wt_spin_unlock(session, &sched->ckpt_lock);
+		return;
+	}
+
+	/*
+	 * Refill the bucket for the time since the last write, it holds at
+	 * most a tenth of a second of writes.  Writes take their bytes even if
+	 * that empties the bucket, waiting until the debt has been repaid.
+	 */
+	__wt_epoch(session, &now);
+	elapsed = WT_MIN(WT_TIMEDIFF_US(now, sched->ckpt_refill), WT_MILLION);
+	sched->ckpt_refill = now;
+	tokens = sched->ckpt_tokens + (int64_t)(elapsed * rate / WT_MILLION);
+	tokens = WT_MIN(tokens, (int64_t)(rate / 10));
+	tokens -= (int64_t)size;
+	sched->ckpt_tokens = tokens;
+	__wt_spin_unlock(session, &sched->ckpt_lock);
+
+	/* Callers holding locks take the bytes but don't wait. */
+	if (tokens >= 0 || !can_wait)
+		return;
+
+	usecs = (uint64_t)-tokens * WT_MILLION / rate;
+	__wt_sleep(usecs / WT_MILLION, usecs % WT_MILLION);
+
+	WT_STAT_CONN_INCR(session, block_sched_checkpoint_throttle);
+	WT_STAT_CONN_INCRV(
+	    session, block_sched_checkpoint_throttle_time, usecs);
+}
+
+/*
+ * __wt_block_sched_start --
+ *	Schedule a block manager I/O request.
+ */
+void
+__wt_block_sched_start(WT_SESSION_IMPL *session,
+    u_int io_class, size_t size, bool can_wait, struct timespec *startp)
+{
+	WT_BLOCK_SCHED *sched;
+
+	sched = &S2C(session)->block_sched;
+
+	/*
+	 * Checkpoint writes and writes by internal threads are background
+	 * writes, application threads evicting pages aren't delayed.
+	 */
+	if (io_class == WT_IO_CLASS_CHECKPOINT)
+		__block_sched_throttle(session, sched, size, can_wait);
+	if (can_wait && sched->read_priority &&
+	    (io_class == WT_IO_CLASS_CHECKPOINT ||
+	    (io_class == WT_IO_CLASS_EVICT &&
+	    F_ISSET(session, WT_SESSION_INTERNAL))))
+		__block_sched_yield(session, sched);
+
+	(void)__wt_atomic_addv32(&sched->active[io_class], 1);
+	__wt_epoch(session, startp);
+}
+
+/*
+ * __wt_block_sched_end --
+ *	Complete a block manager I/O request.
+ */
+void
+__wt_block_sched_end(
+    WT_SESSION_IMPL *session, u_int io_class, struct timespec *startp)
+{
+	struct timespec stop;
+	WT_BLOCK_SCHED *sched;
+	uint64_t usecs;
+
+	sched = &S2C(session)->block_sched;
+
+	(void)__wt_atomic_subv32(&sched->active[io_class], 1);
+
+	__wt_epoch(session, &stop);
+	usecs = WT_TIMEDIFF_US(stop, *startp);
+	switch (io_class) {
+	case WT_IO_CLASS_READ:
+		WT_STAT_CONN_INCR(session, block_sched_read);
+		WT_STAT_CONN_INCRV(session, block_sched_read_time, usecs);
+		break;
+	case WT_IO_CLASS_EVICT:
+		WT_STAT_CONN_INCR(session, block_sched_evict);
+		WT_STAT_CONN_INCRV(session, block_sched_evict_time, usecs);
+		break;
+	case WT_IO_CLASS_CHECKPOINT:
+		WT_STAT_CONN_INCR(session, block_sched_checkpoint);
+		WT_STAT_CONN_INCRV(session, block_sched_checkpoint_time, usecs);
+		break;
+	}
+}
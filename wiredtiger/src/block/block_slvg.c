@@ -28,6 +28,8 @@ __wt_block_salvage_start(WT_SESSION_IMPL *session, WT_BLOCK *block)
 	 * rolling an empty file forward.
 	 */
 	WT_RET(__wt_block_ckpt_init(session, &block->live, "live"));
+	__wt_block_extlist_size_class(session, block, &block->live.avail);
+	__wt_block_extlist_size_class(session, block, &block->live.ckpt_avail);
 
 	/*
 	 * Truncate the file to an allocation-size multiple of blocks (bytes
@@ -136,7 +136,7 @@ __verify_last_avail(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_CKPT *ckpt)
 	el = &ci->avail;
 	if (el->offset != WT_BLOCK_INVALID_OFFSET) {
 		WT_ERR(__wt_block_extlist_read_avail(
-		    session, block, el, ci->file_size));
+		    session, block, el, &ci->avail_base, ci->file_size));
 		WT_EXT_FOREACH(ext, el->off)
 			if ((ret = __verify_filefrag_add(
 			    session, block, "avail-list chunk",
@@ -144,6 +144,15 @@ __verify_last_avail(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_CKPT *ckpt)
 				break;
 	}
 
+	/*
+	 * If the avail list was written as changes to a base list, the base
+	 * list's blocks belong to the live system rather than a checkpoint.
+	 */
+	el = &ci->avail_base;
+	if (ret == 0 && el->offset != WT_BLOCK_INVALID_OFFSET)
+		ret = __verify_filefrag_add(session, block,
+		    "avail list base", el->offset, (wt_off_t)el->size, true);
+
 err:	__wt_block_ckpt_destroy(session, ci);
 	return (ret);
 }
@@ -235,12 +235,14 @@ __block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
     WT_ITEM *buf, wt_off_t *offsetp, uint32_t *sizep, uint32_t *checksump,
     bool data_checksum, bool checkpoint_io, bool caller_locked)
 {
+	struct timespec start;
 	WT_BLOCK_HEADER *blk;
 	WT_DECL_RET;
 	WT_FH *fh;
 	wt_off_t offset;
 	size_t align_size;
 	uint32_t checksum;
+	u_int io_class;
 	bool local_locked;
 
 	*offsetp = 0;			/* -Werror=maybe-uninitialized */
@@ -344,9 +346,17 @@ __block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
 		__wt_spin_unlock(session, &block->live_lock);
 	WT_RET(ret);
 
-	/* Write the block. */
-	if ((ret = /*blockд*/
-	    __wt_write(session, fh, offset, align_size, buf->mem)) != 0) {
+	/*
+	 * Write the block. Callers holding the live lock can't wait for the
+	 * scheduler.
+	 */
+	io_class = checkpoint_io ? WT_IO_CLASS_CHECKPOINT : WT_IO_CLASS_EVICT;
+	__wt_block_sched_start(
+	    session, io_class, align_size, !caller_locked, &start);
+	/*blockд*/
+	ret = __wt_write(session, fh, offset, align_size, buf->mem);
+	__wt_block_sched_end(session, io_class, &start);
+	if (ret != 0) {
 		if (!caller_locked)
 			__wt_spin_lock(session, &block->live_lock);
 		/*ûдɹextӦݷظavail list*/
@@ -0,0 +1,396 @@
+/*-
+ * Copyright (c) 2014-2017 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Blind writes (inserts and removes with overwrite configured) don't need the
+ * existing value, so when the row-store leaf page they target isn't in the
+ * cache, the update can be held in a buffer hanging off the page's WT_REF
+ * instead of reading the page. The buffer is a skiplist of WT_INSERT/WT_UPDATE
+ * pairs, exactly like a page's insert lists, and the buffered update lists are
+ * linked into the page when it's next read, before the page becomes visible,
+ * so readers never have to look in the buffer.
+ *
+ * A page's buffer is only changed by the thread holding the WT_REF in the
+ * WT_REF_LOCKED state (writers), or the WT_REF_READING state (the merge). The
+ * parent page can't be evicted and the page can't be fast-deleted while it has
+ * a buffer. The buffer's memory is charged to the parent page: it stays in
+ * the cache as long as the parent does.
+ */
+
+/*
+ * __wt_change_buffer_lock --
+ *	Lock an on-disk leaf page's reference so a blind write can be buffered.
+ */
+bool
+__wt_change_buffer_lock(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+	WT_BTREE *btree;
+	size_t addr_size;
+	u_int type;
+	const uint8_t *addr;
+
+	btree = S2BT(session);
+
+	if (!__wt_atomic_casv32(&ref->state, WT_REF_DISK, WT_REF_LOCKED))
+		return (false);
+
+	/*
+	 * Internal pages have to be read to continue the descent. The address
+	 * can't change while the reference is locked.
+	 */
+	__wt_ref_info(ref, &addr, &addr_size, &type);
+	if (type == WT_CELL_ADDR_LEAF || type == WT_CELL_ADDR_LEAF_NO) {
+		if (btree->change_buffer_bytes < btree->change_buffer_max)
+			return (true);
+
+		WT_STAT_CONN_INCR(session, cache_change_buffer_skip_full);
+		WT_STAT_DATA_INCR(session, cache_change_buffer_skip_full);
+	}
+
+	WT_PUBLISH(ref->state, WT_REF_DISK);
+	return (false);
+}
+
+/*
+ * __wt_change_buffer_insert --
+ *	Buffer a blind write to the on-disk leaf page locked by the search, and
+ *	unlock the page.
+ */
+int
+__wt_change_buffer_insert(WT_SESSION_IMPL *session,
+    WT_CURSOR_BTREE *cbt, const WT_ITEM *value, u_int modify_type)
+{
+	WT_BTREE *btree;
+	WT_CHANGE_BUFFER *buf;
+	WT_DECL_RET;
+	WT_INSERT *ins, *new_ins;
+	WT_REF *ref;
+	WT_UPDATE *upd;
+	size_t ins_size, size, upd_size;
+	u_int i, skipdepth;
+	bool logged, new_buf;
+
+	btree = S2BT(session);
+	ref = cbt->buffer_ref;
+	cbt->buffer_ref = NULL;
+
+	new_ins = NULL;
+	upd = NULL;
+	ins_size = 0;
+	skipdepth = 0;
+	logged = new_buf = false;
+
+	WT_ASSERT(session, ref->state == WT_REF_LOCKED);
+
+	/*
+	 * Reading a page starts an auto-commit transaction, but the search may
+	 * not have read any page: start one if needed.
+	 */
+	WT_ERR(__wt_txn_autocommit_check(session));
+
+	/* Allocate the page's buffer the first time it's used. */
+	if ((buf = ref->page_buf) == NULL) {
+		WT_ERR(__wt_calloc_one(session, &buf));
+		buf->ref = ref;
+		new_buf = true;
+	}
+
+	/*
+	 * Search the buffer for the key: we're going to add an update to an
+	 * existing key or a new key, check for conflicts either way.
+	 */
+	WT_ERR(__wt_search_insert(session, cbt, &buf->ins_head, &cbt->iface.key));
+	ins = cbt->compare == 0 ? cbt->ins : NULL;
+	WT_ERR(__wt_txn_update_check(session, ins == NULL ? NULL : ins->upd));
+
+	/* Allocate a WT_UPDATE structure and transaction ID. */
+	WT_ERR(__wt_update_alloc(session, value, &upd, &upd_size, modify_type));
+	WT_ERR(__wt_txn_modify(session, upd));
+	logged = true;
+
+	if (ins == NULL) {
+		skipdepth = __wt_skip_choose_depth(session);
+		WT_ERR(__wt_row_insert_alloc(
+		    session, &cbt->iface.key, skipdepth, &new_ins, &ins_size));
+		ins = new_ins;
+	}
+
+	/*
+	 * Log the operation before linking the update, nothing can fail once
+	 * it's in the buffer. Logging takes the key from the cursor's insert.
+	 */
+	cbt->ins = ins;
+	WT_ERR(__wt_txn_log_op(session, cbt));
+
+	if (new_ins == NULL) {
+		upd->next = ins->upd;
+		WT_PUBLISH(ins->upd, upd);
+	} else {
+		ins->upd = upd;
+		for (i = 0; i < skipdepth; i++)
+			ins->next[i] = cbt->next_stack[i];
+		WT_WRITE_BARRIER();
+		for (i = 0; i < skipdepth; i++)
+			*cbt->ins_stack[i] = ins;
+	}
+
+	size = upd_size + ins_size + (new_buf ? sizeof(*buf) : 0);
+	buf->bytes += size;
+
+	__wt_spin_lock(session, &btree->change_buffer_lock);
+	if (new_buf) {
+		TAILQ_INSERT_TAIL(&btree->change_buffer_qh, buf, q);
+		++btree->change_buffer_pages;
+		ref->page_buf = buf;
+	}
+	btree->change_buffer_bytes += size;
+	__wt_spin_unlock(session, &btree->change_buffer_lock);
+
+	__wt_cache_page_inmem_incr(session, ref->home, size);
+
+	/*
+	 * The tree is modified, but there's no dirty page: checkpoint merges
+	 * the buffers into their pages before writing the tree.
+	 */
+	__wt_tree_modify_set(session);
+
+	WT_STAT_CONN_INCR(session, cache_change_buffer_write);
+	WT_STAT_DATA_INCR(session, cache_change_buffer_write);
+
+	if (0) {
+err:		/*
+		 * Remove the update from the current transaction, so we don't
+		 * try to modify it on rollback.
+		 */
+		if (logged)
+			__wt_txn_unmodify(session);
+		__wt_free(session, new_ins);
+		__wt_free(session, upd);
+		if (new_buf)
+			__wt_free(session, buf);
+	}
+
+	cbt->ins = NULL;
+	WT_PUBLISH(ref->state, WT_REF_DISK);
+	return (ret);
+}
+
+/*
+ * __change_buffer_remove --
+ *	Remove a page's buffer from the tree's list.
+ */
+static void
+__change_buffer_remove(WT_SESSION_IMPL *session, WT_CHANGE_BUFFER *buf)
+{
+	WT_BTREE *btree;
+
+	btree = S2BT(session);
+
+	__wt_spin_lock(session, &btree->change_buffer_lock);
+	TAILQ_REMOVE(&btree->change_buffer_qh, buf, q);
+	--btree->change_buffer_pages;
+	btree->change_buffer_bytes -= buf->bytes;
+	__wt_spin_unlock(session, &btree->change_buffer_lock);
+}
+
+/*
+ * __change_buffer_unlink --
+ *	Unlink the buffered update lists from a page that failed to merge them,
+ *	so discarding the page doesn't free them.
+ */
+static int
+__change_buffer_unlink(
+    WT_SESSION_IMPL *session, WT_REF *ref, WT_CHANGE_BUFFER *buf)
+{
+	WT_CURSOR_BTREE cbt;
+	WT_DECL_RET;
+	WT_INSERT *ins;
+	WT_ITEM key;
+	WT_UPDATE **updp;
+
+	if (ref->page->modify == NULL)
+		return (0);
+
+	__wt_btcur_init(session, &cbt);
+	__wt_btcur_open(&cbt);
+
+	/*
+	 * A failed merge can leave the page pointing at the first or the second
+	 * update in the list, check for either.
+	 */
+	WT_SKIP_FOREACH(ins, &buf->ins_head) {
+		key.data = WT_INSERT_KEY(ins);
+		key.size = WT_INSERT_KEY_SIZE(ins);
+		WT_ERR(__wt_row_search(session, &key, ref, &cbt, false, true));
+		if (cbt.compare != 0)
+			continue;
+		if (cbt.ins != NULL)
+			updp = &cbt.ins->upd;
+		else if (ref->page->modify->mod_row_update != NULL)
+			updp = &ref->page->modify->mod_row_update[cbt.slot];
+		else
+			continue;
+		if (*updp != NULL &&
+		    (*updp == ins->upd || *updp == ins->upd->next))
+			*updp = NULL;
+	}
+
+err:	WT_TRET(__wt_btcur_close(&cbt, true));
+	return (ret);
+}
+
+/*
+ * __wt_change_buffer_merge --
+ *	Merge the buffered writes into a page being read, before the page is
+ *	visible to other threads.
+ */
+int
+__wt_change_buffer_merge(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+	WT_CHANGE_BUFFER *buf;
+	WT_CURSOR_BTREE cbt;
+	WT_DECL_RET;
+	WT_INSERT *ins, *next;
+	WT_ITEM key;
+
+	WT_ASSERT(session, ref->state == WT_REF_READING);
+
+	buf = ref->page_buf;
+
+	__wt_btcur_init(session, &cbt);
+	__wt_btcur_open(&cbt);
+
+	/*
+	 * Search the page for each buffered key and link the key's update list
+	 * into the page, the same as restoring updates that couldn't be
+	 * evicted.
+	 */
+	WT_SKIP_FOREACH(ins, &buf->ins_head) {
+		key.data = WT_INSERT_KEY(ins);
+		key.size = WT_INSERT_KEY_SIZE(ins);
+		WT_ERR(__wt_row_search(session, &key, ref, &cbt, true, true));
+		WT_ERR(__wt_row_modify(session,
+		    &cbt, &key, NULL, ins->upd, WT_UPDATE_INVALID, false));
+	}
+
+	/*
+	 * The updates may be older than any transaction running now, make sure
+	 * the next checkpoint writes the page.
+	 */
+	ref->page->modify->first_dirty_txn = WT_TXN_FIRST;
+
+	WT_STAT_CONN_INCR(session, cache_change_buffer_merge);
+	WT_STAT_DATA_INCR(session, cache_change_buffer_merge);
+
+err:	WT_TRET(__wt_btcur_close(&cbt, true));
+
+	/*
+	 * The buffered updates belong to transactions and may already be part
+	 * of the page. If the merge fails, the page is discarded and the
+	 * updates stay in the buffer for the next read: unlink them from the
+	 * page first. If we can't, they're lost with the page.
+	 */
+	if (ret != 0) {
+		if (__change_buffer_unlink(session, ref, buf) != 0)
+			WT_PANIC_RET(session, ret,
+			    "change buffer merge failed, can't unlink the page");
+		return (ret);
+	}
+
+	ref->page_buf = NULL;
+	__change_buffer_remove(session, buf);
+	__wt_cache_page_inmem_decr(session, ref->home, buf->bytes);
+
+	for (ins = WT_SKIP_FIRST(&buf->ins_head); ins != NULL; ins = next) {
+		next = WT_SKIP_NEXT(ins);
+		__wt_free(session, ins);
+	}
+	__wt_free(session, buf);
+	return (0);
+}
+
+/*
+ * __wt_change_buffer_merge_all --
+ *	Merge a tree's buffered writes into their pages.
+ */
+int
+__wt_change_buffer_merge_all(WT_SESSION_IMPL *session)
+{
+	WT_BTREE *btree;
+	WT_CHANGE_BUFFER *buf;
+	WT_CURSOR_BTREE cbt;
+	WT_DECL_ITEM(key);
+	WT_DECL_RET;
+	WT_INSERT *ins;
+	WT_REF *ref;
+	uint32_t i, pages;
+
+	btree = S2BT(session);
+
+	if ((pages = btree->change_buffer_pages) == 0)
+		return (0);
+
+	WT_RET(__wt_scr_alloc(session, 0, &key));
+	__wt_btcur_init(session, &cbt);
+	__wt_btcur_open(&cbt);
+
+	/*
+	 * Pages are merged when they're read: search the tree for the first
+	 * key buffered for each page. Stop after the number of pages buffered
+	 * when we started, new writes can't keep us here.
+	 */
+	for (i = 0; i < pages; ++i) {
+		__wt_spin_lock(session, &btree->change_buffer_lock);
+		if ((buf = TAILQ_FIRST(&btree->change_buffer_qh)) != NULL) {
+			ins = WT_SKIP_FIRST(&buf->ins_head);
+			ret = __wt_buf_set(session, key,
+			    WT_INSERT_KEY(ins), WT_INSERT_KEY_SIZE(ins));
+		}
+		__wt_spin_unlock(session, &btree->change_buffer_lock);
+		WT_ERR(ret);
+		if (buf == NULL)
+			break;
+
+		WT_WITH_PAGE_INDEX(session,
+		    ret = __wt_row_search(session, key, NULL, &cbt, false, false));
+		ref = cbt.ref;
+		cbt.ref = NULL;
+		WT_TRET(__wt_page_release(session, ref, 0));
+		WT_ERR(ret);
+	}
+
+err:	WT_TRET(__wt_btcur_close(&cbt, true));
+	__wt_scr_free(session, &key);
+	return (ret);
+}
+
+/*
+ * __wt_change_buffer_free --
+ *	Discard a page's buffered writes, the tree is being discarded. The
+ *	parent page's memory footprint, including the buffer, is discarded
+ *	with the parent.
+ */
+void
+__wt_change_buffer_free(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+	WT_CHANGE_BUFFER *buf;
+	WT_INSERT *ins, *next;
+
+	buf = ref->page_buf;
+	ref->page_buf = NULL;
+	__change_buffer_remove(session, buf);
+
+	for (ins = WT_SKIP_FIRST(&buf->ins_head); ins != NULL; ins = next) {
+		next = WT_SKIP_NEXT(ins);
+		__wt_free_update_list(session, ins->upd);
+		__wt_free(session, ins);
+	}
+	__wt_free(session, buf);
+}
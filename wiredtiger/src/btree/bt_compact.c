@@ -194,6 +194,7 @@ __wt_compact(WT_SESSION_IMPL *session)
 		/* Rewrite the page: mark the page and tree dirty. */
 		WT_ERR(__wt_page_modify_init(session, ref->page));
 		__wt_page_modify_set(session, ref->page);
+		__wt_page_dirty_summary(session, ref);
 
 		session->compact_state = WT_COMPACT_SUCCESS;
 		WT_STAT_DATA_INCR(session, btree_compact_rewrite);
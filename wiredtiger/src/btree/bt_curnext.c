@@ -514,6 +514,10 @@ __wt_btcur_iterate_setup(WT_CURSOR_BTREE *cbt)
 	cbt->cip_saved = NULL;
 	cbt->rip_saved = NULL;
 
+	/* Restart sequential access detection for read-ahead. */
+	cbt->read_ahead_leaves = 0;
+	cbt->read_ahead_home = NULL;
+
 	/*
 	 * If we don't have a search page, then we're done, we're starting at
 	 * the beginning or end of the tree, not as a result of a search.
@@ -671,6 +675,10 @@ __wt_btcur_next(WT_CURSOR_BTREE *cbt, bool truncating)
         /*btree cursorתһpage*/
 		WT_ERR(__wt_tree_walk(session, &cbt->ref, flags));
 		WT_ERR_TEST(cbt->ref == NULL, WT_NOTFOUND);
+
+		/* Queue the following leaf pages for read-ahead. */
+		if (S2C(session)->read_ahead_pages != 0)
+			__wt_read_ahead_schedule(session, cbt, true);
 	}
 
 #ifdef HAVE_DIAGNOSTIC
@@ -613,6 +613,10 @@ __wt_btcur_prev(WT_CURSOR_BTREE *cbt, bool truncating)
 
 		WT_ERR(__wt_tree_walk(session, &cbt->ref, flags));
 		WT_ERR_TEST(cbt->ref == NULL, WT_NOTFOUND);
+
+		/* Queue the preceding leaf pages for read-ahead. */
+		if (S2C(session)->read_ahead_pages != 0)
+			__wt_read_ahead_schedule(session, cbt, false);
 	}
 #ifdef HAVE_DIAGNOSTIC
 	if (ret == 0)
@@ -357,6 +357,24 @@ __cursor_row_search(
 	return (ret);
 }
 
+/*
+ * __cursor_row_search_blind --
+ *	Row-store search for a blind write, the write can be buffered if the
+ *	leaf page isn't in the cache.
+ */
+static inline int
+__cursor_row_search_blind(
+    WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, bool insert)
+{
+	WT_DECL_RET;
+
+	if (cbt->btree->change_buffer_max != 0)
+		F_SET(cbt, WT_CBT_CHANGE_BUFFER);
+	ret = __cursor_row_search(session, cbt, NULL, insert);
+	F_CLR(cbt, WT_CBT_CHANGE_BUFFER);
+	return (ret);
+}
+
 /*
  * __cursor_col_modify_v --
  *	Column-store modify from a cursor, with a separate value.
@@ -427,12 +445,13 @@ __wt_btcur_reset(WT_CURSOR_BTREE *cbt)
 }
 
 /*
- * __wt_btcur_search --
- *	Search for a matching record in the tree.
+ * __btcur_search --
+ *	Search for a matching record in the tree, optionally as part of a batch
+ * of searches.
  */
 /* btreeнм¼ƥ */
-int
-__wt_btcur_search(WT_CURSOR_BTREE *cbt)
+static int
+__btcur_search(WT_CURSOR_BTREE *cbt, bool batch)
 {
 	WT_BTREE *btree;
 	WT_CURFILE_STATE state;
@@ -440,7 +459,7 @@ __wt_btcur_search(WT_CURSOR_BTREE *cbt)
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
 	WT_UPDATE *upd;
-	bool valid;
+	bool pinned_miss, valid;
 
 	btree = cbt->btree;
 	cursor = &cbt->iface;
@@ -469,7 +488,7 @@ __wt_btcur_search(WT_CURSOR_BTREE *cbt)
 	 * or the search of the pinned page doesn't find an exact match, search
 	 * from the root.
 	 */
-	valid = false;
+	pinned_miss = valid = false;
 	if (__cursor_page_pinned(cbt)) {
 		__wt_txn_cursor_op(session);
         /*м¼λ*/
@@ -477,8 +496,17 @@ __wt_btcur_search(WT_CURSOR_BTREE *cbt)
 		    __cursor_row_search(session, cbt, cbt->ref, false) :
 		    __cursor_col_search(session, cbt, cbt->ref));
 		valid = cbt->compare == 0 && __wt_cursor_valid(cbt, &upd);/*¼ҵˣvalue*/
+
+		/*
+		 * In a batch, a row-store key in the pinned leaf page's key
+		 * range but not found on the page isn't in the tree: keep the
+		 * page pinned for the next key rather than searching from the
+		 * root.
+		 */
+		pinned_miss = !valid &&
+		    batch && F_ISSET(cbt, WT_CBT_SEARCH_IN_RANGE);
 	}
-	if (!valid) {
+	if (!valid && !pinned_miss) {
 		WT_ERR(__cursor_func_init(cbt, true));
 		
         /*м¼λ*/
@@ -510,7 +538,12 @@ __wt_btcur_search(WT_CURSOR_BTREE *cbt)
 		WT_ERR(__wt_cursor_key_order_init(session, cbt));
 #endif
 
-err:	if (ret != 0) {
+	/*
+	 * In a batch, a key that isn't found leaves the cursor positioned on the
+	 * leaf page where the key would be, the next key is likely on the same
+	 * page.
+	 */
+err:	if (ret != 0 && (ret != WT_NOTFOUND || !batch)) {
 		WT_TRET(__cursor_reset(cbt));
 		__cursor_state_restore(cursor, &state);
 	}
@@ -522,6 +555,16 @@ err:	if (ret != 0) {
 	return (ret);
 }
 
+/*
+ * __wt_btcur_search --
+ *	Search for a matching record in the tree.
+ */
+int
+__wt_btcur_search(WT_CURSOR_BTREE *cbt)
+{
+	return (__btcur_search(cbt, false));
+}
+
 /*
  * __wt_btcur_search_near --
  *	Search for a record in the tree.
@@ -656,6 +699,197 @@ err:	if (ret == 0 && exactp != NULL)
 	return (ret);
 }
 
+/*
+ * __cursor_batch_copy --
+ *	Append a copy of an item to the cursor's batch buffer.  The buffer may
+ * be reallocated as it grows, so the returned item is set to the offset of
+ * the copy, and the caller converts offsets to pointers when it's done.
+ */
+static inline int
+__cursor_batch_copy(WT_SESSION_IMPL *session,
+    WT_CURSOR_BTREE *cbt, const void *data, size_t size, WT_ITEM *item)
+{
+	WT_ITEM *buf;
+
+	buf = &cbt->batch;
+	WT_RET(__wt_buf_extend(session, buf, buf->size + size));
+	if (size != 0)
+		memcpy((uint8_t *)buf->mem + buf->size, data, size);
+	item->data = (void *)(uintptr_t)buf->size;
+	item->size = size;
+	buf->size += size;
+	return (0);
+}
+
+/*
+ * __cursor_batch_ptr --
+ *	Convert a batch buffer offset to a pointer.
+ */
+static inline void
+__cursor_batch_ptr(WT_CURSOR_BTREE *cbt, WT_ITEM *item)
+{
+	item->data = (uint8_t *)cbt->batch.mem + (uintptr_t)item->data;
+}
+
+/*
+ * __cursor_batch_key --
+ *	Set the cursor's key from a raw batch key.
+ */
+static inline int
+__cursor_batch_key(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_ITEM *key)
+{
+	WT_CURSOR *cursor;
+
+	cursor = &cbt->iface;
+
+	F_CLR(cursor, WT_CURSTD_KEY_SET);
+	if (cbt->btree->type == BTREE_ROW) {
+		if (key->size == 0)
+			WT_RET_MSG(session, EINVAL, "Empty keys not permitted");
+		cursor->key.data = key->data;
+		cursor->key.size = key->size;
+	} else {
+		WT_RET(__wt_struct_unpack(
+		    session, key->data, key->size, "q", &cursor->recno));
+		if (cursor->recno == WT_RECNO_OOB)
+			WT_RET_MSG(session, EINVAL,
+			    "%d is an invalid record number", WT_RECNO_OOB);
+	}
+	F_SET(cursor, WT_CURSTD_KEY_EXT);
+	return (0);
+}
+
+/*
+ * __wt_btcur_next_batch --
+ *	Move to the next records in the tree, copying up to count key/value
+ * pairs into the cursor's batch buffer.
+ */
+int
+__wt_btcur_next_batch(WT_CURSOR_BTREE *cbt,
+    WT_ITEM *keys, WT_ITEM *values, size_t count, size_t *countp)
+{
+	WT_BTREE *btree;
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	size_t i, n, size;
+	uint64_t recno;
+	int exact;
+
+	btree = cbt->btree;
+	cursor = &cbt->iface;
+	session = (WT_SESSION_IMPL *)cursor->session;
+	recno = WT_RECNO_OOB;
+	*countp = 0;
+
+	WT_STAT_CONN_INCR(session, cursor_next_batch);
+	WT_STAT_DATA_INCR(session, cursor_next_batch);
+
+	WT_RET(__wt_buf_init(session, &cbt->batch, 0));
+
+	/*
+	 * Keys and values are returned in raw format: record numbers are
+	 * packed the way WT_CURSOR.get_key packs them for raw cursors.
+	 */
+	for (n = 0; n < count; ++n) {
+		if ((ret = __wt_btcur_next(cbt, false)) != 0)
+			break;
+		if (btree->type == BTREE_ROW)
+			WT_RET(__cursor_batch_copy(session, cbt,
+			    cursor->key.data, cursor->key.size, &keys[n]));
+		else {
+			recno = cursor->recno;
+			WT_RET(__wt_struct_size(session, &size, "q", recno));
+			WT_RET(__wt_struct_pack(session, cursor->raw_recno_buf,
+			    sizeof(cursor->raw_recno_buf), "q", recno));
+			WT_RET(__cursor_batch_copy(session, cbt,
+			    cursor->raw_recno_buf, size, &keys[n]));
+		}
+		WT_RET(__cursor_batch_copy(session, cbt,
+		    cursor->value.data, cursor->value.size, &values[n]));
+	}
+
+	/*
+	 * Moving past the end of the tree resets the cursor.  If we returned
+	 * records, position the cursor on the last of them, so the next call
+	 * reports the end of the tree instead of restarting the scan.
+	 */
+	if (ret == WT_NOTFOUND && n != 0) {
+		if (btree->type == BTREE_ROW) {
+			cursor->key.data =
+			    (uint8_t *)cbt->batch.mem +
+			    (uintptr_t)keys[n - 1].data;
+			cursor->key.size = keys[n - 1].size;
+		} else
+			cursor->recno = recno;
+		F_SET(cursor, WT_CURSTD_KEY_EXT);
+		WT_RET_NOTFOUND_OK(__wt_btcur_search_near(cbt, &exact));
+		ret = 0;
+	}
+	WT_RET(ret);
+
+	/* The buffer is no longer growing, convert offsets to pointers. */
+	for (i = 0; i < n; ++i) {
+		__cursor_batch_ptr(cbt, &keys[i]);
+		__cursor_batch_ptr(cbt, &values[i]);
+	}
+	*countp = n;
+	return (0);
+}
+
+/*
+ * __wt_btcur_search_batch --
+ *	Search for a set of records in the tree, copying the values found into
+ * the cursor's batch buffer.
+ */
+int
+__wt_btcur_search_batch(WT_CURSOR_BTREE *cbt,
+    WT_ITEM *keys, WT_ITEM *values, int *results, size_t count)
+{
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	size_t i;
+
+	cursor = &cbt->iface;
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	WT_STAT_CONN_INCR(session, cursor_search_batch);
+	WT_STAT_DATA_INCR(session, cursor_search_batch);
+
+	WT_RET(__wt_buf_init(session, &cbt->batch, 0));
+
+	/*
+	 * Each search leaves the cursor positioned on the leaf page where it
+	 * found the record, or where the record would be, and the next search
+	 * checks that leaf page before searching from the root of the tree:
+	 * sorted keys that are close together are found, or not found, without
+	 * releasing and re-acquiring the page.
+	 */
+	for (i = 0; i < count; ++i) {
+		WT_ERR(__cursor_batch_key(session, cbt, &keys[i]));
+		if ((ret = __btcur_search(cbt, true)) == 0)
+			WT_ERR(__cursor_batch_copy(session, cbt,
+			    cursor->value.data, cursor->value.size, &values[i]));
+		else if (ret == WT_NOTFOUND) {
+			values[i].data = NULL;
+			values[i].size = 0;
+		} else
+			goto err;
+		results[i] = ret;
+		ret = 0;
+	}
+
+	/* The buffer is no longer growing, convert offsets to pointers. */
+	for (i = 0; i < count; ++i)
+		if (results[i] == 0)
+			__cursor_batch_ptr(cbt, &values[i]);
+
+err:	F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+	WT_TRET(__cursor_reset(cbt));
+	return (ret);
+}
+
 /*
  * __wt_btcur_insert --
  *	Insert a record into the tree.
@@ -748,7 +982,17 @@ retry:	WT_ERR(__cursor_func_init(cbt, true));
 
 	if (btree->type == BTREE_ROW) {
 	    //
-		WT_ERR(__cursor_row_search(session, cbt, NULL, true));
+		WT_ERR(F_ISSET(cursor, WT_CURSTD_OVERWRITE) ?
+		    __cursor_row_search_blind(session, cbt, true) :
+		    __cursor_row_search(session, cbt, NULL, true));
+
+		/* An overwrite of an on-disk leaf page may be buffered. */
+		if (cbt->buffer_ref != NULL) {
+			ret = __wt_change_buffer_insert(
+			    session, cbt, &cursor->value, WT_UPDATE_STANDARD);
+			goto err;
+		}
+
 		/*
 		 * If not overwriting, fail if the key exists, else insert the
 		 * key/value pair.
@@ -805,6 +1049,176 @@ done:	/* Insert doesn't maintain a position across calls, clear resources. */
 	return (ret);
 }
 
+/*
+ * __cursor_batch_leaf_search --
+ *	Search the cursor's pinned leaf page for an insert, if the key is known
+ * to belong on the page.
+ */
+static int
+__cursor_batch_leaf_search(
+    WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, bool *foundp)
+{
+	WT_BTREE *btree;
+	WT_CURSOR *cursor;
+	WT_ITEM *item;
+	WT_PAGE *home;
+	WT_PAGE_INDEX *pindex;
+	WT_REF *ref;
+	uint32_t indx;
+	int cmp;
+	bool root;
+
+	btree = cbt->btree;
+	cursor = &cbt->iface;
+	item = cbt->tmp;
+	ref = cbt->ref;
+	*foundp = false;
+
+	/*
+	 * Unlike a search, an insert can't use the pinned page unless the key
+	 * is known to fall within the page's key range: confirm the parent's
+	 * slot and check both of the page's bounds.  A page on the edge of an
+	 * internal page other than the root may have a bound set further up
+	 * the tree, we search from the root in that case.
+	 */
+	home = ref->home;
+	root = home == btree->root.page;
+	WT_INTL_INDEX_GET(session, home, pindex);
+	indx = ref->pindex_hint;
+	if (indx >= pindex->entries || pindex->index[indx] != ref)
+		return (0);
+
+	/*
+	 * We can't compare against slot 0 on a row-store internal page because
+	 * reconciliation doesn't build it, it may not be a valid key.
+	 */
+	if (btree->type == BTREE_ROW) {
+		if (indx != 0) {
+			__wt_ref_key(home, ref, &item->data, &item->size);
+			WT_RET(__wt_compare(session,
+			    btree->collator, &cursor->key, item, &cmp));
+			if (cmp < 0)
+				return (0);
+		} else if (!root)
+			return (0);
+	} else if (cursor->recno < ref->ref_recno)
+		return (0);
+
+	if (++indx < pindex->entries) {
+		ref = pindex->index[indx];
+		if (btree->type == BTREE_ROW) {
+			__wt_ref_key(home, ref, &item->data, &item->size);
+			WT_RET(__wt_compare(session,
+			    btree->collator, &cursor->key, item, &cmp));
+			if (cmp >= 0)
+				return (0);
+		} else if (cursor->recno >= ref->ref_recno)
+			return (0);
+	} else if (!root)
+		return (0);
+
+	*foundp = true;
+	return (btree->type == BTREE_ROW ?
+	    __wt_row_search(session, &cursor->key, cbt->ref, cbt, true, true) :
+	    __wt_col_search(session, cursor->recno, cbt->ref, cbt, true));
+}
+
+/*
+ * __wt_btcur_insert_batch --
+ *	Insert a run of records into the tree, keeping the leaf page pinned
+ * between inserts.
+ */
+int
+__wt_btcur_insert_batch(
+    WT_CURSOR_BTREE *cbt, WT_ITEM *keys, WT_ITEM *values, size_t count)
+{
+	WT_BTREE *btree;
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	size_t i;
+	bool pinned;
+
+	btree = cbt->btree;
+	cursor = &cbt->iface;
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	WT_STAT_CONN_INCR(session, cursor_insert_batch);
+	WT_STAT_DATA_INCR(session, cursor_insert_batch);
+
+	/* It's no longer possible to bulk-load into the tree. */
+	__cursor_disable_bulk(session, btree);
+
+	for (i = 0; i < count; ++i) {
+		WT_ERR(__cursor_batch_key(session, cbt, &keys[i]));
+		cursor->value.data = values[i].data;
+		cursor->value.size = values[i].size;
+		F_SET(cursor, WT_CURSTD_VALUE_EXT);
+
+		if (btree->type == BTREE_ROW)
+			WT_ERR(__cursor_size_chk(session, &cursor->key));
+		WT_ERR(__cursor_size_chk(session, &cursor->value));
+		WT_STAT_DATA_INCRV(session,
+		    cursor_insert_bytes, cursor->key.size + cursor->value.size);
+
+		/*
+		 * Sorted keys usually belong on the leaf page the previous key
+		 * was inserted on: search that page without descending the
+		 * tree, where the insert list's append check extends the
+		 * previous insert's skiplist stack.  Search from the root if
+		 * the key is outside the page's range, or the page has grown
+		 * large enough that releasing it should split or evict it.
+		 */
+		pinned = false;
+		if (cbt->ref != NULL &&
+		    cbt->ref->page->memory_footprint < btree->maxmempage) {
+			WT_WITH_PAGE_INDEX(session, ret =
+			    __cursor_batch_leaf_search(session, cbt, &pinned));
+			WT_ERR(ret);
+		}
+		for (;;) {
+			if (!pinned) {
+				WT_ERR(__cursor_func_init(cbt, true));
+				WT_ERR(btree->type == BTREE_ROW ?
+				    __cursor_row_search(
+				    session, cbt, NULL, true) :
+				    __cursor_col_search(session, cbt, NULL));
+			}
+
+			/*
+			 * If not overwriting, fail if the key exists, including
+			 * records implicitly created in a fixed-length
+			 * column-store.
+			 */
+			if (!F_ISSET(cursor, WT_CURSTD_OVERWRITE) &&
+			    ((cbt->compare == 0 &&
+			    __wt_cursor_valid(cbt, NULL)) ||
+			    (cbt->compare != 0 &&
+			    __cursor_fix_implicit(btree, cbt))))
+				WT_ERR(WT_DUPLICATE_KEY);
+
+			ret = btree->type == BTREE_ROW ?
+			    __cursor_row_modify(
+			    session, cbt, WT_UPDATE_STANDARD) :
+			    __cursor_col_modify(
+			    session, cbt, WT_UPDATE_STANDARD);
+			if (ret != WT_RESTART)
+				break;
+			WT_STAT_CONN_INCR(session, cursor_restart);
+			WT_STAT_DATA_INCR(session, cursor_restart);
+			pinned = false;
+		}
+		WT_ERR(ret);
+		if (pinned)
+			WT_STAT_CONN_INCR(session, cursor_insert_batch_pinned);
+	}
+
+	/* Insert-batch doesn't maintain a position across calls. */
+err:	F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+	WT_TRET(__cursor_reset(cbt));
+	return (ret);
+}
+
 /*
  * __curfile_update_check --
  *	Check whether an update would conflict.
@@ -970,7 +1384,19 @@ __wt_btcur_remove(WT_CURSOR_BTREE *cbt)
 retry:	WT_ERR(__cursor_func_init(cbt, true));
 
 	if (btree->type == BTREE_ROW) {
-		WT_ERR(__cursor_row_search(session, cbt, NULL, false));
+		/*
+		 * A remove with overwrite configured doesn't care if the key
+		 * exists, unless the cursor has to stay positioned on it: the
+		 * remove of an on-disk leaf page's key may be buffered.
+		 */
+		WT_ERR(F_ISSET(cursor, WT_CURSTD_OVERWRITE) && !positioned ?
+		    __cursor_row_search_blind(session, cbt, false) :
+		    __cursor_row_search(session, cbt, NULL, false));
+		if (cbt->buffer_ref != NULL) {
+			ret = __wt_change_buffer_insert(
+			    session, cbt, NULL, WT_UPDATE_DELETED);
+			goto err;
+		}
 
 		/* Check whether an update would conflict. */
 		WT_ERR(__curfile_update_check(cbt));
@@ -1696,6 +2122,7 @@ __wt_btcur_close(WT_CURSOR_BTREE *cbt, bool lowlevel)
 
 	__wt_buf_free(session, &cbt->_row_key);
 	__wt_buf_free(session, &cbt->_tmp);
+	__wt_buf_free(session, &cbt->batch);
 #ifdef HAVE_DIAGNOSTIC
 	__wt_buf_free(session, &cbt->_lastkey);
 #endif
@@ -90,6 +90,13 @@ __wt_delete_page(WT_SESSION_IMPL *session, WT_REF *ref, bool *skipp)
 	    !__wt_atomic_casv32(&ref->state, WT_REF_DISK, WT_REF_LOCKED))
 		return (0);
 
+	/*
+	 * Pages with buffered writes have to be read, the buffered writes may
+	 * not be visible to the truncate.
+	 */
+	if (ref->page_buf != NULL)
+		goto err;
+
 	/*
 	 * We cannot fast-delete pages that have overflow key/value items as
 	 * the overflow blocks have to be discarded.  The way we figure that
@@ -299,8 +306,10 @@ __wt_delete_page_instantiate(WT_SESSION_IMPL *session, WT_REF *ref)
 	 * able to do so.)
 	 */
 	WT_RET(__wt_page_modify_init(session, page));
-	if (btree->modified)
+	if (btree->modified) {
 		__wt_page_modify_set(session, page);
+		__wt_page_dirty_summary(session, ref);
+	}
 
 	/*
 	 * An operation is accessing a "deleted" page, and we're building an
@@ -317,10 +317,12 @@ __wt_free_ref(
 	__wt_ref_addr_free(session, ref);
 
 	/*
-	 * Free any lookaside or page-deleted information.  We only expect a
-	 * lookaside structure for lookaside references, but can see
-	 * page-deleted information in other cases (such as WT_REF_MEM).
+	 * Free any buffered writes, lookaside or page-deleted information. We
+	 * only expect a lookaside structure for lookaside references, but can
+	 * see page-deleted information in other cases (such as WT_REF_MEM).
 	 */
+	if (ref->page_buf != NULL)
+		__wt_change_buffer_free(session, ref);
 	if (ref->state == WT_REF_LOOKASIDE)
 		__wt_free(session, ref->page_las);
 	else if (ref->page_del != NULL) {
@@ -386,6 +388,9 @@ __free_page_row_leaf(WT_SESSION_IMPL *session, WT_PAGE *page)
 		    page, copy, &ikey, NULL, NULL, NULL);
 		__wt_free(session, ikey);
 	}
+
+	/* Free the key hash index. */
+	__wt_free(session, page->pg_row_hash);
 }
 
 /*
@@ -45,6 +45,8 @@ __btree_clear(WT_SESSION_IMPL *session)
 	/* Destroy locks. */
 	__wt_rwlock_destroy(session, &btree->ovfl_lock);
 	__wt_spin_destroy(session, &btree->flush_lock);
+	__wt_spin_destroy(session, &btree->rec_max_lock);
+	__wt_spin_destroy(session, &btree->change_buffer_lock);
 
 	/* Free allocated memory. */
 	__wt_free(session, btree->key_format);
@@ -359,6 +361,10 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt)
 
 		WT_RET(__wt_config_gets(session, cfg, "key_gap", &cval));
 		btree->key_gap = (uint32_t)cval.val;
+
+		WT_RET(__wt_config_gets(
+		    session, cfg, "leaf_hash_search", &cval));
+		btree->leaf_hash_search = (uint32_t)cval.val;
 	}
 
 	/* Column-store: check for fixed-size data. */
@@ -404,6 +410,20 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt)
 	if (WT_IS_METADATA(btree->dhandle))
 		F_SET(btree, WT_BTREE_IGNORE_CACHE);
 
+	/*
+	 * Blind writes to on-disk row-store leaf pages can be buffered instead
+	 * of reading the page. There's nothing to gain for in-memory databases
+	 * and checkpoint handles can't be written. The metadata is always read
+	 * by the updates that change it.
+	 */
+	if (btree->type == BTREE_ROW && btree->dhandle->checkpoint == NULL &&
+	    !WT_IS_METADATA(btree->dhandle) &&
+	    !F_ISSET(conn, WT_CONN_IN_MEMORY | WT_CONN_READONLY)) {
+		WT_RET(__wt_config_gets(
+		    session, cfg, "change_buffer_max", &cval));
+		btree->change_buffer_max = (uint64_t)cval.val;
+	}
+
 	WT_RET(__wt_config_gets(session, cfg, "log.enabled", &cval));
 	if (cval.val)
 		F_CLR(btree, WT_BTREE_NO_LOGGING);
@@ -505,6 +525,11 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt)
 	/* Initialize locks. */
 	WT_RET(__wt_rwlock_init(session, &btree->ovfl_lock));
 	WT_RET(__wt_spin_init(session, &btree->flush_lock, "btree flush"));
+	WT_RET(__wt_spin_init(
+	    session, &btree->rec_max_lock, "btree reconcile maximum"));
+	WT_RET(__wt_spin_init(
+	    session, &btree->change_buffer_lock, "btree change buffer"));
+	TAILQ_INIT(&btree->change_buffer_qh);
 
 	btree->modified = false;			/* Clean */
 
@@ -512,6 +537,10 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt)
 	btree->write_gen = ckpt->write_gen;	/* Write generation */
 	btree->checkpoint_gen = __wt_gen(session, WT_GEN_CHECKPOINT);
 
+	/* No checkpoint has walked the tree, nothing can be skipped. */
+	btree->dirty_summary_gen = 1;
+	btree->dirty_summary_clean = 0;
+
 	return (0);
 }
 
@@ -692,6 +721,7 @@ __btree_tree_open_empty(WT_SESSION_IMPL *session, bool creation)
 		ref->state = WT_REF_MEM;
 		WT_ERR(__wt_page_modify_init(session, leaf));
 		__wt_page_only_modify_set(session, leaf);
+		__wt_page_dirty_summary(session, ref);
 	}
 
     //root pageinternal pageں__wt_root_ref_init
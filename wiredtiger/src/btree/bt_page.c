@@ -248,6 +248,13 @@ __wt_page_inmem(WT_SESSION_IMPL *session,
 			break;
 		}
 		ref->page = page;
+
+		/*
+		 * Internal pages referencing deleted pages are dirtied before
+		 * they're linked into the tree, update the dirty summaries.
+		 */
+		if (WT_PAGE_IS_INTERNAL(page) && __wt_page_is_modified(page))
+			__wt_page_dirty_summary(session, ref);
 	}
 
 	*pagep = page;
@@ -447,7 +454,7 @@ __inmem_row_int(WT_SESSION_IMPL *session, WT_PAGE *page, size_t *sizep)
 	WT_CELL_FOREACH(btree, dsk, cell, unpack, i) { //֮ǰд뵽̵internal pageڴ(ͨref->ref_ikeyָ)
 		ref = *refp;
 		ref->home = page;
-		ref->pindex_hint = hint++;
+		ref->pindex_hint = hint;
 
 		__wt_cell_unpack(cell, unpack);
 		switch (unpack->type) {
@@ -496,6 +503,7 @@ __inmem_row_int(WT_SESSION_IMPL *session, WT_PAGE *page, size_t *sizep)
 			ref->addr = cell;
 			ref->state = WT_REF_DELETED;
 			++refp;
+			++hint;
 
 			/*
 			 * If the tree is already dirty and so will be written,
@@ -514,6 +522,7 @@ __inmem_row_int(WT_SESSION_IMPL *session, WT_PAGE *page, size_t *sizep)
 		case WT_CELL_ADDR_LEAF_NO:
 			ref->addr = cell;
 			++refp;
+			++hint;
 			break;
 		WT_ILLEGAL_VALUE_ERR(session);
 		}
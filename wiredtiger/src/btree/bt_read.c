@@ -406,6 +406,9 @@ __page_read(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
 	WT_ERR(__wt_page_inmem(session, ref, tmp.data, page_flags, &page));
 	tmp.mem = NULL;
 
+	/* Pages read again soon after eviction start hot. */
+	__wt_evict_ghost_check(session, page, addr, addr_size);
+
 skip_read:
 	/*
 	 * If reading for a checkpoint, there's no additional work to do, the
@@ -444,6 +447,13 @@ skip_read:
 		    session, NULL, btree->id, ref->page_las->las_pageid));
 		__wt_free(session, ref->page_las);
 	}
+
+	/*
+	 * Merge blind writes buffered while the page was on disk, the page
+	 * can't be visible to other threads without them.
+	 */
+	if (ref->page_buf != NULL)
+		WT_ERR(__wt_change_buffer_merge(session, ref));
     /*pageڴ״̬Чҳ*/
 done:	WT_PUBLISH(ref->state, WT_REF_MEM);
 	return (ret);
@@ -726,8 +736,10 @@ skip_evict:		/*
 					page->read_gen = WT_READGEN_WONT_NEED;
 				else
 					__wt_cache_read_gen_new(session, page);
-			} else if (!LF_ISSET(WT_READ_NO_GEN))
+			} else if (!LF_ISSET(WT_READ_NO_GEN)) {
+				__wt_cache_read_gen_promote(session, page);
 				__wt_cache_read_gen_bump(session, page);
+			}
 
 			/*
 			 * Check if we need an autocommit transaction.
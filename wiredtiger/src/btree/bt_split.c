@@ -314,6 +314,23 @@ __split_ref_move(WT_SESSION_IMPL *session, WT_PAGE *from_home,
 			addr = NULL;
 	}
 
+	/*
+	 * Buffered writes are charged to the page holding the reference, move
+	 * the charge with the reference. Lock the reference so the buffer can't
+	 * be merged or freed while we look at it.
+	 */
+	while (ref->page_buf != NULL) {
+		if (__wt_atomic_casv32(
+		    &ref->state, WT_REF_DISK, WT_REF_LOCKED)) {
+			if (ref->page_buf != NULL)
+				WT_MEM_TRANSFER(
+				    *decrp, *incrp, ref->page_buf->bytes);
+			WT_PUBLISH(ref->state, WT_REF_DISK);
+			break;
+		}
+		__wt_yield();
+	}
+
 	/* And finally, copy the WT_REF pointer itself. */
 	*to_refp = ref;
 	WT_MEM_TRANSFER(*decrp, *incrp, sizeof(WT_REF));
@@ -46,6 +46,8 @@ __wt_btree_stat_init(WT_SESSION_IMPL *session, WT_CURSOR_STAT *cst)
 	    __wt_btree_dirty_inuse(session));
 	WT_STAT_SET(session, stats, cache_bytes_inuse,
 	    __wt_btree_bytes_inuse(session));
+	WT_STAT_SET(session, stats, cache_change_buffer_bytes,
+	    btree->change_buffer_bytes);
 
 	if (F_ISSET(cst, WT_STAT_TYPE_CACHE_WALK))
 		__wt_curstat_cache_walk(session);
@@ -110,6 +110,158 @@ __sync_dup_walk(
 	return (0);
 }
 
+/*
+ * __sync_checkpoint_progress --
+ *	Update checkpoint IO tracking data after writing a page.
+ */
+static void
+__sync_checkpoint_progress(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	session->ckpt_write_bytes += page->memory_footprint;
+
+	/*
+	 * Update checkpoint IO tracking data if configured to log verbose
+	 * progress messages. Checkpoint worker threads write pages
+	 * concurrently.
+	 */
+	if (conn->ckpt_timer_start.tv_sec > 0) {
+		(void)__wt_atomic_add64(
+		    &conn->ckpt_write_bytes, page->memory_footprint);
+
+		/* Periodically log checkpoint progress. */
+		if (__wt_atomic_add64(&conn->ckpt_write_pages, 1) % 5000 == 0)
+			__wt_checkpoint_progress(session, false);
+	}
+}
+
+/*
+ * __wt_sync_leaf_help --
+ *	Write a leaf page queued by a checkpoint tree walk, returning if there
+ * was a page to write.
+ */
+bool
+__wt_sync_leaf_help(WT_SESSION_IMPL *session)
+{
+	WT_CKPT_LEAF *leaf;
+	WT_CKPT_LEAVES *leaves;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_PAGE *page;
+	WT_TXN *txn;
+	bool ts_read;
+
+	conn = S2C(session);
+	txn = &session->txn;
+
+	if (TAILQ_EMPTY(&conn->ckpt_leaf_qh))
+		return (false);
+
+	__wt_spin_lock(session, &conn->ckpt_leaf_lock);
+	if ((leaf = TAILQ_FIRST(&conn->ckpt_leaf_qh)) != NULL)
+		TAILQ_REMOVE(&conn->ckpt_leaf_qh, leaf, q);
+	__wt_spin_unlock(session, &conn->ckpt_leaf_lock);
+	if (leaf == NULL)
+		return (false);
+
+	/*
+	 * Write the page with the read timestamp the tree walk is using:
+	 * trees that are immediately durable ignore the checkpoint's read
+	 * timestamp.
+	 */
+	leaves = leaf->leaves;
+	page = leaf->ref->page;
+	ts_read = F_ISSET(txn, WT_TXN_HAS_TS_READ);
+	if (!leaf->ts_read)
+		F_CLR(txn, WT_TXN_HAS_TS_READ);
+	WT_WITH_DHANDLE(session, leaf->dhandle, ret = __wt_reconcile(
+	    session, leaf->ref, NULL, WT_REC_CHECKPOINT, NULL));
+	if (ts_read)
+		F_SET(txn, WT_TXN_HAS_TS_READ);
+
+	if (ret == 0) {
+		__sync_checkpoint_progress(session, page);
+		WT_STAT_CONN_INCR(session, txn_checkpoint_leaf_parallel);
+	} else if (leaves->ret == 0)
+		leaves->ret = ret;
+
+	/*
+	 * The entry belongs to the thread walking the tree, it may be gone as
+	 * soon as the count of pending pages is decremented.
+	 */
+	(void)__wt_atomic_subv32(&leaves->pending, 1);
+	return (true);
+}
+
+/*
+ * __sync_leaf_queue --
+ *	Queue a dirty leaf page for the checkpoint worker threads to write.
+ */
+static int
+__sync_leaf_queue(WT_SESSION_IMPL *session,
+    WT_CKPT_LEAVES *leaves, WT_REF *walk, uint32_t flags)
+{
+	WT_CKPT_LEAF *leaf;
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	/*
+	 * Take a hazard pointer for the page, the tree walk moves on before
+	 * the page is written.
+	 */
+	leaf = &leaves->leaf[leaves->count];
+	leaf->ref = NULL;
+	WT_RET(__sync_dup_walk(session, walk, flags, &leaf->ref));
+	leaf->dhandle = session->dhandle;
+	leaf->leaves = leaves;
+	leaf->ts_read = F_ISSET(&session->txn, WT_TXN_HAS_TS_READ);
+	++leaves->count;
+	(void)__wt_atomic_addv32(&leaves->pending, 1);
+
+	__wt_spin_lock(session, &conn->ckpt_leaf_lock);
+	TAILQ_INSERT_TAIL(&conn->ckpt_leaf_qh, leaf, q);
+	__wt_spin_unlock(session, &conn->ckpt_leaf_lock);
+
+	__wt_cond_signal(session, conn->ckpt_workers.wait_cond);
+	return (0);
+}
+
+/*
+ * __sync_leaf_wait --
+ *	Wait for the leaf pages queued by a tree walk to be written, helping
+ * write queued pages in the meantime.
+ */
+static int
+__sync_leaf_wait(
+    WT_SESSION_IMPL *session, WT_CKPT_LEAVES *leaves, uint32_t flags)
+{
+	WT_DECL_RET;
+	u_int i;
+
+	while (leaves->pending != 0)
+		if (!__wt_sync_leaf_help(session))
+			__wt_yield();
+
+	/*
+	 * Pages still dirty after the checkpoint must be visited by the next
+	 * one, update the dirty summaries before releasing them.
+	 */
+	for (i = 0; i < leaves->count; ++i) {
+		if (__wt_page_is_modified(leaves->leaf[i].ref->page))
+			__wt_page_dirty_summary(session, leaves->leaf[i].ref);
+		WT_TRET(__wt_page_release(session, leaves->leaf[i].ref, flags));
+	}
+	leaves->count = 0;
+
+	WT_TRET(leaves->ret);
+	leaves->ret = 0;
+	return (ret);
+}
+
 /*
  * __sync_file --
  *	Flush pages for a specific file.
@@ -118,29 +270,34 @@ __sync_dup_walk(
  * flush pageʵ֣page̹̻,CHECKPOINT
  **********************************************************/
 static int
-__sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
+__sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop, uint64_t *budgetp)
 {
 	struct timespec end, start;
 	WT_BTREE *btree;
+	WT_CKPT_LEAVES leaves;
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
 	WT_PAGE *page;
 	WT_REF *prev, *walk;
 	WT_TXN *txn;
-	uint64_t internal_bytes, internal_pages, leaf_bytes, leaf_pages;
-	uint64_t oldest_id, saved_pinned_id;
+	uint64_t ckpt_gen, internal_bytes, internal_pages, leaf_bytes;
+	uint64_t leaf_pages, oldest_id, page_bytes, saved_pinned_id;
+	uint64_t walk_pages;
 	uint32_t flags;
-	bool timer, tried_eviction;
+	bool parallel, timer, tried_eviction;
 
 	conn = S2C(session);
 	btree = S2BT(session);
 	prev = walk = NULL;
 	txn = &session->txn;
-	tried_eviction = false;
+	parallel = tried_eviction = false;
+	leaves.count = 0;
+	leaves.pending = 0;
+	leaves.ret = 0;
 
 	flags = WT_READ_CACHE | WT_READ_NO_GEN;
 	internal_bytes = leaf_bytes = 0;
-	internal_pages = leaf_pages = 0;
+	internal_pages = leaf_pages = walk_pages = 0;
 	saved_pinned_id = WT_SESSION_TXN_STATE(session)->pinned_id;
 	timer = WT_VERBOSE_ISSET(session, WT_VERB_CHECKPOINT);
 	if (timer)
@@ -155,7 +312,7 @@ __sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
 		 * lock, serialize so multiple threads don't walk the tree at
 		 * the same time.
 		 */ /* пд̵ҳ,ֻˢleaf page */
-		if (!btree->modified)
+		if (!btree->modified || (budgetp != NULL && *budgetp == 0))
 			return (0);
 		__wt_spin_lock(session, &btree->flush_lock);
 		if (!btree->modified) {
@@ -193,10 +350,27 @@ __sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
 			    WT_TXNID_LT(page->modify->update_txn, oldest_id)) {
 				if (txn->isolation == WT_ISO_READ_COMMITTED)
 					__wt_txn_get_snapshot(session);
-				leaf_bytes += page->memory_footprint;
+				page_bytes = page->memory_footprint;
+				leaf_bytes += page_bytes;
 				++leaf_pages;
 				WT_ERR(__wt_reconcile(session,
 				    walk, NULL, WT_REC_CHECKPOINT, NULL));
+
+				/*
+				 * Paced writes stop once they have written
+				 * their budget of bytes.
+				 */
+				if (budgetp == NULL)
+					continue;
+				WT_STAT_CONN_INCR(
+				    session, txn_checkpoint_pace_pages);
+				WT_STAT_CONN_INCRV(session,
+				    txn_checkpoint_pace_bytes, page_bytes);
+				if (*budgetp <= page_bytes) {
+					*budgetp = 0;
+					break;
+				}
+				*budgetp -= page_bytes;
 			}
 		}
 		break;
@@ -246,6 +420,24 @@ __sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
 		/* Read pages with lookaside entries and evict them asap. */
 		LF_SET(WT_READ_LOOKASIDE | WT_READ_WONT_NEED);
 
+		/*
+		 * Skip subtrees with no pages dirtied since the last complete
+		 * checkpoint started. Start a new dirty summary generation:
+		 * pages dirtied from now on must be visited by the next
+		 * checkpoint, whether or not this walk sees them.
+		 */
+		LF_SET(WT_READ_SKIP_CLEAN);
+		ckpt_gen = btree->dirty_summary_gen;
+		(void)__wt_atomic_addv64(&btree->dirty_summary_gen, 1);
+
+		/*
+		 * If checkpoint worker threads are running, queue dirty leaf
+		 * pages for them to write; internal pages are written once
+		 * the queued pages are done, in tree walk order.
+		 */
+		parallel = WT_SESSION_IS_CHECKPOINT(session) &&
+		    conn->ckpt_work_session != NULL;
+
         /*ҳ*/
 		for (;;) {
 		    //walk->pagehazardָ
@@ -253,8 +445,14 @@ __sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
 			//ȡrefpǰһ(flagsWT_READ_PREV)ߺһڵ(flagsWT_READ_PREV) ĬϺһڵ
 			WT_ERR(__wt_tree_walk(session, &walk, flags)); //walkΪNULLһȡwalkΪroot
 
-			if (walk == NULL)
+			if (walk == NULL) {
+				if (parallel)
+					WT_ERR(__sync_leaf_wait(
+					    session, &leaves, flags));
+				btree->dirty_summary_clean = ckpt_gen;
 				break;
+			}
+			++walk_pages;
 
 			/* Skip clean pages. */
 			//ɾpageҲûݵpageд
@@ -279,6 +477,7 @@ __sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
 			 */
 			if (__sync_checkpoint_can_skip(session, page)) {
 				__wt_tree_modify_set(session);
+				__wt_page_dirty_summary(session, walk);
 				continue;
 			}
 
@@ -319,25 +518,29 @@ __sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
 			}
 			tried_eviction = false;
 
+			if (parallel) {
+				if (!WT_PAGE_IS_INTERNAL(page)) {
+					if (leaves.count == WT_CKPT_LEAF_MAX)
+						WT_ERR(__sync_leaf_wait(
+						    session, &leaves, flags));
+					WT_ERR(__sync_leaf_queue(
+					    session, &leaves, walk, flags));
+					continue;
+				}
+				WT_ERR(__sync_leaf_wait(
+				    session, &leaves, flags));
+			}
+
             //walk̴
 			WT_ERR(__wt_reconcile(
 			    session, walk, NULL, WT_REC_CHECKPOINT, NULL));
+			if (__wt_page_is_modified(page))
+				__wt_page_dirty_summary(session, walk);
 
-			/*
-			 * Update checkpoint IO tracking data if configured
-			 * to log verbose progress messages.
-			 */
-			if (conn->ckpt_timer_start.tv_sec > 0) {
-				conn->ckpt_write_bytes +=
-				    page->memory_footprint;
-				++conn->ckpt_write_pages;
-
-				/* Periodically log checkpoint progress. */
-				if (conn->ckpt_write_pages % 5000 == 0)
-					__wt_checkpoint_progress(
-					    session, false);
-			}
+			__sync_checkpoint_progress(session, page);
 		}
+		WT_STAT_CONN_INCRV(
+		    session, txn_checkpoint_walk_pages, walk_pages);
 		break;
 	case WT_SYNC_CLOSE:
 	case WT_SYNC_DISCARD:
@@ -357,7 +560,9 @@ __sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
 		    WT_TIMEDIFF_MS(end, start));
 	}
 
-err:	/* On error, clear any left-over tree walk. */
+err:	/* On error, wait for any queued pages, clear any left-over walk. */
+	if (leaves.count != 0)
+		WT_TRET(__sync_leaf_wait(session, &leaves, flags));
 	WT_TRET(__wt_page_release(session, walk, flags));
 	WT_TRET(__wt_page_release(session, prev, flags));
 
@@ -414,7 +619,7 @@ __wt_cache_op(WT_SESSION_IMPL *session, WT_CACHE_OP op)
 	switch (op) {
 	case WT_SYNC_CHECKPOINT:
 	case WT_SYNC_WRITE_LEAVES:
-		ret = __sync_file(session, op);
+		ret = __sync_file(session, op, NULL);
 		break;
 	case WT_SYNC_CLOSE:
 	case WT_SYNC_DISCARD:
@@ -423,3 +628,13 @@ __wt_cache_op(WT_SESSION_IMPL *session, WT_CACHE_OP op)
 	}
 	return (ret);
 }
+
+/*
+ * __wt_sync_file_pace --
+ *	Write dirty leaf pages of a file until a budget of bytes is written.
+ */
+int
+__wt_sync_file_pace(WT_SESSION_IMPL *session, uint64_t *budgetp)
+{
+	return (__sync_file(session, WT_SYNC_WRITE_LEAVES, budgetp));
+}
@@ -567,7 +567,10 @@ restart:	/*
 				 * new page. This works because we never acquire
 				 * a hazard pointer on a leaf page we're not
 				 * going to return to our caller, this will quit
-				 * working if that ever changes.
+				 * working if that ever changes. An internal
+				 * page skipped as clean is held but neither
+				 * descended nor returned: treated as a new page
+				 * it's skipped again and the walk moves past it.
 				 */
 				WT_ASSERT(session,
 				    couple == couple_orig ||
@@ -580,6 +583,24 @@ restart:	/*
 			WT_ERR(ret);
 			couple = ref;
 
+			/*
+			 * Optionally skip internal pages with no dirty pages
+			 * below them since the last complete checkpoint.  The
+			 * check needs the page, so it's made after acquiring a
+			 * hazard pointer, unlike the skips above.  Keep holding
+			 * it rather than releasing it: we must hold a page in
+			 * the parent's subtree while walking the parent's
+			 * index, and the swap to the next page releases it.
+			 */
+			if (LF_ISSET(WT_READ_SKIP_CLEAN) &&
+			    WT_PAGE_IS_INTERNAL(ref->page) &&
+			    ref->page->pg_intl_dirty_gen <
+			    btree->dirty_summary_clean) {
+				WT_STAT_CONN_INCR(
+				    session, txn_checkpoint_walk_skipped);
+				break;
+			}
+
 			/*
 			 * A new page: configure for traversal of any internal
 			 * page's children, else return the leaf page.
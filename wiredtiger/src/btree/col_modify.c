@@ -200,6 +200,9 @@ __wt_col_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt,
 			    &ins, ins_size, skipdepth, exclusive));
 	}
 
+	/* The page is dirty: update its ancestors' dirty summaries. */
+	__wt_page_dirty_summary(session, cbt->ref);
+
 	/* If the update was successful, add it to the in-memory log. */
 	if (logged && modify_type != WT_UPDATE_RESERVED)
 		WT_ERR(__wt_txn_log_op(session, cbt));
@@ -232,6 +232,9 @@ __wt_row_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt,
 		    &ins, ins_size, skipdepth, exclusive));
 	}
 
+	/* The page is dirty: update its ancestors' dirty summaries. */
+	__wt_page_dirty_summary(session, cbt->ref);
+
     //־¼,ڸú (__curtable_insert __curtable_update)->CURSOR_UPDATE_API_END(session, ret);д־ļ
 	if (logged && modify_type != WT_UPDATE_RESERVED)
 		WT_ERR(__wt_txn_log_op(session, cbt));
@@ -140,7 +140,8 @@ __wt_search_insert(WT_SESSION_IMPL *session,
 
 /*
  * __check_leaf_key_range --
- *	Check the search key is in the leaf page's key range.
+ *	Check the search key is in the leaf page's key range, and flag the
+ * cursor if it's known to be.
  */
 //
 static inline int
@@ -165,6 +166,7 @@ __check_leaf_key_range(WT_SESSION_IMPL *session,
 	 * page search if we know it's not going to work.
 	 */
 	cbt->compare = 0;
+	F_CLR(cbt, WT_CBT_SEARCH_IN_RANGE);
 
 	/*
 	 * First, confirm we have the right parent page-index slot, and quit if
@@ -207,11 +209,138 @@ __check_leaf_key_range(WT_SESSION_IMPL *session,
 			cbt->compare = -1;	/* page keys < search key */
 			return (0);
 		}
+
+		/*
+		 * The key is between the parent's keys for this page and the
+		 * next: if it's in the tree, it's on this page.
+		 */
+		if (indx != 1)
+			F_SET(cbt, WT_CBT_SEARCH_IN_RANGE);
 	}
 
 	return (0);
 }
 
+/*
+ * __row_leaf_hash_build --
+ *	Build a hash index over a row-store leaf page's keys.
+ */
+static int
+__row_leaf_hash_build(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_BTREE *btree;
+	WT_CELL *cell;
+	WT_CELL_UNPACK unpack;
+	WT_DECL_ITEM(key);
+	WT_DECL_RET;
+	WT_ROW *rip;
+	WT_ROW_HASH *hash;
+	size_t size;
+	uint32_t buckets, h, i, indx;
+	bool prev_key;
+	void *copy;
+
+	btree = S2BT(session);
+	hash = NULL;
+
+	/*
+	 * Size the table to a power-of-two at least twice the number of page
+	 * entries, keeping chains short and guaranteeing an empty bucket.
+	 */
+	for (buckets = 64; buckets < page->entries * 2; buckets <<= 1)
+		;
+	size = sizeof(WT_ROW_HASH) + buckets * sizeof(WT_ROW_HASH_BUCKET);
+	WT_RET(__wt_calloc(session, 1, size, &hash));
+	hash->mask = buckets - 1;
+
+	WT_ERR(__wt_scr_alloc(session, 0, &key));
+
+	/*
+	 * Walk the page's keys in order: as with a cursor walking the page, we
+	 * can build a prefix-compressed key from the previous key, avoiding the
+	 * cost of rolling forward from a fully instantiated key for each one.
+	 */
+	prev_key = false;
+	WT_ROW_FOREACH(page, rip, i) {
+		copy = WT_ROW_KEY_COPY(rip);
+		if (__wt_row_leaf_key_info(
+		    page, copy, NULL, &cell, &key->data, &key->size))
+			prev_key = false;
+		else {
+			__wt_cell_unpack(cell, &unpack);
+			if (btree->huffman_key == NULL &&
+			    unpack.type == WT_CELL_KEY && prev_key) {
+				WT_ASSERT(session, key->size >= unpack.prefix);
+				key->size = unpack.prefix;
+				WT_ERR(__wt_buf_grow(
+				    session, key, key->size + unpack.size));
+				memcpy((uint8_t *)key->data + key->size,
+				    unpack.data, unpack.size);
+				key->size += unpack.size;
+			} else
+				WT_ERR(__wt_row_leaf_key_work(
+				    session, page, rip, key, false));
+			prev_key = true;
+		}
+
+		h = (uint32_t)__wt_hash_city64(key->data, key->size);
+		for (indx = h & hash->mask; hash->bucket[indx].slot != 0;
+		    indx = (indx + 1) & hash->mask)
+			;
+		hash->bucket[indx].hash = h;
+		hash->bucket[indx].slot = WT_ROW_SLOT(page, rip) + 1;
+	}
+
+	/*
+	 * Publish the index: if we raced with another thread building it, use
+	 * theirs and discard ours.
+	 */
+	if (__wt_atomic_cas_ptr(&page->pg_row_hash, NULL, hash)) {
+		__wt_cache_page_inmem_incr(session, page, size);
+		WT_STAT_CONN_INCR(session, cursor_search_hash_build);
+		WT_STAT_DATA_INCR(session, cursor_search_hash_build);
+		hash = NULL;
+	}
+
+err:	__wt_scr_free(session, &key);
+	__wt_free(session, hash);
+	return (ret);
+}
+
+/*
+ * __row_leaf_hash_search --
+ *	Search a row-store leaf page's hash index for an exact match.
+ */
+static inline int
+__row_leaf_hash_search(WT_SESSION_IMPL *session, WT_PAGE *page,
+    WT_ROW_HASH *hash, WT_ITEM *srch_key, WT_ITEM *item, WT_ROW **ripp)
+{
+	WT_ROW *rip;
+	uint32_t h, indx, slot;
+
+	*ripp = NULL;
+
+	h = (uint32_t)__wt_hash_city64(srch_key->data, srch_key->size);
+	for (indx = h & hash->mask; (slot = hash->bucket[indx].slot) != 0;
+	    indx = (indx + 1) & hash->mask) {
+		if (hash->bucket[indx].hash != h)
+			continue;
+
+		/*
+		 * Build the key into the caller's buffer, on a match the cursor
+		 * returns it from there, the same as a binary-search match.
+		 */
+		rip = page->pg_row + (slot - 1);
+		WT_RET(__wt_row_leaf_key(session, page, rip, item, true));
+		if (srch_key->size == item->size &&
+		    memcmp(srch_key->data, item->data, item->size) == 0) {
+			*ripp = rip;
+			break;
+		}
+	}
+	return (0);
+}
+
 /*
  * __wt_row_search --
  *	Search a row-store tree for a specific key.
@@ -230,6 +359,7 @@ __wt_row_search(WT_SESSION_IMPL *session,
 	WT_PAGE_INDEX *pindex, *parent_pindex;
 	WT_REF *current, *descent;
 	WT_ROW *rip; //ҵkeyȷKVpage->pg_rowλ
+	WT_ROW_HASH *hash; //leaf pagekey hash
 	size_t match, skiphigh, skiplow;
 	uint32_t base, indx, limit;
 	int cmp, depth;
@@ -286,6 +416,11 @@ __wt_row_search(WT_SESSION_IMPL *session,
 			}
 		}
 
+		/*
+		 * The tree wasn't descended, don't update the cursor's append
+		 * history.
+		 */
+		descend_right = false;
 		current = leaf;
 		goto leaf_only;
 	}
@@ -474,6 +609,20 @@ append:			if (__wt_split_descent_race(
 		}
 
 descend:	/*
+		 * If the caller is doing a blind write, it can be buffered for
+		 * an on-disk leaf page instead of reading the page. Return the
+		 * current page as the cursor's page, the child's reference is
+		 * locked for the caller.
+		 */
+		if (F_ISSET(cbt, WT_CBT_CHANGE_BUFFER) &&
+		    descent->state == WT_REF_DISK &&
+		    __wt_change_buffer_lock(session, descent)) {
+			cbt->ref = current;
+			cbt->buffer_ref = descent;
+			return (0);
+		}
+
+		/*
 		 * Swap the current page for the child page. If the page splits
 		 * while we're retrieving it, restart the search at the root.
 		 * We cannot restart in the "current" page; for example, if a
@@ -551,6 +700,35 @@ leaf_only: //
 			return (0);
 	}
 
+	/*
+	 * If configured, probe the page's key hash index for an exact match
+	 * before the binary search, building the index once the page has been
+	 * searched enough times. The index hashes the key bytes, so it can't
+	 * be used with application-specified collation orders. Counting page
+	 * searches isn't serialized, it's only a heuristic.
+	 */
+	if (btree->leaf_hash_search != 0 &&
+	    collator == NULL && page->entries != 0) {
+		if ((hash = page->pg_row_hash) == NULL &&
+		    ++page->pg_row_hash_searches >= btree->leaf_hash_search) {
+			WT_ERR(__row_leaf_hash_build(session, page));
+			hash = page->pg_row_hash;
+		}
+		if (hash != NULL) {
+			WT_ERR(__row_leaf_hash_search(
+			    session, page, hash, srch_key, item, &rip));
+			if (rip != NULL) {
+				WT_STAT_CONN_INCR(
+				    session, cursor_search_hash_hit);
+				WT_STAT_DATA_INCR(
+				    session, cursor_search_hash_hit);
+				goto leaf_match;
+			}
+			WT_STAT_CONN_INCR(session, cursor_search_hash_miss);
+			WT_STAT_DATA_INCR(session, cursor_search_hash_miss);
+		}
+	}
+
 	/*
 	 * Binary search of an leaf page. There are three versions (keys with
 	 * no application-specified collation order, in long and short versions,
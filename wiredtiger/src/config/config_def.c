@@ -63,6 +63,8 @@ static const WT_CONFIG_CHECK
 static const WT_CONFIG_CHECK
     confchk_wiredtiger_open_checkpoint_subconfigs[] = {
 	{ "log_size", "int", NULL, "min=0,max=2GB", NULL, 0 },
+	{ "pace", "boolean", NULL, NULL, NULL, 0 },
+	{ "threads", "int", NULL, "min=1,max=20", NULL, 0 },
 	{ "wait", "int", NULL, "min=0,max=100000", NULL, 0 },
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
@@ -75,6 +77,9 @@ static const WT_CONFIG_CHECK
 
 static const WT_CONFIG_CHECK
     confchk_wiredtiger_open_eviction_subconfigs[] = {
+	{ "policy", "string",
+	    NULL, "choices=[\"lru\",\"scan_resistant\"]",
+	    NULL, 0 },
 	{ "threads_max", "int", NULL, "min=1,max=20", NULL, 0 },
 	{ "threads_min", "int", NULL, "min=1,max=20", NULL, 0 },
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
@@ -92,9 +97,19 @@ static const WT_CONFIG_CHECK
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
 
+static const WT_CONFIG_CHECK
+    confchk_wiredtiger_open_io_scheduler_subconfigs[] = {
+	{ "checkpoint_rate", "int", NULL, "min=0,max=100GB", NULL, 0 },
+	{ "read_priority", "boolean", NULL, NULL, NULL, 0 },
+	{ NULL, NULL, NULL, NULL, NULL, 0 }
+};
+
 static const WT_CONFIG_CHECK
     confchk_WT_CONNECTION_reconfigure_log_subconfigs[] = {
 	{ "archive", "boolean", NULL, NULL, NULL, 0 },
+	{ "group_commit_delay", "int",
+	    NULL, "min=0,max=100000",
+	    NULL, 0 },
 	{ "prealloc", "boolean", NULL, NULL, NULL, 0 },
 	{ "zero_fill", "boolean", NULL, NULL, NULL, 0 },
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
@@ -135,14 +150,14 @@ static const WT_CONFIG_CHECK confchk_WT_CONNECTION_reconfigure[] = {
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
 	{ "checkpoint", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_checkpoint_subconfigs, 2 },
+	    confchk_wiredtiger_open_checkpoint_subconfigs, 4 },
 	{ "compatibility", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_compatibility_subconfigs, 1 },
 	{ "error_prefix", "string", NULL, NULL, NULL, 0 },
 	{ "eviction", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_eviction_subconfigs, 2 },
+	    confchk_wiredtiger_open_eviction_subconfigs, 3 },
 	{ "eviction_checkpoint_target", "int",
 	    NULL, "min=0,max=99",
 	    NULL, 0 },
@@ -157,9 +172,12 @@ static const WT_CONFIG_CHECK confchk_WT_CONNECTION_reconfigure[] = {
 	{ "file_manager", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_file_manager_subconfigs, 3 },
+	{ "io_scheduler", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_io_scheduler_subconfigs, 2 },
 	{ "log", "category",
 	    NULL, NULL,
-	    confchk_WT_CONNECTION_reconfigure_log_subconfigs, 3 },
+	    confchk_WT_CONNECTION_reconfigure_log_subconfigs, 4 },
 	{ "lsm_manager", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_lsm_manager_subconfigs, 2 },
@@ -306,10 +324,14 @@ static const WT_CONFIG_CHECK confchk_WT_SESSION_create[] = {
 	    NULL, NULL,
 	    confchk_assert_subconfigs, 2 },
 	{ "block_allocation", "string",
-	    NULL, "choices=[\"first\",\"best\"]",
+	    NULL, "choices=[\"first\",\"best\",\"size_class\"]",
 	    NULL, 0 },
+	{ "block_avail_delta", "boolean", NULL, NULL, NULL, 0 },
 	{ "block_compressor", "string", NULL, NULL, NULL, 0 },
 	{ "cache_resident", "boolean", NULL, NULL, NULL, 0 },
+	{ "change_buffer_max", "int",
+	    NULL, "min=0,max=10TB",
+	    NULL, 0 },
 	{ "checksum", "string",
 	    NULL, "choices=[\"on\",\"off\",\"uncompressed\"]",
 	    NULL, 0 },
@@ -337,6 +359,7 @@ static const WT_CONFIG_CHECK confchk_WT_SESSION_create[] = {
 	    NULL, 0 },
 	{ "key_format", "format", __wt_struct_confchk, NULL, NULL, 0 },
 	{ "key_gap", "int", NULL, "min=0", NULL, 0 },
+	{ "leaf_hash_search", "int", NULL, "min=0", NULL, 0 },
 	{ "leaf_item_max", "int", NULL, "min=0", NULL, 0 },
 	{ "leaf_key_max", "int", NULL, "min=0", NULL, 0 },
 	{ "leaf_page_max", "int",
@@ -411,12 +434,14 @@ static const WT_CONFIG_CHECK confchk_WT_SESSION_open_cursor[] = {
 	{ "next_random_sample_size", "string", NULL, NULL, NULL, 0 },
 	{ "overwrite", "boolean", NULL, NULL, NULL, 0 },
 	{ "raw", "boolean", NULL, NULL, NULL, 0 },
+	{ "read_ahead", "boolean", NULL, NULL, NULL, 0 },
 	{ "readonly", "boolean", NULL, NULL, NULL, 0 },
 	{ "skip_sort_check", "boolean", NULL, NULL, NULL, 0 },
 	{ "statistics", "list",
 	    NULL, "choices=[\"all\",\"cache_walk\",\"fast\",\"clear\","
 	    "\"size\",\"tree_walk\"]",
 	    NULL, 0 },
+	{ "tail_wait", "int", NULL, "min=0,max=3600000", NULL, 0 },
 	{ "target", "list", NULL, NULL, NULL, 0 },
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
@@ -494,10 +519,14 @@ static const WT_CONFIG_CHECK confchk_file_config[] = {
 	    NULL, NULL,
 	    confchk_assert_subconfigs, 2 },
 	{ "block_allocation", "string",
-	    NULL, "choices=[\"first\",\"best\"]",
+	    NULL, "choices=[\"first\",\"best\",\"size_class\"]",
 	    NULL, 0 },
+	{ "block_avail_delta", "boolean", NULL, NULL, NULL, 0 },
 	{ "block_compressor", "string", NULL, NULL, NULL, 0 },
 	{ "cache_resident", "boolean", NULL, NULL, NULL, 0 },
+	{ "change_buffer_max", "int",
+	    NULL, "min=0,max=10TB",
+	    NULL, 0 },
 	{ "checksum", "string",
 	    NULL, "choices=[\"on\",\"off\",\"uncompressed\"]",
 	    NULL, 0 },
@@ -521,6 +550,7 @@ static const WT_CONFIG_CHECK confchk_file_config[] = {
 	    NULL, 0 },
 	{ "key_format", "format", __wt_struct_confchk, NULL, NULL, 0 },
 	{ "key_gap", "int", NULL, "min=0", NULL, 0 },
+	{ "leaf_hash_search", "int", NULL, "min=0", NULL, 0 },
 	{ "leaf_item_max", "int", NULL, "min=0", NULL, 0 },
 	{ "leaf_key_max", "int", NULL, "min=0", NULL, 0 },
 	{ "leaf_page_max", "int",
@@ -558,10 +588,14 @@ static const WT_CONFIG_CHECK confchk_file_meta[] = {
 	    NULL, NULL,
 	    confchk_assert_subconfigs, 2 },
 	{ "block_allocation", "string",
-	    NULL, "choices=[\"first\",\"best\"]",
+	    NULL, "choices=[\"first\",\"best\",\"size_class\"]",
 	    NULL, 0 },
+	{ "block_avail_delta", "boolean", NULL, NULL, NULL, 0 },
 	{ "block_compressor", "string", NULL, NULL, NULL, 0 },
 	{ "cache_resident", "boolean", NULL, NULL, NULL, 0 },
+	{ "change_buffer_max", "int",
+	    NULL, "min=0,max=10TB",
+	    NULL, 0 },
 	{ "checkpoint", "string", NULL, NULL, NULL, 0 },
 	{ "checkpoint_lsn", "string", NULL, NULL, NULL, 0 },
 	{ "checksum", "string",
@@ -588,6 +622,7 @@ static const WT_CONFIG_CHECK confchk_file_meta[] = {
 	    NULL, 0 },
 	{ "key_format", "format", __wt_struct_confchk, NULL, NULL, 0 },
 	{ "key_gap", "int", NULL, "min=0", NULL, 0 },
+	{ "leaf_hash_search", "int", NULL, "min=0", NULL, 0 },
 	{ "leaf_item_max", "int", NULL, "min=0", NULL, 0 },
 	{ "leaf_key_max", "int", NULL, "min=0", NULL, 0 },
 	{ "leaf_page_max", "int",
@@ -642,10 +677,14 @@ static const WT_CONFIG_CHECK confchk_lsm_meta[] = {
 	    NULL, NULL,
 	    confchk_assert_subconfigs, 2 },
 	{ "block_allocation", "string",
-	    NULL, "choices=[\"first\",\"best\"]",
+	    NULL, "choices=[\"first\",\"best\",\"size_class\"]",
 	    NULL, 0 },
+	{ "block_avail_delta", "boolean", NULL, NULL, NULL, 0 },
 	{ "block_compressor", "string", NULL, NULL, NULL, 0 },
 	{ "cache_resident", "boolean", NULL, NULL, NULL, 0 },
+	{ "change_buffer_max", "int",
+	    NULL, "min=0,max=10TB",
+	    NULL, 0 },
 	{ "checksum", "string",
 	    NULL, "choices=[\"on\",\"off\",\"uncompressed\"]",
 	    NULL, 0 },
@@ -671,6 +710,7 @@ static const WT_CONFIG_CHECK confchk_lsm_meta[] = {
 	{ "key_format", "format", __wt_struct_confchk, NULL, NULL, 0 },
 	{ "key_gap", "int", NULL, "min=0", NULL, 0 },
 	{ "last", "string", NULL, NULL, NULL, 0 },
+	{ "leaf_hash_search", "int", NULL, "min=0", NULL, 0 },
 	{ "leaf_item_max", "int", NULL, "min=0", NULL, 0 },
 	{ "leaf_key_max", "int", NULL, "min=0", NULL, 0 },
 	{ "leaf_page_max", "int",
@@ -720,21 +760,44 @@ static const WT_CONFIG_CHECK
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
 
+static const WT_CONFIG_CHECK
+    confchk_wiredtiger_open_eviction_queues_subconfigs[] = {
+	{ "numa", "boolean", NULL, NULL, NULL, 0 },
+	{ "shards", "int", NULL, "min=1,max=64", NULL, 0 },
+	{ NULL, NULL, NULL, NULL, NULL, 0 }
+};
+
 static const WT_CONFIG_CHECK
     confchk_wiredtiger_open_log_subconfigs[] = {
 	{ "archive", "boolean", NULL, NULL, NULL, 0 },
+	{ "compress_slots", "boolean", NULL, NULL, NULL, 0 },
 	{ "compressor", "string", NULL, NULL, NULL, 0 },
 	{ "enabled", "boolean", NULL, NULL, NULL, 0 },
 	{ "file_max", "int", NULL, "min=100KB,max=2GB", NULL, 0 },
+	{ "group_commit_delay", "int",
+	    NULL, "min=0,max=100000",
+	    NULL, 0 },
+	{ "io_uring", "boolean", NULL, NULL, NULL, 0 },
+	{ "join_groups", "int", NULL, "min=0,max=64", NULL, 0 },
 	{ "path", "string", NULL, NULL, NULL, 0 },
 	{ "prealloc", "boolean", NULL, NULL, NULL, 0 },
 	{ "recover", "string",
 	    NULL, "choices=[\"error\",\"on\"]",
 	    NULL, 0 },
+	{ "recover_threads", "int", NULL, "min=1,max=20", NULL, 0 },
+	{ "recycle", "boolean", NULL, NULL, NULL, 0 },
+	{ "streams", "int", NULL, "min=1,max=16", NULL, 0 },
 	{ "zero_fill", "boolean", NULL, NULL, NULL, 0 },
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
 
+static const WT_CONFIG_CHECK
+    confchk_wiredtiger_open_read_ahead_subconfigs[] = {
+	{ "pages", "int", NULL, "min=1,max=64", NULL, 0 },
+	{ "threads", "int", NULL, "min=0,max=20", NULL, 0 },
+	{ NULL, NULL, NULL, NULL, NULL, 0 }
+};
+
 static const WT_CONFIG_CHECK
     confchk_wiredtiger_open_statistics_log_subconfigs[] = {
 	{ "json", "boolean", NULL, NULL, NULL, 0 },
@@ -746,6 +809,14 @@ static const WT_CONFIG_CHECK
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
 
+static const WT_CONFIG_CHECK
+    confchk_wiredtiger_open_transaction_snapshot_subconfigs[] = {
+	{ "method", "string",
+	    NULL, "choices=[\"active\",\"scan\"]",
+	    NULL, 0 },
+	{ NULL, NULL, NULL, NULL, NULL, 0 }
+};
+
 static const WT_CONFIG_CHECK
     confchk_wiredtiger_open_transaction_sync_subconfigs[] = {
 	{ "enabled", "boolean", NULL, NULL, NULL, 0 },
@@ -765,7 +836,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
 	{ "checkpoint", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_checkpoint_subconfigs, 2 },
+	    confchk_wiredtiger_open_checkpoint_subconfigs, 4 },
 	{ "checkpoint_sync", "boolean", NULL, NULL, NULL, 0 },
 	{ "compatibility", "category",
 	    NULL, NULL,
@@ -781,7 +852,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "error_prefix", "string", NULL, NULL, NULL, 0 },
 	{ "eviction", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_eviction_subconfigs, 2 },
+	    confchk_wiredtiger_open_eviction_subconfigs, 3 },
 	{ "eviction_checkpoint_target", "int",
 	    NULL, "min=0,max=99",
 	    NULL, 0 },
@@ -791,6 +862,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "eviction_dirty_trigger", "int",
 	    NULL, "min=1,max=99",
 	    NULL, 0 },
+	{ "eviction_queues", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_eviction_queues_subconfigs, 2 },
 	{ "eviction_target", "int", NULL, "min=10,max=99", NULL, 0 },
 	{ "eviction_trigger", "int", NULL, "min=10,max=99", NULL, 0 },
 	{ "exclusive", "boolean", NULL, NULL, NULL, 0 },
@@ -803,15 +877,21 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	    confchk_wiredtiger_open_file_manager_subconfigs, 3 },
 	{ "hazard_max", "int", NULL, "min=15", NULL, 0 },
 	{ "in_memory", "boolean", NULL, NULL, NULL, 0 },
+	{ "io_scheduler", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_io_scheduler_subconfigs, 2 },
 	{ "log", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_log_subconfigs, 8 },
+	    confchk_wiredtiger_open_log_subconfigs, 15 },
 	{ "lsm_manager", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_lsm_manager_subconfigs, 2 },
 	{ "lsm_merge", "boolean", NULL, NULL, NULL, 0 },
 	{ "mmap", "boolean", NULL, NULL, NULL, 0 },
 	{ "multiprocess", "boolean", NULL, NULL, NULL, 0 },
+	{ "read_ahead", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_read_ahead_subconfigs, 2 },
 	{ "readonly", "boolean", NULL, NULL, NULL, 0 },
 	{ "session_max", "int", NULL, "min=1", NULL, 0 },
 	{ "session_scratch_max", "int", NULL, NULL, NULL, 0 },
@@ -829,6 +909,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	    NULL, "choices=[\"checkpoint_slow\",\"internal_page_split_race\""
 	    ",\"page_split_race\"]",
 	    NULL, 0 },
+	{ "transaction_snapshot", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_transaction_snapshot_subconfigs, 1 },
 	{ "transaction_sync", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_transaction_sync_subconfigs, 2 },
@@ -860,7 +943,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
 	{ "checkpoint", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_checkpoint_subconfigs, 2 },
+	    confchk_wiredtiger_open_checkpoint_subconfigs, 4 },
 	{ "checkpoint_sync", "boolean", NULL, NULL, NULL, 0 },
 	{ "compatibility", "category",
 	    NULL, NULL,
@@ -876,7 +959,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	{ "error_prefix", "string", NULL, NULL, NULL, 0 },
 	{ "eviction", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_eviction_subconfigs, 2 },
+	    confchk_wiredtiger_open_eviction_subconfigs, 3 },
 	{ "eviction_checkpoint_target", "int",
 	    NULL, "min=0,max=99",
 	    NULL, 0 },
@@ -886,6 +969,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	{ "eviction_dirty_trigger", "int",
 	    NULL, "min=1,max=99",
 	    NULL, 0 },
+	{ "eviction_queues", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_eviction_queues_subconfigs, 2 },
 	{ "eviction_target", "int", NULL, "min=10,max=99", NULL, 0 },
 	{ "eviction_trigger", "int", NULL, "min=10,max=99", NULL, 0 },
 	{ "exclusive", "boolean", NULL, NULL, NULL, 0 },
@@ -898,15 +984,21 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	    confchk_wiredtiger_open_file_manager_subconfigs, 3 },
 	{ "hazard_max", "int", NULL, "min=15", NULL, 0 },
 	{ "in_memory", "boolean", NULL, NULL, NULL, 0 },
+	{ "io_scheduler", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_io_scheduler_subconfigs, 2 },
 	{ "log", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_log_subconfigs, 8 },
+	    confchk_wiredtiger_open_log_subconfigs, 15 },
 	{ "lsm_manager", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_lsm_manager_subconfigs, 2 },
 	{ "lsm_merge", "boolean", NULL, NULL, NULL, 0 },
 	{ "mmap", "boolean", NULL, NULL, NULL, 0 },
 	{ "multiprocess", "boolean", NULL, NULL, NULL, 0 },
+	{ "read_ahead", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_read_ahead_subconfigs, 2 },
 	{ "readonly", "boolean", NULL, NULL, NULL, 0 },
 	{ "session_max", "int", NULL, "min=1", NULL, 0 },
 	{ "session_scratch_max", "int", NULL, NULL, NULL, 0 },
@@ -924,6 +1016,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	    NULL, "choices=[\"checkpoint_slow\",\"internal_page_split_race\""
 	    ",\"page_split_race\"]",
 	    NULL, 0 },
+	{ "transaction_snapshot", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_transaction_snapshot_subconfigs, 1 },
 	{ "transaction_sync", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_transaction_sync_subconfigs, 2 },
@@ -956,7 +1051,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
 	{ "checkpoint", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_checkpoint_subconfigs, 2 },
+	    confchk_wiredtiger_open_checkpoint_subconfigs, 4 },
 	{ "checkpoint_sync", "boolean", NULL, NULL, NULL, 0 },
 	{ "compatibility", "category",
 	    NULL, NULL,
@@ -970,7 +1065,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	{ "error_prefix", "string", NULL, NULL, NULL, 0 },
 	{ "eviction", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_eviction_subconfigs, 2 },
+	    confchk_wiredtiger_open_eviction_subconfigs, 3 },
 	{ "eviction_checkpoint_target", "int",
 	    NULL, "min=0,max=99",
 	    NULL, 0 },
@@ -980,6 +1075,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	{ "eviction_dirty_trigger", "int",
 	    NULL, "min=1,max=99",
 	    NULL, 0 },
+	{ "eviction_queues", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_eviction_queues_subconfigs, 2 },
 	{ "eviction_target", "int", NULL, "min=10,max=99", NULL, 0 },
 	{ "eviction_trigger", "int", NULL, "min=10,max=99", NULL, 0 },
 	{ "extensions", "list", NULL, NULL, NULL, 0 },
@@ -990,15 +1088,21 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	    NULL, NULL,
 	    confchk_wiredtiger_open_file_manager_subconfigs, 3 },
 	{ "hazard_max", "int", NULL, "min=15", NULL, 0 },
+	{ "io_scheduler", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_io_scheduler_subconfigs, 2 },
 	{ "log", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_log_subconfigs, 8 },
+	    confchk_wiredtiger_open_log_subconfigs, 15 },
 	{ "lsm_manager", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_lsm_manager_subconfigs, 2 },
 	{ "lsm_merge", "boolean", NULL, NULL, NULL, 0 },
 	{ "mmap", "boolean", NULL, NULL, NULL, 0 },
 	{ "multiprocess", "boolean", NULL, NULL, NULL, 0 },
+	{ "read_ahead", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_read_ahead_subconfigs, 2 },
 	{ "readonly", "boolean", NULL, NULL, NULL, 0 },
 	{ "session_max", "int", NULL, "min=1", NULL, 0 },
 	{ "session_scratch_max", "int", NULL, NULL, NULL, 0 },
@@ -1016,6 +1120,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	    NULL, "choices=[\"checkpoint_slow\",\"internal_page_split_race\""
 	    ",\"page_split_race\"]",
 	    NULL, 0 },
+	{ "transaction_snapshot", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_transaction_snapshot_subconfigs, 1 },
 	{ "transaction_sync", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_transaction_sync_subconfigs, 2 },
@@ -1046,7 +1153,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
 	{ "checkpoint", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_checkpoint_subconfigs, 2 },
+	    confchk_wiredtiger_open_checkpoint_subconfigs, 4 },
 	{ "checkpoint_sync", "boolean", NULL, NULL, NULL, 0 },
 	{ "compatibility", "category",
 	    NULL, NULL,
@@ -1060,7 +1167,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	{ "error_prefix", "string", NULL, NULL, NULL, 0 },
 	{ "eviction", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_eviction_subconfigs, 2 },
+	    confchk_wiredtiger_open_eviction_subconfigs, 3 },
 	{ "eviction_checkpoint_target", "int",
 	    NULL, "min=0,max=99",
 	    NULL, 0 },
@@ -1070,6 +1177,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	{ "eviction_dirty_trigger", "int",
 	    NULL, "min=1,max=99",
 	    NULL, 0 },
+	{ "eviction_queues", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_eviction_queues_subconfigs, 2 },
 	{ "eviction_target", "int", NULL, "min=10,max=99", NULL, 0 },
 	{ "eviction_trigger", "int", NULL, "min=10,max=99", NULL, 0 },
 	{ "extensions", "list", NULL, NULL, NULL, 0 },
@@ -1080,15 +1190,21 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	    NULL, NULL,
 	    confchk_wiredtiger_open_file_manager_subconfigs, 3 },
 	{ "hazard_max", "int", NULL, "min=15", NULL, 0 },
+	{ "io_scheduler", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_io_scheduler_subconfigs, 2 },
 	{ "log", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_log_subconfigs, 8 },
+	    confchk_wiredtiger_open_log_subconfigs, 15 },
 	{ "lsm_manager", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_lsm_manager_subconfigs, 2 },
 	{ "lsm_merge", "boolean", NULL, NULL, NULL, 0 },
 	{ "mmap", "boolean", NULL, NULL, NULL, 0 },
 	{ "multiprocess", "boolean", NULL, NULL, NULL, 0 },
+	{ "read_ahead", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_read_ahead_subconfigs, 2 },
 	{ "readonly", "boolean", NULL, NULL, NULL, 0 },
 	{ "session_max", "int", NULL, "min=1", NULL, 0 },
 	{ "session_scratch_max", "int", NULL, NULL, NULL, 0 },
@@ -1106,6 +1222,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	    NULL, "choices=[\"checkpoint_slow\",\"internal_page_split_race\""
 	    ",\"page_split_race\"]",
 	    NULL, 0 },
+	{ "transaction_snapshot", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_transaction_snapshot_subconfigs, 1 },
 	{ "transaction_sync", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_transaction_sync_subconfigs, 2 },
@@ -1175,19 +1294,21 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	},
 	{ "WT_CONNECTION.reconfigure",
 	  "async=(enabled=false,ops_max=1024,threads=2),cache_overhead=8,"
-	  "cache_size=100MB,checkpoint=(log_size=0,wait=0),"
-	  "compatibility=(release=),error_prefix=,eviction=(threads_max=8,"
-	  "threads_min=1),eviction_checkpoint_target=5,"
-	  "eviction_dirty_target=5,eviction_dirty_trigger=20,"
-	  "eviction_target=80,eviction_trigger=95,"
-	  "file_manager=(close_handle_minimum=250,close_idle_time=30,"
-	  "close_scan_interval=10),log=(archive=true,prealloc=true,"
-	  "zero_fill=false),lsm_manager=(merge=true,worker_thread_max=4),"
-	  "lsm_merge=true,shared_cache=(chunk=10MB,name=,quota=0,reserve=0,"
-	  "size=500MB),statistics=none,statistics_log=(json=false,"
-	  "on_close=false,sources=,timestamp=\"%b %d %H:%M:%S\",wait=0),"
-	  "timing_stress_for_test=,verbose=",
-	  confchk_WT_CONNECTION_reconfigure, 21
+	  "cache_size=100MB,checkpoint=(log_size=0,pace=false,threads=1,"
+	  "wait=0),compatibility=(release=),error_prefix=,"
+	  "eviction=(policy=lru,threads_max=8,threads_min=1),"
+	  "eviction_checkpoint_target=5,eviction_dirty_target=5,"
+	  "eviction_dirty_trigger=20,eviction_target=80,eviction_trigger=95"
+	  ",file_manager=(close_handle_minimum=250,close_idle_time=30,"
+	  "close_scan_interval=10),io_scheduler=(checkpoint_rate=0,"
+	  "read_priority=false),log=(archive=true,group_commit_delay=0,"
+	  "prealloc=true,zero_fill=false),lsm_manager=(merge=true,"
+	  "worker_thread_max=4),lsm_merge=true,shared_cache=(chunk=10MB,"
+	  "name=,quota=0,reserve=0,size=500MB),statistics=none,"
+	  "statistics_log=(json=false,on_close=false,sources=,"
+	  "timestamp=\"%b %d %H:%M:%S\",wait=0),timing_stress_for_test=,"
+	  "verbose=",
+	  confchk_WT_CONNECTION_reconfigure, 22
 	},
 	{ "WT_CONNECTION.rollback_to_stable",
 	  "",
@@ -1239,22 +1360,23 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	{ "WT_SESSION.create",
 	  "access_pattern_hint=none,allocation_size=4KB,app_metadata=,"
 	  "assert=(commit_timestamp=none,read_timestamp=none),"
-	  "block_allocation=best,block_compressor=,cache_resident=false,"
-	  "checksum=uncompressed,colgroups=,collator=,columns=,dictionary=0"
-	  ",encryption=(keyid=,name=),exclusive=false,extractor=,"
-	  "format=btree,huffman_key=,huffman_value=,"
-	  "ignore_in_memory_cache_size=false,immutable=false,"
-	  "internal_item_max=0,internal_key_max=0,"
+	  "block_allocation=best,block_avail_delta=false,block_compressor=,"
+	  "cache_resident=false,change_buffer_max=0,checksum=uncompressed,"
+	  "colgroups=,collator=,columns=,dictionary=0,encryption=(keyid=,"
+	  "name=),exclusive=false,extractor=,format=btree,huffman_key=,"
+	  "huffman_value=,ignore_in_memory_cache_size=false,immutable=false"
+	  ",internal_item_max=0,internal_key_max=0,"
 	  "internal_key_truncate=true,internal_page_max=4KB,key_format=u,"
-	  "key_gap=10,leaf_item_max=0,leaf_key_max=0,leaf_page_max=32KB,"
-	  "leaf_value_max=0,log=(enabled=true),lsm=(auto_throttle=true,"
-	  "bloom=true,bloom_bit_count=16,bloom_config=,bloom_hash_count=8,"
-	  "bloom_oldest=false,chunk_count_limit=0,chunk_max=5GB,"
-	  "chunk_size=10MB,merge_max=15,merge_min=0),memory_page_max=5MB,"
-	  "os_cache_dirty_max=0,os_cache_max=0,prefix_compression=false,"
-	  "prefix_compression_min=4,source=,split_deepen_min_child=0,"
-	  "split_deepen_per_child=0,split_pct=90,type=file,value_format=u",
-	  confchk_WT_SESSION_create, 43
+	  "key_gap=10,leaf_hash_search=0,leaf_item_max=0,leaf_key_max=0,"
+	  "leaf_page_max=32KB,leaf_value_max=0,log=(enabled=true),"
+	  "lsm=(auto_throttle=true,bloom=true,bloom_bit_count=16,"
+	  "bloom_config=,bloom_hash_count=8,bloom_oldest=false,"
+	  "chunk_count_limit=0,chunk_max=5GB,chunk_size=10MB,merge_max=15,"
+	  "merge_min=0),memory_page_max=5MB,os_cache_dirty_max=0,"
+	  "os_cache_max=0,prefix_compression=false,prefix_compression_min=4"
+	  ",source=,split_deepen_min_child=0,split_deepen_per_child=0,"
+	  "split_pct=90,type=file,value_format=u",
+	  confchk_WT_SESSION_create, 46
 	},
 	{ "WT_SESSION.drop",
 	  "checkpoint_wait=true,force=false,lock_wait=true,"
@@ -1278,9 +1400,9 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	{ "WT_SESSION.open_cursor",
 	  "append=false,bulk=false,checkpoint=,checkpoint_wait=true,dump=,"
 	  "next_random=false,next_random_sample_size=0,overwrite=true,"
-	  "raw=false,readonly=false,skip_sort_check=false,statistics=,"
-	  "target=",
-	  confchk_WT_SESSION_open_cursor, 13
+	  "raw=false,read_ahead=false,readonly=false,skip_sort_check=false,"
+	  "statistics=,tail_wait=0,target=",
+	  confchk_WT_SESSION_open_cursor, 15
 	},
 	{ "WT_SESSION.rebalance",
 	  "",
@@ -1342,35 +1464,37 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	{ "file.config",
 	  "access_pattern_hint=none,allocation_size=4KB,app_metadata=,"
 	  "assert=(commit_timestamp=none,read_timestamp=none),"
-	  "block_allocation=best,block_compressor=,cache_resident=false,"
-	  "checksum=uncompressed,collator=,columns=,dictionary=0,"
-	  "encryption=(keyid=,name=),format=btree,huffman_key=,"
-	  "huffman_value=,ignore_in_memory_cache_size=false,"
-	  "internal_item_max=0,internal_key_max=0,"
-	  "internal_key_truncate=true,internal_page_max=4KB,key_format=u,"
-	  "key_gap=10,leaf_item_max=0,leaf_key_max=0,leaf_page_max=32KB,"
+	  "block_allocation=best,block_avail_delta=false,block_compressor=,"
+	  "cache_resident=false,change_buffer_max=0,checksum=uncompressed,"
+	  "collator=,columns=,dictionary=0,encryption=(keyid=,name=),"
+	  "format=btree,huffman_key=,huffman_value=,"
+	  "ignore_in_memory_cache_size=false,internal_item_max=0,"
+	  "internal_key_max=0,internal_key_truncate=true,"
+	  "internal_page_max=4KB,key_format=u,key_gap=10,leaf_hash_search=0"
+	  ",leaf_item_max=0,leaf_key_max=0,leaf_page_max=32KB,"
 	  "leaf_value_max=0,log=(enabled=true),memory_page_max=5MB,"
 	  "os_cache_dirty_max=0,os_cache_max=0,prefix_compression=false,"
 	  "prefix_compression_min=4,split_deepen_min_child=0,"
 	  "split_deepen_per_child=0,split_pct=90,value_format=u",
-	  confchk_file_config, 36
+	  confchk_file_config, 39
 	},
 	{ "file.meta",
 	  "access_pattern_hint=none,allocation_size=4KB,app_metadata=,"
 	  "assert=(commit_timestamp=none,read_timestamp=none),"
-	  "block_allocation=best,block_compressor=,cache_resident=false,"
-	  "checkpoint=,checkpoint_lsn=,checksum=uncompressed,collator=,"
-	  "columns=,dictionary=0,encryption=(keyid=,name=),format=btree,"
-	  "huffman_key=,huffman_value=,id=,"
-	  "ignore_in_memory_cache_size=false,internal_item_max=0,"
-	  "internal_key_max=0,internal_key_truncate=true,"
-	  "internal_page_max=4KB,key_format=u,key_gap=10,leaf_item_max=0,"
-	  "leaf_key_max=0,leaf_page_max=32KB,leaf_value_max=0,"
-	  "log=(enabled=true),memory_page_max=5MB,os_cache_dirty_max=0,"
-	  "os_cache_max=0,prefix_compression=false,prefix_compression_min=4"
-	  ",split_deepen_min_child=0,split_deepen_per_child=0,split_pct=90,"
+	  "block_allocation=best,block_avail_delta=false,block_compressor=,"
+	  "cache_resident=false,change_buffer_max=0,checkpoint=,"
+	  "checkpoint_lsn=,checksum=uncompressed,collator=,columns=,"
+	  "dictionary=0,encryption=(keyid=,name=),format=btree,huffman_key="
+	  ",huffman_value=,id=,ignore_in_memory_cache_size=false,"
+	  "internal_item_max=0,internal_key_max=0,"
+	  "internal_key_truncate=true,internal_page_max=4KB,key_format=u,"
+	  "key_gap=10,leaf_hash_search=0,leaf_item_max=0,leaf_key_max=0,"
+	  "leaf_page_max=32KB,leaf_value_max=0,log=(enabled=true),"
+	  "memory_page_max=5MB,os_cache_dirty_max=0,os_cache_max=0,"
+	  "prefix_compression=false,prefix_compression_min=4,"
+	  "split_deepen_min_child=0,split_deepen_per_child=0,split_pct=90,"
 	  "value_format=u,version=(major=0,minor=0)",
-	  confchk_file_meta, 40
+	  confchk_file_meta, 43
 	},
 	{ "index.meta",
 	  "app_metadata=,collator=,columns=,extractor=,immutable=false,"
@@ -1380,13 +1504,14 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	{ "lsm.meta",
 	  "access_pattern_hint=none,allocation_size=4KB,app_metadata=,"
 	  "assert=(commit_timestamp=none,read_timestamp=none),"
-	  "block_allocation=best,block_compressor=,cache_resident=false,"
-	  "checksum=uncompressed,chunks=,collator=,columns=,dictionary=0,"
-	  "encryption=(keyid=,name=),format=btree,huffman_key=,"
-	  "huffman_value=,ignore_in_memory_cache_size=false,"
-	  "internal_item_max=0,internal_key_max=0,"
-	  "internal_key_truncate=true,internal_page_max=4KB,key_format=u,"
-	  "key_gap=10,last=,leaf_item_max=0,leaf_key_max=0,"
+	  "block_allocation=best,block_avail_delta=false,block_compressor=,"
+	  "cache_resident=false,change_buffer_max=0,checksum=uncompressed,"
+	  "chunks=,collator=,columns=,dictionary=0,encryption=(keyid=,"
+	  "name=),format=btree,huffman_key=,huffman_value=,"
+	  "ignore_in_memory_cache_size=false,internal_item_max=0,"
+	  "internal_key_max=0,internal_key_truncate=true,"
+	  "internal_page_max=4KB,key_format=u,key_gap=10,last=,"
+	  "leaf_hash_search=0,leaf_item_max=0,leaf_key_max=0,"
 	  "leaf_page_max=32KB,leaf_value_max=0,log=(enabled=true),"
 	  "lsm=(auto_throttle=true,bloom=true,bloom_bit_count=16,"
 	  "bloom_config=,bloom_hash_count=8,bloom_oldest=false,"
@@ -1395,7 +1520,7 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  "os_cache_dirty_max=0,os_cache_max=0,prefix_compression=false,"
 	  "prefix_compression_min=4,split_deepen_min_child=0,"
 	  "split_deepen_per_child=0,split_pct=90,value_format=u",
-	  confchk_lsm_meta, 40
+	  confchk_lsm_meta, 43
 	},
 	{ "table.meta",
 	  "app_metadata=,colgroups=,collator=,columns=,key_format=u,"
@@ -1405,96 +1530,122 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	{ "wiredtiger_open",
 	  "async=(enabled=false,ops_max=1024,threads=2),buffer_alignment=-1"
 	  ",builtin_extension_config=,cache_overhead=8,cache_size=100MB,"
-	  "checkpoint=(log_size=0,wait=0),checkpoint_sync=true,"
-	  "compatibility=(release=),config_base=true,create=false,"
-	  "direct_io=,encryption=(keyid=,name=,secretkey=),error_prefix=,"
-	  "eviction=(threads_max=8,threads_min=1),"
+	  "checkpoint=(log_size=0,pace=false,threads=1,wait=0),"
+	  "checkpoint_sync=true,compatibility=(release=),config_base=true,"
+	  "create=false,direct_io=,encryption=(keyid=,name=,secretkey=),"
+	  "error_prefix=,eviction=(policy=lru,threads_max=8,threads_min=1),"
 	  "eviction_checkpoint_target=5,eviction_dirty_target=5,"
-	  "eviction_dirty_trigger=20,eviction_target=80,eviction_trigger=95"
+	  "eviction_dirty_trigger=20,eviction_queues=(numa=false,shards=1),"
+	  "eviction_target=80,eviction_trigger=95"
 	  ",exclusive=false,extensions=,file_extend=,"
 	  "file_manager=(close_handle_minimum=250,close_idle_time=30,"
 	  "close_scan_interval=10),hazard_max=1000,in_memory=false,"
-	  "log=(archive=true,compressor=,enabled=true,file_max=100MB,"
-	  "path=\".\",prealloc=true,recover=on,zero_fill=false),"
+	  "io_scheduler=(checkpoint_rate=0,read_priority=false),"
+	  "log=(archive=true,compress_slots=false,compressor=,enabled=true,"
+	  "file_max=100MB,group_commit_delay=0,io_uring=false,join_groups=0"
+	  ",path=\".\",prealloc=true,recover=on,recover_threads=1,"
+	  "recycle=false,streams=1,zero_fill=false),"
 	  "lsm_manager=(merge=true,worker_thread_max=4),lsm_merge=true,"
-	  "mmap=true,multiprocess=false,readonly=false,session_max=100,"
+	  "mmap=true,multiprocess=false,read_ahead=(pages=8,threads=0),"
+	  "readonly=false,session_max=100,"
 	  "session_scratch_max=2MB,shared_cache=(chunk=10MB,name=,quota=0,"
 	  "reserve=0,size=500MB),statistics=none,statistics_log=(json=false"
 	  ",on_close=false,path=\".\",sources=,timestamp=\"%b %d %H:%M:%S\""
-	  ",wait=0),timing_stress_for_test=,transaction_sync=(enabled=false"
+	  ",wait=0),timing_stress_for_test=,"
+	  "transaction_snapshot=(method=scan),transaction_sync=(enabled=false"
 	  ",method=fsync),use_environment=true,use_environment_priv=false,"
 	  "verbose=(fileops=true),write_through=",
-	  confchk_wiredtiger_open, 42
+	  confchk_wiredtiger_open, 46
 	},
 	{ "wiredtiger_open_all",
 	  "async=(enabled=false,ops_max=1024,threads=2),buffer_alignment=-1"
 	  ",builtin_extension_config=,cache_overhead=8,cache_size=100MB,"
-	  "checkpoint=(log_size=0,wait=0),checkpoint_sync=true,"
-	  "compatibility=(release=),config_base=true,create=false,"
-	  "direct_io=,encryption=(keyid=,name=,secretkey=),error_prefix=,"
-	  "eviction=(threads_max=8,threads_min=1),"
+	  "checkpoint=(log_size=0,pace=false,threads=1,wait=0),"
+	  "checkpoint_sync=true,compatibility=(release=),config_base=true,"
+	  "create=false,direct_io=,encryption=(keyid=,name=,secretkey=),"
+	  "error_prefix=,eviction=(policy=lru,threads_max=8,threads_min=1),"
 	  "eviction_checkpoint_target=5,eviction_dirty_target=5,"
-	  "eviction_dirty_trigger=20,eviction_target=80,eviction_trigger=95"
+	  "eviction_dirty_trigger=20,eviction_queues=(numa=false,shards=1),"
+	  "eviction_target=80,eviction_trigger=95"
 	  ",exclusive=false,extensions=,file_extend=,"
 	  "file_manager=(close_handle_minimum=250,close_idle_time=30,"
 	  "close_scan_interval=10),hazard_max=1000,in_memory=false,"
-	  "log=(archive=true,compressor=,enabled=true,file_max=100MB,"
-	  "path=\".\",prealloc=true,recover=on,zero_fill=false),"
+	  "io_scheduler=(checkpoint_rate=0,read_priority=false),"
+	  "log=(archive=true,compress_slots=false,compressor=,enabled=true,"
+	  "file_max=100MB,group_commit_delay=0,io_uring=false,join_groups=0"
+	  ",path=\".\",prealloc=true,recover=on,recover_threads=1,"
+	  "recycle=false,streams=1,zero_fill=false),"
 	  "lsm_manager=(merge=true,worker_thread_max=4),lsm_merge=true,"
-	  "mmap=true,multiprocess=false,readonly=false,session_max=100,"
+	  "mmap=true,multiprocess=false,read_ahead=(pages=8,threads=0),"
+	  "readonly=false,session_max=100,"
 	  "session_scratch_max=2MB,shared_cache=(chunk=10MB,name=,quota=0,"
 	  "reserve=0,size=500MB),statistics=none,statistics_log=(json=false"
 	  ",on_close=false,path=\".\",sources=,timestamp=\"%b %d %H:%M:%S\""
-	  ",wait=0),timing_stress_for_test=,transaction_sync=(enabled=false"
+	  ",wait=0),timing_stress_for_test=,"
+	  "transaction_snapshot=(method=scan),transaction_sync=(enabled=false"
 	  ",method=fsync),use_environment=true,use_environment_priv=false,"
 	  "verbose=(api=true,block=true,checkpoint=true,checkpoint_progress=true,compact=true,evict=true,evict_stuck=true,evictserver=true,"
         "fileops=true,handleops=true,log=true,lookaside=true,lookaside_activity=true,lsm=true,lsm_manager=true,metadata=true,"
         "mutex=true,overflow=true,read=true,rebalance=true,reconcile=true,reconcile=true,recovery=true,recovery_progress=true,"
         "salvage=true,shared_cache=true,split=true,thread_group=true,split=true,thread_group=true,timestamp=true,transaction=true,"
         "verify=true,version=true,write=true),version=(major=0,minor=0),write_through=",
-	  confchk_wiredtiger_open_all, 43
+	  confchk_wiredtiger_open_all, 47
 	},
 	{ "wiredtiger_open_basecfg",
 	  "async=(enabled=false,ops_max=1024,threads=2),buffer_alignment=-1"
 	  ",builtin_extension_config=,cache_overhead=8,cache_size=100MB,"
-	  "checkpoint=(log_size=0,wait=0),checkpoint_sync=true,"
-	  "compatibility=(release=),direct_io=,encryption=(keyid=,name=,"
-	  "secretkey=),error_prefix=,eviction=(threads_max=8,threads_min=1)"
-	  ",eviction_checkpoint_target=5,eviction_dirty_target=5,"
-	  "eviction_dirty_trigger=20,eviction_target=80,eviction_trigger=95"
-	  ",extensions=,file_extend=,file_manager=(close_handle_minimum=250"
-	  ",close_idle_time=30,close_scan_interval=10),hazard_max=1000,"
-	  "log=(archive=true,compressor=,enabled=false,file_max=100MB,"
-	  "path=\".\",prealloc=true,recover=on,zero_fill=false),"
+	  "checkpoint=(log_size=0,pace=false,threads=1,wait=0),"
+	  "checkpoint_sync=true,compatibility=(release=),direct_io=,"
+	  "encryption=(keyid=,name=,secretkey=),error_prefix=,"
+	  "eviction=(policy=lru,threads_max=8,threads_min=1),"
+	  "eviction_checkpoint_target=5,eviction_dirty_target=5,"
+	  "eviction_dirty_trigger=20,eviction_queues=(numa=false,shards=1),"
+	  "eviction_target=80,eviction_trigger=95,extensions=,file_extend=,"
+	  "file_manager=(close_handle_minimum=250,close_idle_time=30,"
+	  "close_scan_interval=10),hazard_max=1000,"
+	  "io_scheduler=(checkpoint_rate=0,read_priority=false),"
+	  "log=(archive=true,compress_slots=false,compressor=,enabled=false"
+	  ",file_max=100MB,group_commit_delay=0,io_uring=false,"
+	  "join_groups=0,path=\".\",prealloc=true,recover=on,"
+	  "recover_threads=1,recycle=false,streams=1,zero_fill=false),"
 	  "lsm_manager=(merge=true,worker_thread_max=4),lsm_merge=true,"
-	  "mmap=true,multiprocess=false,readonly=false,session_max=100,"
-	  "session_scratch_max=2MB,shared_cache=(chunk=10MB,name=,quota=0,"
-	  "reserve=0,size=500MB),statistics=none,statistics_log=(json=false"
-	  ",on_close=false,path=\".\",sources=,timestamp=\"%b %d %H:%M:%S\""
-	  ",wait=0),timing_stress_for_test=,transaction_sync=(enabled=false"
-	  ",method=fsync),verbose=,version=(major=0,minor=0),write_through=",
-	  confchk_wiredtiger_open_basecfg, 37
+	  "mmap=true,multiprocess=false,read_ahead=(pages=8,threads=0),"
+	  "readonly=false,session_max=100,session_scratch_max=2MB,"
+	  "shared_cache=(chunk=10MB,name=,quota=0,reserve=0,size=500MB),"
+	  "statistics=none,statistics_log=(json=false,on_close=false,"
+	  "path=\".\",sources=,timestamp=\"%b %d %H:%M:%S\",wait=0),"
+	  "timing_stress_for_test=,transaction_snapshot=(method=scan),"
+	  "transaction_sync=(enabled=false,method=fsync),verbose=,"
+	  "version=(major=0,minor=0),write_through=",
+	  confchk_wiredtiger_open_basecfg, 41
 	},
 	{ "wiredtiger_open_usercfg",
 	  "async=(enabled=false,ops_max=1024,threads=2),buffer_alignment=-1"
 	  ",builtin_extension_config=,cache_overhead=8,cache_size=100MB,"
-	  "checkpoint=(log_size=0,wait=0),checkpoint_sync=true,"
-	  "compatibility=(release=),direct_io=,encryption=(keyid=,name=,"
-	  "secretkey=),error_prefix=,eviction=(threads_max=8,threads_min=1)"
-	  ",eviction_checkpoint_target=5,eviction_dirty_target=5,"
-	  "eviction_dirty_trigger=20,eviction_target=80,eviction_trigger=95"
-	  ",extensions=,file_extend=,file_manager=(close_handle_minimum=250"
-	  ",close_idle_time=30,close_scan_interval=10),hazard_max=1000,"
-	  "log=(archive=true,compressor=,enabled=false,file_max=100MB,"
-	  "path=\".\",prealloc=true,recover=on,zero_fill=false),"
+	  "checkpoint=(log_size=0,pace=false,threads=1,wait=0),"
+	  "checkpoint_sync=true,compatibility=(release=),direct_io=,"
+	  "encryption=(keyid=,name=,secretkey=),error_prefix=,"
+	  "eviction=(policy=lru,threads_max=8,threads_min=1),"
+	  "eviction_checkpoint_target=5,eviction_dirty_target=5,"
+	  "eviction_dirty_trigger=20,eviction_queues=(numa=false,shards=1),"
+	  "eviction_target=80,eviction_trigger=95,extensions=,file_extend=,"
+	  "file_manager=(close_handle_minimum=250,close_idle_time=30,"
+	  "close_scan_interval=10),hazard_max=1000,"
+	  "io_scheduler=(checkpoint_rate=0,read_priority=false),"
+	  "log=(archive=true,compress_slots=false,compressor=,enabled=false"
+	  ",file_max=100MB,group_commit_delay=0,io_uring=false,"
+	  "join_groups=0,path=\".\",prealloc=true,recover=on,"
+	  "recover_threads=1,recycle=false,streams=1,zero_fill=false),"
 	  "lsm_manager=(merge=true,worker_thread_max=4),lsm_merge=true,"
-	  "mmap=true,multiprocess=false,readonly=false,session_max=100,"
-	  "session_scratch_max=2MB,shared_cache=(chunk=10MB,name=,quota=0,"
-	  "reserve=0,size=500MB),statistics=none,statistics_log=(json=false"
-	  ",on_close=false,path=\".\",sources=,timestamp=\"%b %d %H:%M:%S\""
-	  ",wait=0),timing_stress_for_test=,transaction_sync=(enabled=false"
-	  ",method=fsync),verbose=,write_through=",
-	  confchk_wiredtiger_open_usercfg, 36
+	  "mmap=true,multiprocess=false,read_ahead=(pages=8,threads=0),"
+	  "readonly=false,session_max=100,session_scratch_max=2MB,"
+	  "shared_cache=(chunk=10MB,name=,quota=0,reserve=0,size=500MB),"
+	  "statistics=none,statistics_log=(json=false,on_close=false,"
+	  "path=\".\",sources=,timestamp=\"%b %d %H:%M:%S\",wait=0),"
+	  "timing_stress_for_test=,transaction_snapshot=(method=scan),"
+	  "transaction_sync=(enabled=false,method=fsync),verbose=,"
+	  "write_through=",
+	  confchk_wiredtiger_open_usercfg, 40
 	},
 	{ NULL, NULL, NULL, 0 }
 };
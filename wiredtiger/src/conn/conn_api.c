@@ -2719,6 +2719,7 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 	conn->mmap = cval.val != 0;
 
 	WT_ERR(__wt_conn_statistics_config(session, cfg));
+	WT_ERR(__wt_block_sched_config(session, cfg));
 	WT_ERR(__wt_lsm_manager_config(session, cfg));
 	WT_ERR(__wt_sweep_config(session, cfg));
 
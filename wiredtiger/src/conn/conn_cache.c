@@ -91,6 +91,13 @@ __cache_config_local(WT_SESSION_IMPL *session, bool shared, const char *cfg[])
 	conn->evict_threads_max = evict_threads_max;
 	conn->evict_threads_min = evict_threads_min;
 
+	WT_RET(__wt_config_gets(session, cfg, "eviction.policy", &cval));
+	if (WT_STRING_MATCH("scan_resistant", cval.str, cval.len)) {
+		WT_RET(__wt_evict_ghost_alloc(session));
+		cache->evict_policy = WT_EVICT_POLICY_SCAN_RESISTANT;
+	} else
+		cache->evict_policy = WT_EVICT_POLICY_LRU;
+
 	return (0);
 }
 
@@ -164,9 +171,11 @@ int
 __wt_cache_create(WT_SESSION_IMPL *session, const char *cfg[])
 {
 	WT_CACHE *cache;
+	WT_CONFIG_ITEM cval;
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
-	int i;
+	WT_EVICT_SHARD *shard;
+	u_int i, nodes, shards;
 
 	conn = S2C(session);
 
@@ -198,7 +207,7 @@ __wt_cache_create(WT_SESSION_IMPL *session, const char *cfg[])
 	    "cache eviction server", 10000, WT_MILLION, &cache->evict_cond));
 	WT_RET(__wt_spin_init(session, &cache->evict_pass_lock, "evict pass"));
 	WT_RET(__wt_spin_init(session,
-	    &cache->evict_queue_lock, "cache eviction queue"));
+	    &cache->evict_queue_lock, "cache eviction urgent queue"));
 	WT_RET(__wt_spin_init(session, &cache->evict_walk_lock, "cache walk"));
 	if ((ret = __wt_open_internal_session(conn, "evict pass",
 	    false, WT_SESSION_NO_DATA_HANDLES, &cache->walk_session)) != 0)
@@ -209,20 +218,49 @@ __wt_cache_create(WT_SESSION_IMPL *session, const char *cfg[])
 	WT_RET(__wt_spin_init(
 	    session, &cache->las_sweep_lock, "lookaside sweep"));
 
-	/* Allocate the LRU eviction queue. */
+	/*
+	 * Configure the eviction queue shards: with NUMA placement, round the
+	 * number of shards up to a multiple of the number of nodes so every
+	 * node has the same number of shards.
+	 */
+	WT_RET(__wt_config_gets(session, cfg, "eviction_queues.shards", &cval));
+	shards = (u_int)cval.val;
+	WT_RET(__wt_config_gets(session, cfg, "eviction_queues.numa", &cval));
+	nodes = cval.val != 0 ? __wt_numa_node_count() : 1;
+	if (nodes > 1) {
+		nodes = WT_MIN(nodes, WT_EVICT_SHARD_MAX);
+		shards = ((shards + nodes - 1) / nodes) * nodes;
+		if (shards > WT_EVICT_SHARD_MAX)
+			shards = (WT_EVICT_SHARD_MAX / nodes) * nodes;
+		cache->evict_numa_nodes = nodes;
+	}
+	cache->evict_shard_count = shards;
+
+	/* Allocate the LRU eviction queues: two per shard plus urgent. */
 	cache->evict_slots = WT_EVICT_WALK_BASE + WT_EVICT_WALK_INCR;
-	for (i = 0; i < WT_EVICT_QUEUE_MAX; ++i) {
+	cache->evict_queue_count = shards * WT_EVICT_SHARD_QUEUES + 1;
+	WT_RET(__wt_calloc_def(
+	    session, cache->evict_queue_count, &cache->evict_queues));
+	for (i = 0; i < cache->evict_queue_count; ++i) {
 		WT_RET(__wt_calloc_def(session,
 		    cache->evict_slots, &cache->evict_queues[i].evict_queue));
-		WT_RET(__wt_spin_init(session,
-		    &cache->evict_queues[i].evict_lock, "cache eviction"));
+		WT_SPIN_INIT_TRACKED(session,
+		    &cache->evict_queues[i].evict_lock, evict_queue);
 	}
 
 	/* Ensure there are always non-NULL queues. */
-	cache->evict_current_queue = cache->evict_fill_queue =
-	    &cache->evict_queues[0];
-	cache->evict_other_queue = &cache->evict_queues[1];
-	cache->evict_urgent_queue = &cache->evict_queues[WT_EVICT_URGENT_QUEUE];
+	WT_RET(__wt_calloc_def(session, shards, &cache->evict_shards));
+	for (i = 0; i < shards; ++i) {
+		shard = &cache->evict_shards[i];
+		WT_SPIN_INIT_TRACKED(session, &shard->evict_queue_lock,
+		    evict_shard);
+		shard->evict_current_queue = shard->evict_fill_queue =
+		    &cache->evict_queues[i * WT_EVICT_SHARD_QUEUES];
+		shard->evict_other_queue =
+		    &cache->evict_queues[i * WT_EVICT_SHARD_QUEUES + 1];
+	}
+	cache->evict_urgent_queue =
+	    &cache->evict_queues[cache->evict_queue_count - 1];
 
 	/*
 	 * We get/set some values in the cache statistics (rather than have
@@ -242,7 +280,9 @@ __wt_cache_stats_update(WT_SESSION_IMPL *session)
 	WT_CACHE *cache;
 	WT_CONNECTION_IMPL *conn;
 	WT_CONNECTION_STATS **stats;
-	uint64_t inuse, leaf;
+	WT_EVICT_SHARD *shard;
+	uint64_t depth, depth_max, depth_min, inuse, leaf;
+	u_int i;
 
 	conn = S2C(session);
 	cache = conn->cache;
@@ -282,6 +322,26 @@ __wt_cache_stats_update(WT_SESSION_IMPL *session)
 	WT_STAT_SET(session, stats, cache_pages_dirty,
 	    cache->pages_dirty_intl + cache->pages_dirty_leaf);
 
+	WT_STAT_SET(session, stats,
+	    cache_eviction_policy_hot_pages, cache->evict_hot_pages);
+
+	/*
+	 * Report the range of candidates queued across the eviction shards.
+	 * Note: reading without locking.
+	 */
+	depth_max = 0;
+	depth_min = UINT64_MAX;
+	for (i = 0; i < cache->evict_shard_count; ++i) {
+		shard = &cache->evict_shards[i];
+		depth = __wt_evict_queue_depth(shard->evict_current_queue) +
+		    __wt_evict_queue_depth(shard->evict_other_queue);
+		depth_max = WT_MAX(depth_max, depth);
+		depth_min = WT_MIN(depth_min, depth);
+	}
+	WT_STAT_SET(session, stats, cache_eviction_shard_depth_max, depth_max);
+	WT_STAT_SET(session, stats, cache_eviction_shard_depth_min,
+	    depth_min == UINT64_MAX ? 0 : depth_min);
+
 	WT_STAT_SET(session, stats, cache_eviction_state, cache->flags);
 	WT_STAT_SET(session, stats,
 	    cache_eviction_aggressive_set, cache->evict_aggressive_score);
@@ -316,7 +376,7 @@ __wt_cache_destroy(WT_SESSION_IMPL *session)
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
 	WT_SESSION *wt_session;
-	int i;
+	u_int i;
 
 	conn = S2C(session);
 	cache = conn->cache;
@@ -357,10 +417,19 @@ __wt_cache_destroy(WT_SESSION_IMPL *session)
 	if (wt_session != NULL)
 		WT_TRET(wt_session->close(wt_session, NULL));
 
-	for (i = 0; i < WT_EVICT_QUEUE_MAX; ++i) {
-		__wt_spin_destroy(session, &cache->evict_queues[i].evict_lock);
-		__wt_free(session, cache->evict_queues[i].evict_queue);
-	}
+	if (cache->evict_queues != NULL)
+		for (i = 0; i < cache->evict_queue_count; ++i) {
+			__wt_spin_destroy(
+			    session, &cache->evict_queues[i].evict_lock);
+			__wt_free(session, cache->evict_queues[i].evict_queue);
+		}
+	__wt_free(session, cache->evict_queues);
+	if (cache->evict_shards != NULL)
+		for (i = 0; i < cache->evict_shard_count; ++i)
+			__wt_spin_destroy(session,
+			    &cache->evict_shards[i].evict_queue_lock);
+	__wt_free(session, cache->evict_shards);
+	__wt_free(session, cache->evict_ghost);
 
 	__wt_free(session, conn->cache);
 	return (ret);
@@ -30,6 +30,9 @@ __ckpt_server_config(WT_SESSION_IMPL *session, const char **cfg, bool *startp)
 	WT_RET(__wt_config_gets(session, cfg, "checkpoint.log_size", &cval));
 	conn->ckpt_logsize = (wt_off_t)cval.val;
 
+	WT_RET(__wt_config_gets(session, cfg, "checkpoint.pace", &cval));
+	conn->ckpt_pace = cval.val != 0;
+
 	/*
 	 * The checkpoint configuration requires a wait time and/or a log size,
 	 * if neither is set, we're not running at all. Checkpoints based on log
@@ -72,6 +75,88 @@ __ckpt_server_run_chk(WT_SESSION_IMPL *session)
 	return (F_ISSET(S2C(session), WT_CONN_SERVER_CHECKPOINT));
 }
 
+/*
+ * __ckpt_pace_file --
+ *	Write a file's dirty leaf pages out of the paced write budget.
+ */
+static int
+__ckpt_pace_file(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_UNUSED(cfg);
+
+	return (__wt_sync_file_pace(session, &S2C(session)->ckpt_pace_budget));
+}
+
+/*
+ * __ckpt_server_pace --
+ *	Wait for the next checkpoint, writing dirty leaf pages in the meantime
+ *	so the checkpoint only has to write what was dirtied recently.
+ */
+static int
+__ckpt_server_pace(WT_SESSION_IMPL *session)
+{
+	struct timespec now, start;
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	uint64_t budget, dirty, elapsed, growth, last_dirty, slice, written;
+	bool signalled;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	/*
+	 * Wake up at least ten times per interval, and at least once a second,
+	 * to write a slice's worth of dirty leaf pages.
+	 */
+	slice = WT_MIN(conn->ckpt_usecs / 10, WT_MILLION);
+	if (slice == 0)
+		slice = 1;
+	growth = written = 0;
+	last_dirty = __wt_cache_dirty_leaf_inuse(cache);
+	__wt_epoch(session, &start);
+
+	for (;;) {
+		__wt_cond_wait_signal(session, conn->ckpt_cond,
+		    slice, __ckpt_server_run_chk, &signalled);
+		if (signalled || !__ckpt_server_run_chk(session))
+			break;
+		__wt_epoch(session, &now);
+		elapsed = WT_TIMEDIFF_US(now, start);
+		if (elapsed + slice / 2 >= conn->ckpt_usecs)
+			break;
+
+		/*
+		 * Estimate how fast leaf pages are being dirtied from the
+		 * change since the last slice, smoothed over a few slices.
+		 * Each slice writes its share of the dirty bytes that will
+		 * otherwise be left for the checkpoint, plus the bytes dirtied
+		 * during the slice, so that dirty data is written at a steady
+		 * rate rather than in a burst by the checkpoint.
+		 */
+		dirty = __wt_cache_dirty_leaf_inuse(cache);
+		growth = (growth +
+		    (dirty > last_dirty ? dirty - last_dirty : 0)) / 2;
+		budget = growth +
+		    dirty / ((conn->ckpt_usecs - elapsed) / slice + 1);
+		if (budget != 0) {
+			conn->ckpt_pace_budget = budget;
+			WT_RET(__wt_conn_btree_apply(
+			    session, NULL, __ckpt_pace_file, NULL, NULL));
+			written += budget - conn->ckpt_pace_budget;
+			conn->ckpt_pace_budget = 0;
+		}
+		last_dirty = __wt_cache_dirty_leaf_inuse(cache);
+	}
+
+	__wt_epoch(session, &now);
+	elapsed = WT_MAX(WT_TIMEDIFF_US(now, start), 1);
+	WT_STAT_CONN_SET(session,
+	    txn_checkpoint_pace_rate, written * WT_MILLION / elapsed);
+	WT_STAT_CONN_SET(session, txn_checkpoint_pace_remaining,
+	    __wt_cache_dirty_leaf_inuse(cache));
+	return (0);
+}
+
 /*
  * __ckpt_server --
  *	The checkpoint server thread.
@@ -95,8 +180,11 @@ __ckpt_server(void *arg)
 		 * will be 0 and this wait won't return until signalled.
 		 */ 
 		/*ȴcheckpointʱlog file˶Ӧֵcheckpoint*/
-		__wt_cond_wait(session,
-		    conn->ckpt_cond, conn->ckpt_usecs, __ckpt_server_run_chk);
+		if (conn->ckpt_pace && conn->ckpt_usecs != 0)
+			WT_ERR(__ckpt_server_pace(session));
+		else
+			__wt_cond_wait(session, conn->ckpt_cond,
+			    conn->ckpt_usecs, __ckpt_server_run_chk);
 
 		/* Check if we're quitting or being reconfigured. */
 		if (!__ckpt_server_run_chk(session))
@@ -192,6 +280,7 @@ int
 __wt_checkpoint_server_create(WT_SESSION_IMPL *session, const char *cfg[])
 {
 	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
 	bool start;
 
 	conn = S2C(session);
@@ -211,6 +300,12 @@ __wt_checkpoint_server_create(WT_SESSION_IMPL *session, const char *cfg[])
 		WT_RET(__wt_checkpoint_server_destroy(session));
 
 	WT_RET(__ckpt_server_config(session, cfg, &start));
+
+	/* Start the worker threads before the server can checkpoint. */
+	WT_WITH_CHECKPOINT_LOCK(session,
+	    ret = __wt_checkpoint_workers_create(session, cfg));
+	WT_RET(ret);
+
 	if (start)
 		WT_RET(__ckpt_server_start(conn));
 
@@ -252,6 +347,14 @@ __wt_checkpoint_server_destroy(WT_SESSION_IMPL *session)
 	conn->ckpt_tid_set = false;
 	conn->ckpt_cond = NULL;
 	conn->ckpt_usecs = 0;
+	conn->ckpt_pace = false;
+
+	/*
+	 * Stop the worker threads once the server has exited, application
+	 * checkpoints can be using them.
+	 */
+	WT_WITH_CHECKPOINT_LOCK(session,
+	    WT_TRET(__wt_checkpoint_workers_destroy(session)));
 
 	return (ret);
 }
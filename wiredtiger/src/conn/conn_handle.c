@@ -35,6 +35,8 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
 	TAILQ_INIT(&conn->extractorqh);		/* Extractor list */
 
 	TAILQ_INIT(&conn->lsmqh);		/* WT_LSM_TREE list */
+	TAILQ_INIT(&conn->read_ahead_qh);	/* Read-ahead queue */
+	TAILQ_INIT(&conn->ckpt_leaf_qh);	/* Checkpoint leaf page queue */
 
 	/* Setup the LSM work queues. */
 	TAILQ_INIT(&conn->lsm_manager.switchqh);
@@ -54,9 +56,12 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
 	/* Spinlocks. */
 	WT_RET(__wt_spin_init(session, &conn->api_lock, "api"));
 	WT_SPIN_INIT_TRACKED(session, &conn->checkpoint_lock, checkpoint);
+	WT_RET(__wt_spin_init(
+	    session, &conn->ckpt_leaf_lock, "checkpoint leaf queue"));
 	WT_RET(__wt_spin_init(session, &conn->encryptor_lock, "encryptor"));
 	WT_RET(__wt_spin_init(session, &conn->fh_lock, "file list"));
 	WT_SPIN_INIT_TRACKED(session, &conn->metadata_lock, metadata);
+	WT_RET(__wt_spin_init(session, &conn->read_ahead_lock, "read-ahead"));
 	WT_RET(__wt_spin_init(session, &conn->reconfig_lock, "reconfigure"));
 	WT_SPIN_INIT_TRACKED(session, &conn->schema_lock, schema);
 	WT_RET(__wt_spin_init(session, &conn->turtle_lock, "turtle file"));
@@ -86,6 +91,8 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
 	 * more opaque, but for now this is simpler.
 	 */
 	WT_RET(__wt_spin_init(session, &conn->block_lock, "block manager"));
+	WT_RET(__wt_spin_init(session,
+	    &conn->block_sched.ckpt_lock, "block manager scheduler"));
 	for (i = 0; i < WT_HASH_ARRAY_SIZE; i++)
 		TAILQ_INIT(&conn->blockhash[i]);/* Block handle hash lists */
 	TAILQ_INIT(&conn->blockqh);		/* Block manager list */
@@ -120,12 +127,15 @@ __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
 
 	__wt_spin_destroy(session, &conn->api_lock);
 	__wt_spin_destroy(session, &conn->block_lock);
+	__wt_spin_destroy(session, &conn->block_sched.ckpt_lock);
 	__wt_spin_destroy(session, &conn->checkpoint_lock);
+	__wt_spin_destroy(session, &conn->ckpt_leaf_lock);
 	__wt_rwlock_destroy(session, &conn->dhandle_lock);
 	__wt_spin_destroy(session, &conn->encryptor_lock);
 	__wt_spin_destroy(session, &conn->fh_lock);
 	__wt_rwlock_destroy(session, &conn->hot_backup_lock);
 	__wt_spin_destroy(session, &conn->metadata_lock);
+	__wt_spin_destroy(session, &conn->read_ahead_lock);
 	__wt_spin_destroy(session, &conn->reconfig_lock);
 	__wt_spin_destroy(session, &conn->schema_lock);
 	__wt_rwlock_destroy(session, &conn->table_lock);
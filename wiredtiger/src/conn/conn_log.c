@@ -124,13 +124,20 @@ __logmgr_version(WT_SESSION_IMPL *session, bool reconfig)
 	 * Since the log version changed at a major release number we only need
 	 * to check the major number, not the minor number in the compatibility
 	 * setting.
+	 *
+	 * Only write the newest version when a feature changing the on-disk
+	 * format is configured: salted record checksums (recycled log files)
+	 * or slot frames (compressed slots).  Otherwise write the version the
+	 * 3.0 release reads, so those log files can still be downgraded.
 	 */
 	if (conn->compat_major < WT_LOG_V2) {
 		new_version = 1;
 		first_record = WT_LOG_END_HEADER;
 		downgrade = true;
 	} else {
-		new_version = WT_LOG_VERSION;
+		new_version = FLD_ISSET(conn->log_flags,
+		    WT_CONN_LOG_COMPRESS_SLOTS | WT_CONN_LOG_RECYCLE) ?
+		    WT_LOG_VERSION : WT_LOG_VERSION_SYSTEM;
 		first_record = WT_LOG_END_HEADER + log->allocsize;
 		downgrade = false;
 	}
@@ -266,6 +273,46 @@ __logmgr_config(
 		WT_RET(__wt_config_gets(session, cfg, "log.file_max", &cval));
 		conn->log_file_max = (wt_off_t)cval.val;
 		WT_STAT_CONN_SET(session, log_max_filesize, conn->log_file_max);
+
+		/* The number of log streams cannot be reconfigured. */
+		WT_RET(__wt_config_gets(session, cfg, "log.streams", &cval));
+		conn->log_streams = (uint32_t)cval.val;
+
+		/* Neither can the number of slot join groups. */
+		WT_RET(__wt_config_gets(
+		    session, cfg, "log.join_groups", &cval));
+		conn->log_join_groups = (uint32_t)cval.val;
+
+		WT_RET(__wt_config_gets(session, cfg, "log.io_uring", &cval));
+		conn->log_io_uring = cval.val != 0;
+
+		/*
+		 * Recycled files carry salted record checksums, the setting
+		 * can't change while files are being recycled.  Files are only
+		 * recycled when archived into pre-allocated files, anything
+		 * else is a configuration error.
+		 */
+		WT_RET(__wt_config_gets(session, cfg, "log.recycle", &cval));
+		if (cval.val != 0) {
+			WT_RET(__wt_config_gets(
+			    session, cfg, "log.prealloc", &cval));
+			if (!FLD_ISSET(conn->log_flags, WT_CONN_LOG_ARCHIVE) ||
+			    cval.val == 0)
+				WT_RET_MSG(session, EINVAL,
+				    "log=(recycle=true) requires "
+				    "log=(archive=true,prealloc=true)");
+			FLD_SET(conn->log_flags, WT_CONN_LOG_RECYCLE);
+		}
+
+		/*
+		 * Slot frames need a compressor and aren't written with an
+		 * encryptor, the setting is otherwise ignored.
+		 */
+		WT_RET(__wt_config_gets(
+		    session, cfg, "log.compress_slots", &cval));
+		if (cval.val != 0 &&
+		    conn->log_compressor != NULL && conn->kencryptor == NULL)
+			FLD_SET(conn->log_flags, WT_CONN_LOG_COMPRESS_SLOTS);
 	}
 
 	/*
@@ -288,8 +335,15 @@ __logmgr_config(
 		    session, cfg, "log.recover", 0, &cval));
 		if (WT_STRING_MATCH("error", cval.str, cval.len))
 			FLD_SET(conn->log_flags, WT_CONN_LOG_RECOVER_ERR);
+
+		WT_RET(__wt_config_gets(
+		    session, cfg, "log.recover_threads", &cval));
+		conn->log_recover_threads = (uint32_t)cval.val;
 	}
 
+	WT_RET(__wt_config_gets(session, cfg, "log.group_commit_delay", &cval));
+	conn->log_group_commit_max = (uint64_t)cval.val;
+
 	WT_RET(__wt_config_gets(session, cfg, "log.zero_fill", &cval));
 	if (cval.val != 0) {
 		if (F_ISSET(conn, WT_CONN_READONLY))
@@ -330,16 +384,16 @@ __log_archive_once(WT_SESSION_IMPL *session, uint32_t backup_file)
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
 	WT_LOG *log;
-	uint32_t lognum, min_lognum;
-	u_int i, logcount;
-	char **logfiles;
+	uint32_t lognum, min_lognum, recycle;
+	u_int i, logcount, preallocs;
+	char **logfiles, **prepfiles;
 	bool locked;
 
 	conn = S2C(session);
 	log = conn->log;
-	logcount = 0;
+	logcount = preallocs = 0;
 	locked = false;
-	logfiles = NULL;
+	logfiles = prepfiles = NULL;
 
 	/*
 	 * If we're coming from a backup cursor we want the smaller of
@@ -362,6 +416,23 @@ __log_archive_once(WT_SESSION_IMPL *session, uint32_t backup_file)
 	WT_ERR(__wt_fs_directory_list(
 	    session, conn->log_path, WT_LOG_FILENAME, &logfiles, &logcount));
 
+	/*
+	 * If configured, archived files refill the pre-allocated files rather
+	 * than being removed.  Not when called for a backup cursor (we don't
+	 * rename files the backup may be copying), and not when running with
+	 * an older release's log version: those files don't carry salted
+	 * record checksums and recycled records couldn't be told apart.
+	 */
+	recycle = 0;
+	if (backup_file == 0 && conn->log_prealloc > 0 &&
+	    FLD_ISSET(conn->log_flags, WT_CONN_LOG_RECYCLE) &&
+	    log->log_version >= WT_LOG_VERSION_SALTED) {
+		WT_ERR(__wt_fs_directory_list(session,
+		    conn->log_path, WT_LOG_PREPNAME, &prepfiles, &preallocs));
+		if (preallocs < conn->log_prealloc)
+			recycle = conn->log_prealloc - preallocs;
+	}
+
 	/*
 	 * We can only archive files if a hot backup is not in progress or
 	 * if we are the backup.
@@ -372,9 +443,14 @@ __log_archive_once(WT_SESSION_IMPL *session, uint32_t backup_file)
 		for (i = 0; i < logcount; i++) {
 			WT_ERR(__wt_log_extract_lognum(
 			    session, logfiles[i], &lognum));
-			if (lognum < min_lognum)
 			/*ɾҪ鵵־ļ,طֱɾ᲻᲻ףinnobaseǽļ
 			 *ݵһĿ¼ʱ*/
+			if (lognum >= min_lognum)
+				continue;
+			if (recycle > 0) {
+				WT_ERR(__wt_log_recycle(session, lognum));
+				--recycle;
+			} else
 				WT_ERR(__wt_log_remove(
 				    session, WT_LOG_FILENAME, lognum));
 		}
@@ -394,6 +470,7 @@ err:		__wt_err(session, ret, "log archive server error");
 	if (locked)
 		__wt_readunlock(session, &conn->hot_backup_lock);
 	WT_TRET(__wt_fs_directory_list_free(session, &logfiles, logcount));
+	WT_TRET(__wt_fs_directory_list_free(session, &prepfiles, preallocs));
 	return (ret);
 }
 
@@ -441,8 +518,8 @@ __log_prealloc_once(WT_SESSION_IMPL *session)
 	 */
 	/*Ԥ־ļ*/
 	for (i = reccount; i < (u_int)conn->log_prealloc; i++) {
-		WT_ERR(__wt_log_allocfile(
-		    session, ++log->prep_fileid, WT_LOG_PREPNAME));
+		WT_ERR(__wt_log_allocfile(session,
+		    __wt_atomic_add32(&log->prep_fileid, 1), WT_LOG_PREPNAME));
 		WT_STAT_CONN_INCR(session, log_prealloc_files);
 	}
 	/*
@@ -710,6 +787,7 @@ void
 __wt_log_wrlsn(WT_SESSION_IMPL *session, int *yield)
 {
 	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
 	WT_LOG *log;
 	WT_LOGSLOT *coalescing, *slot;
 	WT_LOG_WRLSN_ENTRY written[WT_SLOT_POOL];
@@ -720,6 +798,11 @@ __wt_log_wrlsn(WT_SESSION_IMPL *session, int *yield)
 	conn = S2C(session);
 	log = conn->log;
 	__wt_spin_lock(session, &log->log_writelsn_lock);
+
+	/* Handle any completed asynchronous slot writes. */
+	if (log->uring != NULL &&
+	    (ret = __wt_uring_reap(session, log->uring, false)) != 0)
+		WT_PANIC_MSG(session, ret, "log write completion failure");
 restart:
 	coalescing = NULL;
 	WT_INIT_LSN(&save_lsn);
@@ -737,6 +820,21 @@ restart:
 		 /*˵WRITTEN״̬*/
 		if (slot->slot_state != WT_LOG_SLOT_WRITTEN)
 			continue;
+		/*
+		 * A slot whose write is in flight isn't written yet, skip it
+		 * until its request completes.
+		 */
+		if (log->slot_io != NULL) {
+			WT_READ_BARRIER();
+			if (log->slot_io[save_i].pending != 0)
+				continue;
+			if ((ret = log->slot_io[save_i].error) != 0) {
+				WT_PANIC_MSG(session, ret,
+				    "%s: fatal log failure",
+				    slot->slot_fh->name);
+				continue;
+			}
+		}
 		written[written_i].slot_index = save_i;
 		written[written_i++].lsn = slot->slot_release_lsn;
 	}
@@ -888,6 +986,9 @@ __log_wrlsn_server(void *arg)
 		 */
 		if (yield++ < WT_THOUSAND)
 			__wt_yield();
+		else if (log->uring != NULL && log->uring->inflight != 0)
+			/* Sleep until the next write completes. */
+			WT_ERR(__wt_uring_reap(session, log->uring, true));
 		else
 			__wt_cond_auto_wait(
 			    session, conn->log_wrlsn_cond, did_work, NULL);
@@ -897,6 +998,8 @@ __log_wrlsn_server(void *arg)
 	 * be straggling log writes that need to be written.
 	 */
 	WT_ERR(__wt_log_force_write(session, 1, NULL));
+	if (log->uring != NULL)
+		WT_ERR(__wt_uring_drain(session, log->uring));
 	__wt_log_wrlsn(session, NULL);
 	if (0) {
 err:		WT_PANIC_MSG(session, ret, "log wrlsn server error");
@@ -966,6 +1069,25 @@ __log_server(void *arg)
 		 */
 		if (timediff >= WT_THOUSAND || signalled) {
 
+			/*
+			 * Perform the archive first, archived log files may
+			 * be recycled into the pre-allocated files.
+			 */
+			if (FLD_ISSET(conn->log_flags, WT_CONN_LOG_ARCHIVE)) {
+			    /*ɾѾcheckpoint־ļ,ע⣺ʵWTٷlog_archive_lockԼʹʹspin lockҲĲ*/
+				if (__wt_try_writelock(
+				    session, &log->log_archive_lock) == 0) {
+				    /*һ־鵵,൱ɾ־ļ*/
+					ret = __log_archive_once(session, 0);
+					__wt_writeunlock(
+					    session, &log->log_archive_lock);
+					WT_ERR(ret);
+				} else
+					__wt_verbose(session, WT_VERB_LOG, "%s",
+					    "log_archive: Blocked due to open "
+					    "log cursor holding archive lock");
+			}
+
 			/*
 			 * Perform log pre-allocation.
 			 */
@@ -983,24 +1105,6 @@ __log_server(void *arg)
 				    session, &conn->hot_backup_lock);
 				WT_ERR(ret);
 			}
-
-			/*
-			 * Perform the archive.
-			 */
-			if (FLD_ISSET(conn->log_flags, WT_CONN_LOG_ARCHIVE)) {
-			    /*ɾѾcheckpoint־ļ,ע⣺ʵWTٷlog_archive_lockԼʹʹspin lockҲĲ*/
-				if (__wt_try_writelock(
-				    session, &log->log_archive_lock) == 0) {
-				    /*һ־鵵,൱ɾ־ļ*/
-					ret = __log_archive_once(session, 0);
-					__wt_writeunlock(
-					    session, &log->log_archive_lock);
-					WT_ERR(ret);
-				} else
-					__wt_verbose(session, WT_VERB_LOG, "%s",
-					    "log_archive: Blocked due to open "
-					    "log cursor holding archive lock");
-			}
 		}
 
 		/* Wait until the next event. */
@@ -1075,6 +1179,7 @@ __wt_logmgr_create(WT_SESSION_IMPL *session, const char *cfg[])
 	WT_INIT_LSN(&log->write_lsn);
 	WT_INIT_LSN(&log->write_start_lsn);
 	log->fileid = 0;
+	log->streams = conn->log_streams;
 	WT_RET(__logmgr_version(session, false));
 
     //ʼ
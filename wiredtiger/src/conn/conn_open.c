@@ -97,10 +97,11 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 	 * exit before files are closed.
 	 */
 	WT_TRET(__wt_lsm_manager_destroy(session));
+	WT_TRET(__wt_read_ahead_destroy(session));
 
 	/*
-	 * Once the async and LSM threads exit, we shouldn't be opening any
-	 * more files.
+	 * Once the async, LSM and read-ahead threads exit, we shouldn't be
+	 * opening any more files.
 	 */
 	F_SET(conn, WT_CONN_CLOSING_NO_MORE_OPENS);
 	WT_FULL_BARRIER();
@@ -250,6 +251,9 @@ __wt_connection_workers(WT_SESSION_IMPL *session, const char *cfg[])
 	//첽д߳
 	WT_RET(__wt_async_create(session, cfg));
 
+	/* Start the optional read-ahead threads. */
+	WT_RET(__wt_read_ahead_create(session, cfg));
+
 	/* Start the optional checkpoint thread. */
 	WT_RET(__wt_checkpoint_server_create(session, cfg));
 
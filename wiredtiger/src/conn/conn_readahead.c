@@ -0,0 +1,311 @@
+/*-
+ * Copyright (c) 2014-2017 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Number of leaf pages a cursor must move through before it is considered to
+ * be scanning and read-ahead is scheduled on its behalf.
+ */
+#define	WT_READ_AHEAD_DETECT	2
+
+/*
+ * __read_ahead_entry_free --
+ *	Free a read-ahead queue entry.
+ */
+static void
+__read_ahead_entry_free(WT_SESSION_IMPL *session, WT_READ_AHEAD_ENTRY *entry)
+{
+	__wt_free(session, entry->uri);
+	__wt_buf_free(session, &entry->key);
+	__wt_free(session, entry);
+}
+
+/*
+ * __read_ahead_thread_chk --
+ *	Check to decide if a read-ahead thread should continue running.
+ */
+static bool
+__read_ahead_thread_chk(WT_SESSION_IMPL *session)
+{
+	return (S2C(session)->read_ahead_running);
+}
+
+/*
+ * __read_ahead_page --
+ *	Bring a single leaf page into the cache by searching for its first key.
+ */
+static int
+__read_ahead_page(WT_SESSION_IMPL *session, WT_READ_AHEAD_ENTRY *entry)
+{
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	int exact;
+	const char *cfg[] = {
+	    WT_CONFIG_BASE(session, WT_SESSION_open_cursor), NULL };
+
+	WT_RET(__wt_open_cursor(session, entry->uri, NULL, cfg, &cursor));
+
+	if (entry->key.size != 0) {
+		cursor->key.data = entry->key.data;
+		cursor->key.size = entry->key.size;
+	} else
+		cursor->recno = entry->recno;
+	F_SET(cursor, WT_CURSTD_KEY_EXT);
+
+	ret = cursor->search_near(cursor, &exact);
+	if (ret == WT_NOTFOUND)
+		ret = 0;
+	WT_TRET(cursor->close(cursor));
+	return (ret);
+}
+
+/*
+ * __read_ahead_thread_run --
+ *	Entry function for a read-ahead thread.  This is called repeatedly
+ *	from the thread group code so it does not need to loop itself.
+ */
+static int
+__read_ahead_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_READ_AHEAD_ENTRY *entry;
+
+	WT_UNUSED(thread);
+
+	conn = S2C(session);
+
+	__wt_spin_lock(session, &conn->read_ahead_lock);
+	if ((entry = TAILQ_FIRST(&conn->read_ahead_qh)) != NULL) {
+		TAILQ_REMOVE(&conn->read_ahead_qh, entry, q);
+		--conn->read_ahead_queue_len;
+	}
+	__wt_spin_unlock(session, &conn->read_ahead_lock);
+
+	if (entry == NULL) {
+		__wt_cond_wait(session, conn->read_ahead_threads.wait_cond,
+		    10000, __read_ahead_thread_chk);
+		return (0);
+	}
+
+	/*
+	 * The cache may have filled since the page was queued: reading more
+	 * pages would only give eviction more work.
+	 */
+	if (__wt_eviction_needed(session, false, true, NULL))
+		WT_STAT_CONN_INCR(session, cache_read_ahead_skip_cache);
+	else {
+		/*
+		 * Read-ahead is advisory: the object may have been dropped or
+		 * be busy, ignore anything short of a panic.
+		 */
+		if ((ret = __read_ahead_page(session, entry)) == WT_PANIC)
+			WT_TRET(ret);
+		else
+			ret = 0;
+		WT_STAT_CONN_INCR(session, cache_read_ahead_run);
+	}
+
+	__read_ahead_entry_free(session, entry);
+	return (ret);
+}
+
+/*
+ * __wt_read_ahead_create --
+ *	Start the read-ahead threads.
+ */
+int
+__wt_read_ahead_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	WT_RET(__wt_config_gets(session, cfg, "read_ahead.threads", &cval));
+	conn->read_ahead_workers = (uint32_t)cval.val;
+	WT_RET(__wt_config_gets(session, cfg, "read_ahead.pages", &cval));
+
+	/* Read-ahead is disabled unless threads are configured. */
+	if (conn->read_ahead_workers == 0)
+		return (0);
+
+	/* Set first, the threads might run before we finish up. */
+	conn->read_ahead_running = true;
+
+	WT_RET(__wt_thread_group_create(session, &conn->read_ahead_threads,
+	    "read-ahead", conn->read_ahead_workers, conn->read_ahead_workers,
+	    WT_THREAD_CAN_WAIT, __read_ahead_thread_chk,
+	    __read_ahead_thread_run, NULL));
+
+	/* Cursors only schedule read-ahead once the threads are running. */
+	conn->read_ahead_pages = (uint32_t)cval.val;
+
+	return (0);
+}
+
+/*
+ * __wt_read_ahead_destroy --
+ *	Destroy the read-ahead threads and discard any queued work.
+ */
+int
+__wt_read_ahead_destroy(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_READ_AHEAD_ENTRY *entry;
+
+	conn = S2C(session);
+
+	if (conn->read_ahead_running) {
+		conn->read_ahead_pages = 0;
+
+		__wt_writelock(session, &conn->read_ahead_threads.lock);
+
+		conn->read_ahead_running = false;
+		__wt_cond_signal(session, conn->read_ahead_threads.wait_cond);
+
+		WT_TRET(__wt_thread_group_destroy(
+		    session, &conn->read_ahead_threads));
+	}
+
+	while ((entry = TAILQ_FIRST(&conn->read_ahead_qh)) != NULL) {
+		TAILQ_REMOVE(&conn->read_ahead_qh, entry, q);
+		__read_ahead_entry_free(session, entry);
+	}
+	conn->read_ahead_queue_len = 0;
+
+	return (ret);
+}
+
+/*
+ * __read_ahead_queue --
+ *	Queue a leaf page to be read by the read-ahead threads.
+ */
+static int
+__read_ahead_queue(WT_SESSION_IMPL *session, WT_PAGE *home, WT_REF *ref)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_READ_AHEAD_ENTRY *entry;
+	size_t size;
+	const void *p;
+
+	conn = S2C(session);
+
+	if (conn->read_ahead_queue_len >= WT_READ_AHEAD_QUEUE_MAX) {
+		WT_STAT_CONN_INCR(session, cache_read_ahead_skip_queue);
+		return (0);
+	}
+
+	WT_RET(__wt_calloc_one(session, &entry));
+	WT_ERR(__wt_strdup(session, S2BT(session)->dhandle->name, &entry->uri));
+	if (home->type == WT_PAGE_ROW_INT) {
+		__wt_ref_key(home, ref, &p, &size);
+		WT_ERR(__wt_buf_set(session, &entry->key, p, size));
+	} else
+		entry->recno = ref->ref_recno;
+
+	__wt_spin_lock(session, &conn->read_ahead_lock);
+	TAILQ_INSERT_TAIL(&conn->read_ahead_qh, entry, q);
+	++conn->read_ahead_queue_len;
+	__wt_spin_unlock(session, &conn->read_ahead_lock);
+
+	WT_STAT_CONN_INCR(session, cache_read_ahead_queued);
+	return (0);
+
+err:	__read_ahead_entry_free(session, entry);
+	return (ret);
+}
+
+/*
+ * __wt_read_ahead_schedule --
+ *	A scanning cursor has moved to a new leaf page: queue the on-disk leaf
+ *	pages that follow it in the scan direction.
+ */
+void
+__wt_read_ahead_schedule(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt,
+    bool next)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_PAGE *home;
+	WT_PAGE_INDEX *pindex;
+	WT_REF *child, *ref;
+	uint32_t count, slot;
+	bool queued;
+
+	conn = S2C(session);
+	ref = cbt->ref;
+	queued = false;
+
+	if (!F_ISSET(cbt, WT_CBT_READ_AHEAD) &&
+	    ++cbt->read_ahead_leaves < WT_READ_AHEAD_DETECT)
+		return;
+
+	/* Checkpoint cursors can't be re-opened by the read-ahead threads. */
+	if (F_ISSET(cbt, WT_CBT_NO_TXN))
+		return;
+
+	if (__wt_eviction_needed(session, false, true, NULL)) {
+		WT_STAT_CONN_INCR(session, cache_read_ahead_skip_cache);
+		return;
+	}
+
+	/*
+	 * Read-ahead is limited to the siblings of the current leaf page under
+	 * the same parent: the parent's index is stable while we hold a split
+	 * generation and the cursor holds a hazard pointer on the leaf page.
+	 */
+	WT_ENTER_PAGE_INDEX(session);
+	home = ref->home;
+	WT_INTL_INDEX_GET(session, home, pindex);
+	slot = ref->pindex_hint;
+	if (slot >= pindex->entries || pindex->index[slot] != ref)
+		goto done;
+
+	/*
+	 * Skip pages already queued by this cursor: the slot tracks the
+	 * furthest page queued in the scan direction.
+	 */
+	if (cbt->read_ahead_home == home) {
+		if (next && cbt->read_ahead_slot > slot)
+			slot = cbt->read_ahead_slot;
+		if (!next && cbt->read_ahead_slot < slot)
+			slot = cbt->read_ahead_slot;
+	}
+
+	for (count = 0; count < conn->read_ahead_pages; ++count) {
+		if (next) {
+			if (slot + 1 >= pindex->entries)
+				break;
+			++slot;
+		} else {
+			if (slot == 0)
+				break;
+			--slot;
+		}
+		child = pindex->index[slot];
+		if (child->state != WT_REF_DISK)
+			continue;
+		if ((ret = __read_ahead_queue(session, home, child)) != 0)
+			break;
+		queued = true;
+	}
+	cbt->read_ahead_home = home;
+	cbt->read_ahead_slot = slot;
+
+done:	WT_LEAVE_PAGE_INDEX(session);
+
+	/* Read-ahead is advisory, a failure to queue is not an error. */
+	WT_UNUSED(ret);
+
+	if (queued)
+		__wt_cond_signal(session, conn->read_ahead_threads.wait_cond);
+}
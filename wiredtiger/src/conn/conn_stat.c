@@ -86,6 +86,13 @@ __wt_conn_stat_init(WT_SESSION_IMPL *session)
 	    stats, rec_split_stashed_objects, conn->stashed_objects);
 	WT_STAT_SET(session,
 	    stats, rec_split_stashed_bytes, conn->stashed_bytes);
+
+	WT_STAT_SET(session, stats, block_sched_read_active,
+	    conn->block_sched.active[WT_IO_CLASS_READ]);
+	WT_STAT_SET(session, stats, block_sched_evict_active,
+	    conn->block_sched.active[WT_IO_CLASS_EVICT]);
+	WT_STAT_SET(session, stats, block_sched_checkpoint_active,
+	    conn->block_sched.active[WT_IO_CLASS_CHECKPOINT]);
 }
 
 /*
@@ -115,10 +115,13 @@ __wt_curbackup_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_equals_notsup,		/* equals */
 	    __curbackup_next,			/* next */
 	    __wt_cursor_notsup,			/* prev */
+	    __wt_cursor_next_batch_notsup,	/* next-batch */
 	    __curbackup_reset,			/* reset */
 	    __wt_cursor_notsup,			/* search */
 	    __wt_cursor_search_near_notsup,	/* search-near */
+	    __wt_cursor_search_batch_notsup,	/* search-batch */
 	    __wt_cursor_notsup,			/* insert */
+	    __wt_cursor_insert_batch_notsup,	/* insert-batch */
 	    __wt_cursor_modify_notsup,		/* modify */
 	    __wt_cursor_notsup,			/* update */
 	    __wt_cursor_notsup,			/* remove */
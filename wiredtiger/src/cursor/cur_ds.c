@@ -487,10 +487,13 @@ __wt_curds_open(
 	    __wt_cursor_equals,			/* equals */
 	    __curds_next,			/* next */
 	    __curds_prev,			/* prev */
+	    __wt_cursor_next_batch_notsup,	/* next-batch */
 	    __curds_reset,			/* reset */
 	    __curds_search,			/* search */
 	    __curds_search_near,		/* search-near */
+	    __wt_cursor_search_batch_notsup,	/* search-batch */
 	    __curds_insert,			/* insert */
+	    __wt_cursor_insert_batch_notsup,	/* insert-batch */
 	    __wt_cursor_modify_notsup,		/* modify */
 	    __curds_update,			/* update */
 	    __curds_remove,			/* remove */
@@ -365,10 +365,13 @@ __wt_curdump_create(WT_CURSOR *child, WT_CURSOR *owner, WT_CURSOR **cursorp)
 	    __wt_cursor_equals_notsup,		/* equals */
 	    __curdump_next,			/* next */
 	    __curdump_prev,			/* prev */
+	    __wt_cursor_next_batch_notsup,	/* next-batch */
 	    __curdump_reset,			/* reset */
 	    __curdump_search,			/* search */
 	    __curdump_search_near,		/* search-near */
+	    __wt_cursor_search_batch_notsup,	/* search-batch */
 	    __curdump_insert,			/* insert */
+	    __wt_cursor_insert_batch_notsup,	/* insert-batch */
 	    __wt_cursor_modify_notsup,		/* modify */
 	    __curdump_update,			/* update */
 	    __curdump_remove,			/* remove */
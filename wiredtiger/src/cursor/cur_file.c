@@ -145,6 +145,31 @@ __curfile_prev(WT_CURSOR *cursor)
 err:	API_END_RET(session, ret);
 }
 
+/*
+ * __curfile_next_batch --
+ *	WT_CURSOR->next_batch method for the btree cursor type.
+ */
+static int
+__curfile_next_batch(WT_CURSOR *cursor,
+    WT_ITEM *keys, WT_ITEM *values, size_t count, size_t *countp)
+{
+	WT_CURSOR_BTREE *cbt;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	*countp = 0;
+
+	cbt = (WT_CURSOR_BTREE *)cursor;
+	CURSOR_API_CALL(cursor, session, next_batch, cbt->btree);
+	if (count == 0)
+		WT_ERR_MSG(session, EINVAL,
+		    "WT_CURSOR.next_batch requires a non-zero count");
+
+	WT_ERR(__wt_btcur_next_batch(cbt, keys, values, count, countp));
+
+err:	API_END_RET(session, ret);
+}
+
 /*
  * __curfile_reset --
  *	WT_CURSOR->reset method for the btree cursor type.
@@ -219,6 +244,31 @@ __curfile_search_near(WT_CURSOR *cursor, int *exact)
 err:	API_END_RET(session, ret);
 }
 
+/*
+ * __curfile_search_batch --
+ *	WT_CURSOR->search_batch method for the btree cursor type.
+ */
+static int
+__curfile_search_batch(WT_CURSOR *cursor,
+    WT_ITEM *keys, WT_ITEM *values, int *results, size_t count)
+{
+	WT_CURSOR_BTREE *cbt;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	cbt = (WT_CURSOR_BTREE *)cursor;
+	CURSOR_API_CALL(cursor, session, search_batch, cbt->btree);
+
+	WT_ERR(__wt_btcur_search_batch(cbt, keys, values, results, count));
+
+	/* Search-batch maintains no position, key or value. */
+	WT_ASSERT(session,
+	    F_MASK(cursor, WT_CURSTD_KEY_SET) == 0 &&
+	    F_MASK(cursor, WT_CURSTD_VALUE_SET) == 0);
+
+err:	API_END_RET(session, ret);
+}
+
 /*
  * __curfile_insert --
  *	WT_CURSOR->insert method for the btree cursor type.
@@ -256,6 +306,41 @@ err:	CURSOR_UPDATE_API_END(session, ret);
 	return (ret);
 }
 
+/*
+ * __curfile_insert_batch --
+ *	WT_CURSOR->insert_batch method for the btree cursor type.
+ */
+static int
+__curfile_insert_batch(
+    WT_CURSOR *cursor, WT_ITEM *keys, WT_ITEM *values, size_t count)
+{
+	WT_CURSOR_BTREE *cbt;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	cbt = (WT_CURSOR_BTREE *)cursor;
+	CURSOR_UPDATE_API_CALL_BTREE(cursor, session, insert_batch, cbt->btree);
+
+	/*
+	 * Batch keys are always set explicitly, there's no support for
+	 * allocating record numbers.
+	 */
+	if (F_ISSET(cursor, WT_CURSTD_APPEND))
+		WT_ERR_MSG(session, ENOTSUP,
+		    "WT_CURSOR.insert_batch not supported for cursors "
+		    "configured for append");
+
+	WT_ERR(__wt_btcur_insert_batch(cbt, keys, values, count));
+
+	/* Insert-batch maintains no position, key or value. */
+	WT_ASSERT(session,
+	    F_MASK(cursor, WT_CURSTD_KEY_SET) == 0 &&
+	    F_MASK(cursor, WT_CURSTD_VALUE_SET) == 0);
+
+err:	CURSOR_UPDATE_API_END(session, ret);
+	return (ret);
+}
+
 /*
  * __wt_curfile_insert_check --
  *	WT_CURSOR->insert_check method for the btree cursor type.
@@ -476,10 +561,13 @@ __curfile_create(WT_SESSION_IMPL *session,
 	    __curfile_equals,			/* equals */
 	    __curfile_next,			/* next */
 	    __curfile_prev,			/* prev */
+	    __curfile_next_batch,		/* next-batch */
 	    __curfile_reset,			/* reset */
 	    __curfile_search,			/* search */
 	    __curfile_search_near,		/* search-near */
+	    __curfile_search_batch,		/* search-batch */
 	    __curfile_insert,			/* insert */
+	    __curfile_insert_batch,		/* insert-batch */
 	    __wt_cursor_modify_notsup,		/* modify */
 	    __curfile_update,			/* update */
 	    __curfile_remove,			/* remove */
@@ -556,6 +644,11 @@ __curfile_create(WT_SESSION_IMPL *session,
 			cbt->next_random_sample_size = (u_int)cval.val;
 	}
 
+	/* Optionally start read-ahead without waiting to detect a scan. */
+	WT_ERR(__wt_config_gets_def(session, cfg, "read_ahead", 0, &cval));
+	if (cval.val != 0)
+		F_SET(cbt, WT_CBT_READ_AHEAD);
+
 	/* Underlying btree initialization. */
 	__wt_btcur_open(cbt);
 
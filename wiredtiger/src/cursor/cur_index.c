@@ -445,10 +445,13 @@ __wt_curindex_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_equals,			/* equals */
 	    __curindex_next,			/* next */
 	    __curindex_prev,			/* prev */
+	    __wt_cursor_next_batch_notsup,	/* next-batch */
 	    __curindex_reset,			/* reset */
 	    __curindex_search,			/* search */
 	    __curindex_search_near,		/* search-near */
+	    __wt_cursor_search_batch_notsup,	/* search-batch */
 	    __wt_cursor_notsup,			/* insert */
+	    __wt_cursor_insert_batch_notsup,	/* insert-batch */
 	    __wt_cursor_modify_notsup,		/* modify */
 	    __wt_cursor_notsup,			/* update */
 	    __wt_cursor_notsup,			/* remove */
@@ -587,10 +587,13 @@ __curjoin_entry_member(WT_SESSION_IMPL *session, WT_CURSOR_JOIN_ENTRY *entry,
 	    __wt_cursor_equals_notsup,		/* equals */
 	    __wt_cursor_notsup,			/* next */
 	    __wt_cursor_notsup,			/* prev */
+	    __wt_cursor_next_batch_notsup,	/* next-batch */
 	    __wt_cursor_notsup,			/* reset */
 	    __wt_cursor_notsup,			/* search */
 	    __wt_cursor_search_near_notsup,	/* search-near */
+	    __wt_cursor_search_batch_notsup,	/* search-batch */
 	    __curjoin_extract_insert,		/* insert */
+	    __wt_cursor_insert_batch_notsup,	/* insert-batch */
 	    __wt_cursor_modify_notsup,		/* modify */
 	    __wt_cursor_notsup,			/* update */
 	    __wt_cursor_notsup,			/* remove */
@@ -1292,10 +1295,13 @@ __wt_curjoin_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_equals_notsup,		/* equals */
 	    __curjoin_next,			/* next */
 	    __wt_cursor_notsup,			/* prev */
+	    __wt_cursor_next_batch_notsup,	/* next-batch */
 	    __curjoin_reset,			/* reset */
 	    __wt_cursor_notsup,			/* search */
 	    __wt_cursor_search_near_notsup,	/* search-near */
+	    __wt_cursor_search_batch_notsup,	/* search-batch */
 	    __wt_cursor_notsup,			/* insert */
+	    __wt_cursor_insert_batch_notsup,	/* insert-batch */
 	    __wt_cursor_modify_notsup,		/* modify */
 	    __wt_cursor_notsup,			/* update */
 	    __wt_cursor_notsup,			/* remove */
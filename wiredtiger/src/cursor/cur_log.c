@@ -85,13 +85,25 @@ err:	API_END_RET(session, ret);
 
 }
 
+/*
+ * __curlog_item_set --
+ *	Set an item to reference data in the cursor's copy of a log record.
+ */
+static inline void
+__curlog_item_set(WT_ITEM *item, const void *data, size_t size)
+{
+	item->data = data;
+	item->size = size;
+}
+
 /*
  * __curlog_op_read --
  *	Read out any key/value from an individual operation record
  *	in the log.  We're only interested in put and remove operations
  *	since truncate is not a cursor operation.  All successful
- *	returns from this function will have set up the cursor copy of
- *	key and value to give the user.
+ *	returns from this function will have set up the cursor's key
+ *	and value to give the user: they reference the cursor's copy of
+ *	the log record, except for record numbers.
  */
 static int
 __curlog_op_read(WT_SESSION_IMPL *session,
@@ -108,41 +120,37 @@ __curlog_op_read(WT_SESSION_IMPL *session,
 		WT_RET(__wt_logop_col_modify_unpack(session, &pp, end,
 		    fileid, &recno, &value));
 		WT_RET(__wt_buf_set(session, cl->opkey, &recno, sizeof(recno)));
-		WT_RET(__wt_buf_set(session,
-		    cl->opvalue, value.data, value.size));
+		__curlog_item_set(cl->opvalue, value.data, value.size);
 		break;
 	case WT_LOGOP_COL_PUT:
 		WT_RET(__wt_logop_col_put_unpack(session, &pp, end,
 		    fileid, &recno, &value));
 		WT_RET(__wt_buf_set(session, cl->opkey, &recno, sizeof(recno)));
-		WT_RET(__wt_buf_set(session,
-		    cl->opvalue, value.data, value.size));
+		__curlog_item_set(cl->opvalue, value.data, value.size);
 		break;
 	case WT_LOGOP_COL_REMOVE:
 		WT_RET(__wt_logop_col_remove_unpack(session, &pp, end,
 		    fileid, &recno));
 		WT_RET(__wt_buf_set(session, cl->opkey, &recno, sizeof(recno)));
-		WT_RET(__wt_buf_set(session, cl->opvalue, NULL, 0));
+		__curlog_item_set(cl->opvalue, NULL, 0);
 		break;
 	case WT_LOGOP_ROW_MODIFY:
 		WT_RET(__wt_logop_row_modify_unpack(session, &pp, end,
 		    fileid, &key, &value));
-		WT_RET(__wt_buf_set(session, cl->opkey, key.data, key.size));
-		WT_RET(__wt_buf_set(session,
-		    cl->opvalue, value.data, value.size));
+		__curlog_item_set(cl->opkey, key.data, key.size);
+		__curlog_item_set(cl->opvalue, value.data, value.size);
 		break;
 	case WT_LOGOP_ROW_PUT:
 		WT_RET(__wt_logop_row_put_unpack(session, &pp, end,
 		    fileid, &key, &value));
-		WT_RET(__wt_buf_set(session, cl->opkey, key.data, key.size));
-		WT_RET(__wt_buf_set(session,
-		    cl->opvalue, value.data, value.size));
+		__curlog_item_set(cl->opkey, key.data, key.size);
+		__curlog_item_set(cl->opvalue, value.data, value.size);
 		break;
 	case WT_LOGOP_ROW_REMOVE:
 		WT_RET(__wt_logop_row_remove_unpack(session, &pp, end,
 		    fileid, &key));
-		WT_RET(__wt_buf_set(session, cl->opkey, key.data, key.size));
-		WT_RET(__wt_buf_set(session, cl->opvalue, NULL, 0));
+		__curlog_item_set(cl->opkey, key.data, key.size);
+		__curlog_item_set(cl->opvalue, NULL, 0);
 		break;
 	default:
 		/*
@@ -150,36 +158,31 @@ __curlog_op_read(WT_SESSION_IMPL *session,
 		 * and an empty key.
 		 */
 		*fileid = 0;
-		WT_RET(__wt_buf_set(session, cl->opkey, NULL, 0));
-		WT_RET(__wt_buf_set(session, cl->opvalue, cl->stepp, opsize));
+		__curlog_item_set(cl->opkey, NULL, 0);
+		__curlog_item_set(cl->opvalue, cl->stepp, opsize);
 	}
 	return (0);
 }
 
 /*
- * __curlog_kv --
- *	Set the key and value of the log cursor to return to the user.
+ * __curlog_step --
+ *	Step to the next part of the log record, setting up the operation key
+ *	and value to return to the user.
  */
 static int
-__curlog_kv(WT_SESSION_IMPL *session, WT_CURSOR *cursor)
+__curlog_step(WT_SESSION_IMPL *session, WT_CURSOR_LOG *cl,
+    uint32_t *key_countp, uint32_t *optypep, uint32_t *fileidp)
 {
-	WT_CURSOR_LOG *cl;
-	WT_DECL_RET;
-	uint32_t fileid, key_count, opsize, optype, raw;
-
-	cl = (WT_CURSOR_LOG *)cursor;
-	/* Temporarily turn off raw so we can do direct cursor operations. */
-	raw = F_MASK(cursor, WT_CURSTD_RAW);
-	F_CLR(cursor, WT_CURSTD_RAW);
+	uint32_t fileid, key_count, opsize, optype;
 
 	/*
 	 * If it is a commit and we have stepped over the header, peek to get
 	 * the size and optype and read out any key/value from this operation.
 	 */
 	if ((key_count = cl->step_count++) > 0) {
-		WT_ERR(__wt_logop_read(session,
+		WT_RET(__wt_logop_read(session,
 		    &cl->stepp, cl->stepp_end, &optype, &opsize));
-		WT_ERR(__curlog_op_read(session, cl, optype, opsize, &fileid));
+		WT_RET(__curlog_op_read(session, cl, optype, opsize, &fileid));
 		/* Position on the beginning of the next record part. */
 		cl->stepp += opsize;
 	} else {
@@ -195,6 +198,29 @@ __curlog_kv(WT_SESSION_IMPL *session, WT_CURSOR *cursor)
 		cl->opvalue->data = WT_LOG_SKIP_HEADER(cl->logrec->data) + 1;
 		cl->opvalue->size = WT_LOG_REC_SIZE(cl->logrec->size) - 1;
 	}
+	*key_countp = key_count;
+	*optypep = optype;
+	*fileidp = fileid;
+	return (0);
+}
+
+/*
+ * __curlog_kv --
+ *	Set the key and value of the log cursor to return to the user.
+ */
+static int
+__curlog_kv(WT_SESSION_IMPL *session, WT_CURSOR *cursor)
+{
+	WT_CURSOR_LOG *cl;
+	WT_DECL_RET;
+	uint32_t fileid, key_count, optype, raw;
+
+	cl = (WT_CURSOR_LOG *)cursor;
+	/* Temporarily turn off raw so we can do direct cursor operations. */
+	raw = F_MASK(cursor, WT_CURSTD_RAW);
+	F_CLR(cursor, WT_CURSTD_RAW);
+
+	WT_ERR(__curlog_step(session, cl, &key_count, &optype, &fileid));
 	/*
 	 * The log cursor sets the LSN and step count as the cursor key and
 	 * and log record related data in the value.  The data in the value
@@ -209,6 +235,116 @@ err:	F_SET(cursor, raw);
 	return (ret);
 }
 
+/*
+ * __curlog_read --
+ *	Read the log record following the cursor's position.  At the end of
+ *	the log, a tailing cursor waits for more records to be written.
+ */
+static int
+__curlog_read(WT_SESSION_IMPL *session, WT_CURSOR_LOG *cl,
+    struct timespec *startp)
+{
+	struct timespec now;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_LOG *log;
+	WT_LSN write_lsn;
+
+	conn = S2C(session);
+	log = conn->log;
+
+	for (;;) {
+		if (log != NULL)
+			write_lsn = log->write_lsn;
+		cl->txnid = 0;
+		ret = __wt_log_scan(session, cl->next_lsn, WT_LOGSCAN_ONE,
+		    __curlog_logrec, cl);
+		if (ret == ENOENT)
+			ret = WT_NOTFOUND;
+		if (ret != WT_NOTFOUND ||
+		    log == NULL || startp == NULL || cl->tail_wait == 0)
+			return (ret);
+
+		/*
+		 * Have the log server write out any buffered records, then
+		 * wait for the log to be written past where it was when we
+		 * looked.
+		 */
+		if (conn->log_cond != NULL)
+			__wt_cond_signal(session, conn->log_cond);
+		while (__wt_log_cmp(&log->write_lsn, &write_lsn) <= 0) {
+			__wt_epoch(session, &now);
+			if (WT_TIMEDIFF_MS(now, *startp) >= cl->tail_wait)
+				return (WT_NOTFOUND);
+			__wt_cond_wait(
+			    session, log->log_write_cond, 10000, NULL);
+		}
+	}
+}
+
+/*
+ * __curlog_skip --
+ *	Check if the cursor's next entry is filtered out by the cursor's
+ *	target files and if so, step over it.
+ */
+static int
+__curlog_skip(WT_SESSION_IMPL *session, WT_CURSOR_LOG *cl, bool *skipp)
+{
+	uint32_t fileid, opsize, optype;
+	u_int i;
+
+	*skipp = false;
+	if (cl->fileids == NULL)
+		return (0);
+
+	/*
+	 * Only the operations of commit records are returned, not the records
+	 * themselves.  Operations on files start with the file ID.
+	 */
+	*skipp = true;
+	if (cl->step_count == 0) {
+		++cl->step_count;
+		return (0);
+	}
+	WT_RET(__wt_struct_unpack(session, cl->stepp,
+	    WT_PTRDIFF(cl->stepp_end, cl->stepp), WT_UNCHECKED_STRING(III),
+	    &optype, &opsize, &fileid));
+	for (i = 0; i < cl->fileid_count; i++)
+		if (cl->fileids[i] == fileid) {
+			*skipp = false;
+			return (0);
+		}
+	cl->stepp += opsize;
+	++cl->step_count;
+	return (0);
+}
+
+/*
+ * __curlog_next_entry --
+ *	Move the cursor to its next entry.
+ */
+static int
+__curlog_next_entry(WT_SESSION_IMPL *session, WT_CURSOR_LOG *cl,
+    struct timespec *startp)
+{
+	bool skip;
+
+	for (;;) {
+		/*
+		 * If we don't have a record, or went to the end of the record
+		 * we have, or we are in the zero-fill portion of the record,
+		 * get a new one.
+		 */
+		if (cl->stepp == NULL ||
+		    cl->stepp >= cl->stepp_end || !*cl->stepp)
+			WT_RET(__curlog_read(session, cl, startp));
+		WT_ASSERT(session, cl->logrec->data != NULL);
+		WT_RET(__curlog_skip(session, cl, &skip));
+		if (!skip)
+			return (0);
+	}
+}
+
 /*
  * __curlog_next --
  *	WT_CURSOR.next method for the step log cursor type.
@@ -216,6 +352,7 @@ err:	F_SET(cursor, raw);
 static int
 __curlog_next(WT_CURSOR *cursor)
 {
+	struct timespec start;
 	WT_CURSOR_LOG *cl;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
@@ -224,20 +361,9 @@ __curlog_next(WT_CURSOR *cursor)
 
 	CURSOR_API_CALL(cursor, session, next, NULL);
 
-	/*
-	 * If we don't have a record, or went to the end of the record we
-	 * have, or we are in the zero-fill portion of the record, get a
-	 * new one.
-	 */
-	if (cl->stepp == NULL || cl->stepp >= cl->stepp_end || !*cl->stepp) {
-		cl->txnid = 0;
-		ret = __wt_log_scan(session, cl->next_lsn, WT_LOGSCAN_ONE,
-		    __curlog_logrec, cl);
-		if (ret == ENOENT)
-			ret = WT_NOTFOUND;
-		WT_ERR(ret);
-	}
-	WT_ASSERT(session, cl->logrec->data != NULL);
+	if (cl->tail_wait != 0)
+		__wt_epoch(session, &start);
+	WT_ERR(__curlog_next_entry(session, cl, &start));
 	WT_ERR(__curlog_kv(session, cursor));
 	WT_STAT_CONN_INCR(session, cursor_next);
 	WT_STAT_DATA_INCR(session, cursor_next);
@@ -246,6 +372,104 @@ err:	API_END_RET(session, ret);
 
 }
 
+/*
+ * __curlog_batch_pack --
+ *	Append the packed key and value of the cursor's entry to the batch
+ *	buffer.  The buffer may be reallocated as it grows, so the items are
+ *	set to offsets and the caller converts them to pointers when it's done.
+ */
+static int
+__curlog_batch_pack(WT_SESSION_IMPL *session, WT_CURSOR_LOG *cl,
+    WT_ITEM *key, WT_ITEM *value,
+    uint32_t key_count, uint32_t optype, uint32_t fileid)
+{
+	WT_ITEM *buf;
+	size_t key_size, value_size;
+	uint8_t *p;
+
+	buf = &cl->batch;
+	WT_RET(__wt_struct_size(session, &key_size, WT_LOGC_KEY_FORMAT,
+	    cl->cur_lsn->l.file, cl->cur_lsn->l.offset, key_count));
+	WT_RET(__wt_struct_size(session, &value_size, WT_LOGC_VALUE_FORMAT,
+	    cl->txnid, cl->rectype, optype, fileid, cl->opkey, cl->opvalue));
+	WT_RET(__wt_buf_extend(session, buf, buf->size + key_size + value_size));
+
+	p = (uint8_t *)buf->mem + buf->size;
+	WT_RET(__wt_struct_pack(session, p, key_size, WT_LOGC_KEY_FORMAT,
+	    cl->cur_lsn->l.file, cl->cur_lsn->l.offset, key_count));
+	key->data = (void *)(uintptr_t)buf->size;
+	key->size = key_size;
+	buf->size += key_size;
+
+	p += key_size;
+	WT_RET(__wt_struct_pack(session, p, value_size, WT_LOGC_VALUE_FORMAT,
+	    cl->txnid, cl->rectype, optype, fileid, cl->opkey, cl->opvalue));
+	value->data = (void *)(uintptr_t)buf->size;
+	value->size = value_size;
+	buf->size += value_size;
+	return (0);
+}
+
+/*
+ * __curlog_next_batch --
+ *	WT_CURSOR.next_batch method for the log cursor type.
+ */
+static int
+__curlog_next_batch(WT_CURSOR *cursor,
+    WT_ITEM *keys, WT_ITEM *values, size_t count, size_t *countp)
+{
+	struct timespec start;
+	WT_CURSOR_LOG *cl;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	size_t i, n;
+	uint32_t fileid, key_count, optype;
+
+	cl = (WT_CURSOR_LOG *)cursor;
+	*countp = 0;
+
+	CURSOR_API_CALL(cursor, session, next_batch, NULL);
+	if (count == 0)
+		WT_ERR_MSG(session, EINVAL,
+		    "WT_CURSOR.next_batch requires a non-zero count");
+
+	WT_STAT_CONN_INCR(session, cursor_next_batch);
+	WT_STAT_DATA_INCR(session, cursor_next_batch);
+
+	/*
+	 * The keys and values of the entries are packed straight from the
+	 * log records: a tailing cursor only waits for records if it has
+	 * nothing to return.
+	 */
+	F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+	WT_ERR(__wt_buf_init(session, &cl->batch, 0));
+	if (cl->tail_wait != 0)
+		__wt_epoch(session, &start);
+	for (n = 0; n < count; ++n) {
+		if ((ret = __curlog_next_entry(
+		    session, cl, n == 0 ? &start : NULL)) != 0)
+			break;
+		WT_ERR(__curlog_step(
+		    session, cl, &key_count, &optype, &fileid));
+		WT_ERR(__curlog_batch_pack(session, cl,
+		    &keys[n], &values[n], key_count, optype, fileid));
+	}
+	if (ret == WT_NOTFOUND && n != 0)
+		ret = 0;
+	WT_ERR(ret);
+
+	/* The buffer is no longer growing, convert offsets to pointers. */
+	for (i = 0; i < n; ++i) {
+		keys[i].data =
+		    (uint8_t *)cl->batch.mem + (uintptr_t)keys[i].data;
+		values[i].data =
+		    (uint8_t *)cl->batch.mem + (uintptr_t)values[i].data;
+	}
+	*countp = n;
+
+err:	API_END_RET(session, ret);
+}
+
 /*
  * __curlog_search --
  *	WT_CURSOR.search method for the log cursor type.
@@ -329,12 +553,103 @@ __curlog_close(WT_CURSOR *cursor)
 	__wt_scr_free(session, &cl->opvalue);
 	__wt_free(session, cl->packed_key);
 	__wt_free(session, cl->packed_value);
+	__wt_buf_free(session, &cl->batch);
+	__wt_free(session, cl->fileids);
 
 	WT_TRET(__wt_cursor_close(cursor));
 
 err:	API_END_RET(session, ret);
 }
 
+/*
+ * __curlog_target_add --
+ *	Add the files underlying a URI to the log cursor's target files.
+ */
+static int
+__curlog_target_add(WT_SESSION_IMPL *session, WT_CURSOR_LOG *cl,
+    const char *uri)
+{
+	WT_COLGROUP *colgroup;
+	WT_CONFIG_ITEM cval;
+	WT_DECL_RET;
+	WT_INDEX *idx;
+	WT_TABLE *table;
+	u_int i;
+	char *value;
+
+	table = NULL;
+	value = NULL;
+
+	if (WT_PREFIX_MATCH(uri, "file:")) {
+		if ((ret = __wt_metadata_search(session, uri, &value)) ==
+		    WT_NOTFOUND)
+			WT_ERR_MSG(session, ENOENT, "%s: not found", uri);
+		WT_ERR(ret);
+		WT_ERR(__wt_config_getones(session, value, "id", &cval));
+		WT_ERR(__wt_realloc_def(session, &cl->fileids_allocated,
+		    cl->fileid_count + 1, &cl->fileids));
+		cl->fileids[cl->fileid_count++] = (uint32_t)cval.val;
+	} else if (WT_PREFIX_MATCH(uri, "colgroup:")) {
+		WT_ERR(__wt_schema_get_colgroup(
+		    session, uri, false, NULL, &colgroup));
+		WT_ERR(__curlog_target_add(session, cl, colgroup->source));
+	} else if (WT_PREFIX_MATCH(uri, "index:")) {
+		WT_ERR(__wt_schema_get_index(session, uri, false, false, &idx));
+		WT_ERR(__curlog_target_add(session, cl, idx->source));
+	} else if (WT_PREFIX_MATCH(uri, "table:")) {
+		WT_ERR(__wt_schema_get_table_uri(
+		    session, uri, false, 0, &table));
+		for (i = 0; i < WT_COLGROUPS(table); i++)
+			WT_ERR(__curlog_target_add(
+			    session, cl, table->cgroups[i]->source));
+		WT_ERR(__wt_schema_open_indices(session, table));
+		for (i = 0; i < table->nindices; i++)
+			WT_ERR(__curlog_target_add(
+			    session, cl, table->indices[i]->source));
+	} else
+		WT_ERR_MSG(session, ENOTSUP,
+		    "%s: log cursor targets must be tables, column groups, "
+		    "indices or files", uri);
+
+err:	if (table != NULL)
+		WT_TRET(__wt_schema_release_table(session, table));
+	__wt_free(session, value);
+	return (ret);
+}
+
+/*
+ * __curlog_targets --
+ *	Configure the files a log cursor returns operations for.
+ */
+static int
+__curlog_targets(WT_SESSION_IMPL *session, WT_CURSOR_LOG *cl,
+    const char *cfg[])
+{
+	WT_CONFIG targetconf;
+	WT_CONFIG_ITEM cval, k, v;
+	WT_DECL_ITEM(tmp);
+	WT_DECL_RET;
+	const char *uri;
+
+	WT_RET(__wt_config_gets_def(session, cfg, "target", 0, &cval));
+	__wt_config_subinit(session, &targetconf, &cval);
+	while ((ret = __wt_config_next(&targetconf, &k, &v)) == 0) {
+		if (tmp == NULL)
+			WT_ERR(__wt_scr_alloc(session, 512, &tmp));
+		WT_ERR(__wt_buf_fmt(session, tmp, "%.*s", (int)k.len, k.str));
+		uri = tmp->data;
+		if (v.len != 0)
+			WT_ERR_MSG(session, EINVAL,
+			    "%s: invalid log cursor target: URIs may need "
+			    "quoting", uri);
+		WT_ERR(__curlog_target_add(session, cl, uri));
+	}
+	WT_ERR_NOTFOUND_OK(ret);
+
+err:	__wt_scr_free(session, &tmp);
+	return (ret);
+}
+
 /*
  * __wt_curlog_open --
  *	Initialize a log cursor.
@@ -344,6 +659,7 @@ __wt_curlog_open(WT_SESSION_IMPL *session,
     const char *uri, const char *cfg[], WT_CURSOR **cursorp)
 {
 	WT_CONNECTION_IMPL *conn;
+	WT_CONFIG_ITEM cval;
 	WT_CURSOR_STATIC_INIT(iface,
 	    __wt_cursor_get_key,		/* get-key */
 	    __wt_cursor_get_value,		/* get-value */
@@ -353,10 +669,13 @@ __wt_curlog_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_equals,			/* equals */
 	    __curlog_next,			/* next */
 	    __wt_cursor_notsup,			/* prev */
+	    __curlog_next_batch,		/* next-batch */
 	    __curlog_reset,			/* reset */
 	    __curlog_search,			/* search */
 	    __wt_cursor_search_near_notsup,	/* search-near */
+	    __wt_cursor_search_batch_notsup,	/* search-batch */
 	    __wt_cursor_notsup,			/* insert */
+	    __wt_cursor_insert_batch_notsup,	/* insert-batch */
 	    __wt_cursor_modify_notsup,		/* modify */
 	    __wt_cursor_notsup,			/* update */
 	    __wt_cursor_notsup,			/* remove */
@@ -388,6 +707,10 @@ __wt_curlog_open(WT_SESSION_IMPL *session,
 	WT_INIT_LSN(cl->cur_lsn);
 	WT_INIT_LSN(cl->next_lsn);
 
+	WT_ERR(__wt_config_gets_def(session, cfg, "tail_wait", 0, &cval));
+	cl->tail_wait = (uint64_t)cval.val;
+	WT_ERR(__curlog_targets(session, cl, cfg));
+
 	WT_ERR(__wt_cursor_init(cursor, uri, NULL, cfg, cursorp));
 
 	if (log != NULL) {
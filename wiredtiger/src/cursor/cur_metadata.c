@@ -546,10 +546,13 @@ __wt_curmetadata_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_equals,			/* equals */
 	    __curmetadata_next,			/* next */
 	    __curmetadata_prev,			/* prev */
+	    __wt_cursor_next_batch_notsup,	/* next-batch */
 	    __curmetadata_reset,		/* reset */
 	    __curmetadata_search,		/* search */
 	    __curmetadata_search_near,		/* search-near */
+	    __wt_cursor_search_batch_notsup,	/* search-batch */
 	    __curmetadata_insert,		/* insert */
+	    __wt_cursor_insert_batch_notsup,	/* insert-batch */
 	    __wt_cursor_modify_notsup,		/* modify */
 	    __curmetadata_update,		/* update */
 	    __curmetadata_remove,		/* remove */
@@ -578,10 +578,13 @@ __wt_curstat_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_equals_notsup,		/* equals */
 	    __curstat_next,			/* next */
 	    __curstat_prev,			/* prev */
+	    __wt_cursor_next_batch_notsup,	/* next-batch */
 	    __curstat_reset,			/* reset */
 	    __curstat_search,			/* search */
 	    __wt_cursor_search_near_notsup,	/* search-near */
+	    __wt_cursor_search_batch_notsup,	/* search-batch */
 	    __wt_cursor_notsup,			/* insert */
+	    __wt_cursor_insert_batch_notsup,	/* insert-batch */
 	    __wt_cursor_modify_notsup,		/* modify */
 	    __wt_cursor_notsup,			/* update */
 	    __wt_cursor_notsup,			/* remove */
@@ -102,6 +102,53 @@ __wt_cursor_modify_notsup(WT_CURSOR *cursor, WT_MODIFY *entries, int nentries)
 	return (__wt_cursor_notsup(cursor));
 }
 
+/*
+ * __wt_cursor_next_batch_notsup --
+ *	Unsupported cursor next-batch.
+ */
+int
+__wt_cursor_next_batch_notsup(WT_CURSOR *cursor,
+    WT_ITEM *keys, WT_ITEM *values, size_t count, size_t *countp)
+{
+	WT_UNUSED(keys);
+	WT_UNUSED(values);
+	WT_UNUSED(count);
+	WT_UNUSED(countp);
+
+	return (__wt_cursor_notsup(cursor));
+}
+
+/*
+ * __wt_cursor_insert_batch_notsup --
+ *	Unsupported cursor insert-batch.
+ */
+int
+__wt_cursor_insert_batch_notsup(
+    WT_CURSOR *cursor, WT_ITEM *keys, WT_ITEM *values, size_t count)
+{
+	WT_UNUSED(keys);
+	WT_UNUSED(values);
+	WT_UNUSED(count);
+
+	return (__wt_cursor_notsup(cursor));
+}
+
+/*
+ * __wt_cursor_search_batch_notsup --
+ *	Unsupported cursor search-batch.
+ */
+int
+__wt_cursor_search_batch_notsup(WT_CURSOR *cursor,
+    WT_ITEM *keys, WT_ITEM *values, int *results, size_t count)
+{
+	WT_UNUSED(keys);
+	WT_UNUSED(values);
+	WT_UNUSED(results);
+	WT_UNUSED(count);
+
+	return (__wt_cursor_notsup(cursor));
+}
+
 /*
  * __wt_cursor_search_near_notsup --
  *	Unsupported cursor search-near.
@@ -142,13 +189,16 @@ __wt_cursor_set_notsup(WT_CURSOR *cursor)
 	 */
 	cursor->compare = __wt_cursor_compare_notsup;
 	cursor->insert = __wt_cursor_notsup;
+	cursor->insert_batch = __wt_cursor_insert_batch_notsup;
 	cursor->modify = __wt_cursor_modify_notsup;
 	cursor->next = __wt_cursor_notsup;
+	cursor->next_batch = __wt_cursor_next_batch_notsup;
 	cursor->prev = __wt_cursor_notsup;
 	cursor->remove = __wt_cursor_notsup;
 	cursor->reserve = __wt_cursor_notsup;
 	cursor->reset = __wt_cursor_noop;
 	cursor->search = __wt_cursor_notsup;
+	cursor->search_batch = __wt_cursor_search_batch_notsup;
 	cursor->search_near = __wt_cursor_search_near_notsup;
 	cursor->update = __wt_cursor_notsup;
 }
@@ -88,10 +88,13 @@ __wt_apply_single_idx(WT_SESSION_IMPL *session, WT_INDEX *idx,
 	    __wt_cursor_equals_notsup,		/* equals */
 	    __wt_cursor_notsup,			/* next */
 	    __wt_cursor_notsup,			/* prev */
+	    __wt_cursor_next_batch_notsup,	/* next-batch */
 	    __wt_cursor_notsup,			/* reset */
 	    __wt_cursor_notsup,			/* search */
 	    __wt_cursor_search_near_notsup,	/* search-near */
+	    __wt_cursor_search_batch_notsup,	/* search-batch */
 	    __curextract_insert,		/* insert */
+	    __wt_cursor_insert_batch_notsup,	/* insert-batch */
 	    __wt_cursor_modify_notsup,		/* modify */
 	    __wt_cursor_notsup,			/* update */
 	    __wt_cursor_notsup,			/* remove */
@@ -959,10 +962,13 @@ __wt_curtable_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_equals,			/* equals */
 	    __curtable_next,			/* next */
 	    __curtable_prev,			/* prev */
+	    __wt_cursor_next_batch_notsup,	/* next-batch */
 	    __curtable_reset,			/* reset */
 	    __curtable_search,			/* search */
 	    __curtable_search_near,		/* search-near */
+	    __wt_cursor_search_batch_notsup,	/* search-batch */
 	    __curtable_insert,			/* insert */
+	    __wt_cursor_insert_batch_notsup,	/* insert-batch */
 	    __wt_cursor_modify_notsup,		/* modify */
 	    __curtable_update,			/* update */
 	    __curtable_remove,			/* remove */
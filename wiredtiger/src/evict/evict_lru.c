@@ -65,10 +65,12 @@ static inline uint64_t
 __evict_entry_priority(WT_SESSION_IMPL *session, WT_REF *ref)
 {
 	WT_BTREE *btree;
+	WT_CACHE *cache;
 	WT_PAGE *page;
 	uint64_t read_gen;
 
 	btree = S2BT(session);
+	cache = S2C(session)->cache;
 	page = ref->page;
 
 	/* Any page set to the oldest generation should be discarded. */
@@ -98,6 +100,16 @@ __evict_entry_priority(WT_SESSION_IMPL *session, WT_REF *ref)
 	else
 		read_gen = page->read_gen;
 
+	/*
+	 * With the scan-resistant policy, hot pages are only queued when
+	 * eviction is aggressive, skew them by the range of read generations
+	 * in the cache so the pages referenced once still go first.
+	 */
+	if (cache->evict_policy == WT_EVICT_POLICY_SCAN_RESISTANT &&
+	    page->evict_class == WT_PAGE_EVICT_HOT &&
+	    cache->read_gen > cache->read_gen_oldest)
+		read_gen += cache->read_gen - cache->read_gen_oldest;
+
 	read_gen += btree->evict_priority;
 
 #define	WT_EVICT_INTL_SKEW 1000
@@ -169,7 +181,7 @@ __wt_evict_list_clear_page(WT_SESSION_IMPL *session, WT_REF *ref)
 
 	found = false;
 	//evict_queues[]
-	for (q = 0; q < WT_EVICT_QUEUE_MAX && !found; q++) {
+	for (q = 0; q < cache->evict_queue_count && !found; q++) {
 		__wt_spin_lock(session, &cache->evict_queues[q].evict_lock);
 		elem = cache->evict_queues[q].evict_max;
 		//ΪʲôûаѸevict entryڵevict_queueժ??ֻȡentryref pageĹ
@@ -223,6 +235,52 @@ __evict_queue_full(WT_EVICT_QUEUE *queue)
 	    queue->evict_candidates != 0);
 }
 
+/*
+ * __wt_evict_queue_depth --
+ *	Return the number of candidates remaining in a queue.
+ *	Note: reading without locking.
+ */
+uint32_t
+__wt_evict_queue_depth(WT_EVICT_QUEUE *queue)
+{
+	WT_EVICT_ENTRY *current;
+	uint32_t candidates, used;
+
+	WT_ORDERED_READ(current, queue->evict_current);
+	if (current == NULL)
+		return (0);
+	candidates = queue->evict_candidates;
+	used = (uint32_t)(current - queue->evict_queue);
+	return (used >= candidates ? 0 : candidates - used);
+}
+
+/*
+ * __evict_shard_home --
+ *	Return the shard a thread takes eviction candidates from first.
+ */
+static inline u_int
+__evict_shard_home(WT_SESSION_IMPL *session, WT_CACHE *cache)
+{
+	u_int nodes;
+
+	if (cache->evict_shard_count == 1)
+		return (0);
+	if ((nodes = cache->evict_numa_nodes) == 0)
+		return (session->id % cache->evict_shard_count);
+
+	/*
+	 * Shard N serves NUMA node (N % nodes): spread sessions across the
+	 * shards of the node the thread is running on. Finding the node is a
+	 * system call, don't do it on every call.
+	 */
+	if (session->evict_shard_check-- == 0) {
+		session->evict_shard = __wt_numa_node_current() % nodes +
+		    nodes * (session->id % (cache->evict_shard_count / nodes));
+		session->evict_shard_check = WT_EVICT_SHARD_CHECK;
+	}
+	return (session->evict_shard);
+}
+
 /*
  * __wt_evict_server_wake --
  *	Wake the eviction server thread.
@@ -928,7 +986,7 @@ __wt_evict_file_exclusive_on(WT_SESSION_IMPL *session)
 	__wt_spin_lock(session, &cache->evict_queue_lock);
 
     /*btreeevict lru listеevict entry*/
-	for (q = 0; q < WT_EVICT_QUEUE_MAX; q++) {
+	for (q = 0; q < cache->evict_queue_count; q++) {
 		__wt_spin_lock(session, &cache->evict_queues[q].evict_lock);
 		elem = cache->evict_queues[q].evict_max;
 		for (i = 0, evict = cache->evict_queues[q].evict_queue;
@@ -1231,9 +1289,11 @@ __evict_lru_walk(WT_SESSION_IMPL *session)
 {
 	WT_CACHE *cache;
 	WT_DECL_RET;
-	WT_EVICT_QUEUE *queue, *other_queue;
+	WT_EVICT_QUEUE *queue, *other_queue, *shard_queues;
+	WT_EVICT_SHARD *shard;
 	uint64_t read_gen_oldest;
 	uint32_t candidates, entries;
+	u_int i, shard_id;
 
 	cache = S2C(session)->cache;
 
@@ -1241,10 +1301,28 @@ __evict_lru_walk(WT_SESSION_IMPL *session)
 	if (cache->evict_empty_score > 0)
 		--cache->evict_empty_score;
 
-	/* Fill the next queue (that isn't the urgent queue). */
-	queue = cache->evict_fill_queue;
-	other_queue = cache->evict_queues + (1 - (queue - cache->evict_queues));
-	cache->evict_fill_queue = other_queue;
+	/*
+	 * Choose a shard to fill: shards are filled in turn, skipping shards
+	 * whose queues are both full.
+	 */
+	for (i = 0; i < cache->evict_shard_count; ++i) {
+		shard_id =
+		    (cache->evict_shard_next + i) % cache->evict_shard_count;
+		shard = &cache->evict_shards[shard_id];
+		if (!__evict_queue_full(shard->evict_current_queue) ||
+		    !__evict_queue_full(shard->evict_other_queue))
+			break;
+	}
+	if (i == cache->evict_shard_count)
+		shard_id = cache->evict_shard_next;
+	shard = &cache->evict_shards[shard_id];
+	cache->evict_shard_next = (shard_id + 1) % cache->evict_shard_count;
+
+	/* Fill the shard's next queue. */
+	shard_queues = &cache->evict_queues[shard_id * WT_EVICT_SHARD_QUEUES];
+	queue = shard->evict_fill_queue;
+	other_queue = shard_queues + (1 - (queue - shard_queues));
+	shard->evict_fill_queue = other_queue;
 
 	/* If this queue is full, try the other one. */
 	if (__evict_queue_full(queue) && !__evict_queue_full(other_queue))
@@ -1286,7 +1364,7 @@ __evict_lru_walk(WT_SESSION_IMPL *session)
 	 * the current queue, mark it empty so that subsequent requests switch
 	 * to the other queue.
 	 */
-	if (queue == cache->evict_current_queue)
+	if (queue == shard->evict_current_queue)
 		queue->evict_current = NULL;
 
 	entries = queue->evict_entries;
@@ -1373,6 +1451,12 @@ __evict_lru_walk(WT_SESSION_IMPL *session)
 	queue->evict_current = queue->evict_queue;
 	__wt_spin_unlock(session, &queue->evict_lock);
 
+	__wt_verbose(session, WT_VERB_EVICTSERVER,
+	    "eviction shard %u: queued %" PRIu32 " candidates, %" PRIu32
+	    " pending in the other queue",
+	    shard_id, queue->evict_candidates,
+	    __wt_evict_queue_depth(other_queue));
+
 	/*
 	 * Signal any application or helper threads that may be waiting
 	 * to help with eviction.
@@ -1972,6 +2056,7 @@ __evict_walk_file(WT_SESSION_IMPL *session,
 		    !__wt_txn_visible_all(session, page->modify->rec_max_txn,
 		    WT_TIMESTAMP_NULL(&page->modify->rec_max_timestamp))) {
 			__wt_page_modify_set(session, page);
+			__wt_page_dirty_summary(session, ref);
 			goto fast;
 		}
 
@@ -1983,6 +2068,34 @@ __evict_walk_file(WT_SESSION_IMPL *session,
 		if (modified && !F_ISSET(cache, WT_CACHE_EVICT_DIRTY))
 			continue;
 
+		/*
+		 * With the scan-resistant policy, the walk passes over hot
+		 * pages. If hot pages are using more than their share of the
+		 * cache, demote those that haven't been referenced since their
+		 * read generation was last set: demoted pages are queued the
+		 * next time they are seen, unless referenced (and promoted) in
+		 * the meantime. Pages referenced once are chosen before pages
+		 * referenced repeatedly, and hot pages are only demoted when
+		 * other pages are promoted, so a scan cannot flush hot pages
+		 * from the cache.
+		 */
+		if (cache->evict_policy == WT_EVICT_POLICY_SCAN_RESISTANT &&
+		    page->evict_class == WT_PAGE_EVICT_HOT &&
+		    !__wt_cache_aggressive(session)) {
+			if (page->read_gen < __wt_cache_read_gen(session) &&
+			    cache->evict_hot_pages >
+			    __wt_cache_pages_inuse(cache) *
+			    WT_EVICT_HOT_PCT / 100 &&
+			    __wt_atomic_cas8(&page->evict_class,
+			    WT_PAGE_EVICT_HOT, WT_PAGE_EVICT_DEMOTED)) {
+				(void)__wt_atomic_subv64(
+				    &cache->evict_hot_pages, 1);
+				WT_STAT_CONN_INCR(
+				    session, cache_eviction_policy_demote);
+			}
+			continue;
+		}
+
 		/*
 		 * Don't attempt eviction of internal pages with children in
 		 * cache (indicated by seeing an internal page that is the
@@ -2107,7 +2220,9 @@ __evict_get_ref(
 	WT_CACHE *cache;
 	WT_EVICT_ENTRY *evict;
 	WT_EVICT_QUEUE *queue, *other_queue, *urgent_queue;
+	WT_EVICT_SHARD *fill_shard, *shard;
 	uint32_t candidates;
+	u_int home, i;
 	bool is_app, server_only, urgent_ok;
 
 	*btreep = NULL;
@@ -2124,9 +2239,25 @@ __evict_get_ref(
 
 	WT_STAT_CONN_INCR(session, cache_eviction_get_ref);
 
+	/*
+	 * Start with the home shard, stealing from the first other shard with
+	 * candidates if it is empty.
+	 */
+	home = __evict_shard_home(session, cache);
+	shard = NULL;
+	for (i = 0; i < cache->evict_shard_count; ++i) {
+		shard = &cache->evict_shards[
+		    (home + i) % cache->evict_shard_count];
+		if (!__evict_queue_empty(
+		    shard->evict_current_queue, is_server) ||
+		    !__evict_queue_empty(shard->evict_other_queue, is_server))
+			break;
+	}
+	if (i == cache->evict_shard_count)
+		shard = NULL;
+
 	/* Avoid the LRU lock if no pages are available. */
-	if (__evict_queue_empty(cache->evict_current_queue, is_server) &&
-	    __evict_queue_empty(cache->evict_other_queue, is_server) &&
+	if (shard == NULL &&
 	    (!urgent_ok || __evict_queue_empty(urgent_queue, false))) {
 		WT_STAT_CONN_INCR(session, cache_eviction_get_ref_empty);
 		return (WT_NOTFOUND);
@@ -2141,20 +2272,25 @@ __evict_get_ref(
 	 * we will continually evict one page and attempt to refill the queues.
 	 * Such cases are extremely rare in real applications.
 	 */
+	fill_shard = &cache->evict_shards[cache->evict_shard_next];
 	if (is_server &&
 	    (!urgent_ok || __evict_queue_empty(urgent_queue, false)) &&
-	    !__evict_queue_full(cache->evict_current_queue) &&
-	    !__evict_queue_full(cache->evict_fill_queue) &&
+	    !__evict_queue_full(fill_shard->evict_current_queue) &&
+	    !__evict_queue_full(fill_shard->evict_fill_queue) &&
 	    (cache->evict_empty_score > WT_EVICT_SCORE_CUTOFF ||
-	    __evict_queue_empty(cache->evict_fill_queue, false)))
+	    __evict_queue_empty(fill_shard->evict_fill_queue, false)))
 		return (WT_NOTFOUND);
 
-	__wt_spin_lock(session, &cache->evict_queue_lock);
-
 	/* Check the urgent queue first. */
 	if (urgent_ok && !__evict_queue_empty(urgent_queue, false))
 		queue = urgent_queue;
-	else {
+	else if (shard == NULL) {
+		WT_STAT_CONN_INCR(session, cache_eviction_get_ref_empty);
+		return (WT_NOTFOUND);
+	} else {
+		if (i != 0)
+			WT_STAT_CONN_INCR(session, cache_eviction_shard_steal);
+
 		/*
 		 * Check if the current queue needs to change.
 		 *
@@ -2162,17 +2298,17 @@ __evict_get_ref(
 		 * for more, but should only switch queues if there are no
 		 * other eviction workers.
 		 */
-		queue = cache->evict_current_queue;
-		other_queue = cache->evict_other_queue;
+		__wt_spin_lock_track(session, &shard->evict_queue_lock);
+		queue = shard->evict_current_queue;
+		other_queue = shard->evict_other_queue;
 		if (__evict_queue_empty(queue, server_only) &&
 		    !__evict_queue_empty(other_queue, server_only)) {
-			cache->evict_current_queue = other_queue;
-			cache->evict_other_queue = queue;
+			shard->evict_current_queue = other_queue;
+			shard->evict_other_queue = queue;
 		}
+		__wt_spin_unlock(session, &shard->evict_queue_lock);
 	}
 
-	__wt_spin_unlock(session, &cache->evict_queue_lock);
-
 	/*
 	 * We got the queue lock, which should be fast, and chose a queue.
 	 * Now we want to get the lock on the individual queue.
@@ -2186,8 +2322,9 @@ __evict_get_ref(
 			return (WT_NOTFOUND);
 		}
 		if (!is_server)
-			__wt_spin_lock(session, &queue->evict_lock);
-		else if (__wt_spin_trylock(session, &queue->evict_lock) != 0)
+			__wt_spin_lock_track(session, &queue->evict_lock);
+		else if (__wt_spin_trylock_track(
+		    session, &queue->evict_lock) != 0)
 			continue;
 		break;
 	}
@@ -2478,7 +2615,7 @@ __wt_page_evict_urgent(WT_SESSION_IMPL *session, WT_REF *ref)
 
 	/* Append to the urgent queue if we can. */
 	cache = S2C(session)->cache;
-	urgent_queue = &cache->evict_queues[WT_EVICT_URGENT_QUEUE];
+	urgent_queue = cache->evict_urgent_queue;
 	queued = false;
 
 	__wt_spin_lock(session, &cache->evict_queue_lock);
@@ -2532,6 +2669,125 @@ __wt_evict_priority_clear(WT_SESSION_IMPL *session)
 	S2BT(session)->evict_priority = 0;
 }
 
+/*
+ * __evict_ghost_hash --
+ *	Hash a page's address for the table of recently evicted pages.
+ */
+static inline uint64_t
+__evict_ghost_hash(
+    WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_size)
+{
+	uint64_t h;
+
+	/* Zero marks an empty slot. */
+	h = __wt_hash_city64(addr, addr_size) ^ S2BT(session)->id;
+	return (h == 0 ? 1 : h);
+}
+
+/*
+ * __wt_evict_ghost_alloc --
+ *	Allocate the table of recently evicted pages used by the
+ * scan-resistant eviction policy.
+ */
+int
+__wt_evict_ghost_alloc(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	uint64_t entries, *ghost;
+
+	cache = S2C(session)->cache;
+	if (cache->evict_ghost != NULL)
+		return (0);
+
+	/*
+	 * Size the table to remember about as many pages as fit in the cache,
+	 * assuming small leaf pages: pages evicted longer ago than that are
+	 * not being referenced repeatedly. The table is a set of two-entry
+	 * buckets, overwritten on collision: it approximates the history of
+	 * recent evictions, it doesn't track it exactly.
+	 */
+	for (entries = 1024; entries * 2 <=
+	    WT_MIN(S2C(session)->cache_size / (16 * WT_KILOBYTE),
+	    4 * WT_MILLION); entries <<= 1)
+		;
+	WT_RET(__wt_calloc_def(session, entries, &ghost));
+	cache->evict_ghost_mask = entries - 1;
+	WT_PUBLISH(cache->evict_ghost, ghost);
+	return (0);
+}
+
+/*
+ * __wt_evict_ghost_add --
+ *	Remember the address of a hot leaf page being evicted.
+ */
+void
+__wt_evict_ghost_add(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+	WT_CACHE *cache;
+	size_t addr_size;
+	uint64_t h, *ghost, *slot;
+	const uint8_t *addr;
+
+	/*
+	 * Only pages that were hot are remembered. A page referenced once and
+	 * read again after its eviction, for example by the next scan of a
+	 * table larger than the cache, isn't being referenced repeatedly: it
+	 * starts cold again, and can't push the working set out of the cache.
+	 */
+	cache = S2C(session)->cache;
+	if (cache->evict_policy != WT_EVICT_POLICY_SCAN_RESISTANT ||
+	    (ghost = cache->evict_ghost) == NULL ||
+	    WT_PAGE_IS_INTERNAL(ref->page) ||
+	    ref->page->evict_class == WT_PAGE_EVICT_COLD)
+		return;
+
+	__wt_ref_info(ref, &addr, &addr_size, NULL);
+	if (addr == NULL)
+		return;
+
+	h = __evict_ghost_hash(session, addr, addr_size);
+	slot = &ghost[(h >> 1) & cache->evict_ghost_mask & ~(uint64_t)1];
+
+	/*
+	 * Replace an entry for the same page, else an empty slot, else either
+	 * entry.
+	 */
+	if (slot[0] != h && (slot[1] == h || slot[1] == 0 ||
+	    (slot[0] != 0 && (h & 2) != 0)))
+		++slot;
+	*slot = h;
+	WT_STAT_CONN_INCR(session, cache_eviction_policy_ghost_add);
+}
+
+/*
+ * __wt_evict_ghost_check --
+ *	Check if a page being read was recently evicted while hot, if so, it
+ * is still being referenced repeatedly and starts hot.
+ */
+void
+__wt_evict_ghost_check(WT_SESSION_IMPL *session,
+    WT_PAGE *page, const uint8_t *addr, size_t addr_size)
+{
+	WT_CACHE *cache;
+	uint64_t h, *ghost, *slot;
+
+	cache = S2C(session)->cache;
+	if (cache->evict_policy != WT_EVICT_POLICY_SCAN_RESISTANT ||
+	    (ghost = cache->evict_ghost) == NULL ||
+	    WT_PAGE_IS_INTERNAL(page))
+		return;
+
+	h = __evict_ghost_hash(session, addr, addr_size);
+	slot = &ghost[(h >> 1) & cache->evict_ghost_mask & ~(uint64_t)1];
+	if (slot[0] != h && (++slot, slot[0] != h))
+		return;
+
+	*slot = 0;
+	page->evict_class = WT_PAGE_EVICT_HOT;
+	(void)__wt_atomic_addv64(&cache->evict_hot_pages, 1);
+	WT_STAT_CONN_INCR(session, cache_eviction_policy_ghost_hit);
+}
+
 /*
  * __verbose_dump_cache_single --
  *	Output diagnostic information about a single file in the cache.
@@ -274,6 +274,8 @@ __evict_page_clean_update(WT_SESSION_IMPL *session, WT_REF *ref, bool closing)
 	 * an address, it's a disk page; if it has no address, it's a deleted
 	 * page re-instantiated (for example, by searching) and never written.
 	 */
+	if (!closing)
+		__wt_evict_ghost_add(session, ref);
 	__wt_ref_out(session, ref);
 	if (ref->addr == NULL) {
 		WT_WITH_PAGE_INDEX(session,
@@ -376,6 +378,8 @@ __evict_page_dirty_update(WT_SESSION_IMPL *session, WT_REF *ref, bool closing)
 				__wt_ref_out(session, ref);
 				WT_PUBLISH(ref->state, WT_REF_LOOKASIDE);
 			} else {
+				if (!closing)
+					__wt_evict_ghost_add(session, ref);
 				__wt_ref_out(session, ref);
 				WT_PUBLISH(ref->state, WT_REF_DISK);
 			}
@@ -409,6 +413,10 @@ __evict_child_check(WT_SESSION_IMPL *session, WT_REF *parent)
 	WT_INTL_FOREACH_BEGIN(session, parent->page, child) {
 		switch (child->state) {
 		case WT_REF_DISK:		/* On-disk */
+			/* Buffered writes are held in the child reference. */
+			if (child->page_buf != NULL)
+				return (EBUSY);
+			break;
 		case WT_REF_DELETED:		/* On-disk, deleted */
 			break;
 		default:
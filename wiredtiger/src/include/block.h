@@ -39,7 +39,16 @@
  *
  * One final complication: we only maintain the per-size skiplist for the avail
  * list, the alloc and discard extent lists are not searched based on size.
+ *
+ * If the file is configured for size-class allocation, the avail list doesn't
+ * maintain the by-size skiplist, instead each WT_EXT element is linked onto a
+ * list of extents in its size class: there's a class for each size up to
+ * WT_BLOCK_SIZE_CLASS_EXACT allocation units, then a class for each power-of-2
+ * range of larger sizes.  A bitmap of non-empty classes finds the smallest
+ * class that can satisfy an allocation without searching.
  */
+#define	WT_BLOCK_SIZE_CLASSES		128
+#define	WT_BLOCK_SIZE_CLASS_EXACT	64
 
 /*
  * WT_EXTLIST --
@@ -56,12 +65,16 @@ struct __wt_extlist {
 	uint32_t size;				/* Written extent size */
 
 	bool	 track_size;			/* Maintain per-size skiplist */
+	uint32_t class_size;			/* Size-class unit, or 0 */
 
     //ָµext,__block_append
 	WT_EXT	*last;				/* Cached last element */
 
 	WT_EXT	*off[WT_SKIP_MAXDEPTH];		/* Size/offset skiplists */
 	WT_SIZE *sz[WT_SKIP_MAXDEPTH];
+
+	WT_EXT	*classes[WT_BLOCK_SIZE_CLASSES];	/* Size-class lists */
+	uint64_t class_map[WT_BLOCK_SIZE_CLASSES / 64];	/* Non-empty classes */
 };
 
 /*
@@ -77,6 +90,8 @@ struct __wt_ext { //ÿ
 
 	uint8_t	 depth;				/* Skip list depth */
 
+	WT_EXT	*class_next, *class_prev;	/* Size-class list */
+
 	/*
 	 * Variable-length array, sized by the number of skiplist elements.
 	 * The first depth array entries are the address skiplist elements,
@@ -127,7 +142,20 @@ struct __wt_size {
  *	    [file size] [checkpoint size] [write generation]
  */
 #define	WT_BM_CHECKPOINT_VERSION	1	/* Checkpoint format version */
+
+/*
+ * Extent list format: a WT_BLOCK_EXTLIST_MAGIC/0 pair, offset/size pairs, and
+ * a terminating WT_BLOCK_INVALID_OFFSET/0 pair.
+ *
+ * The live system's avail list can instead be written as changes to a base
+ * list: a WT_BLOCK_EXTLIST_MAGIC/WT_BLOCK_EXTLIST_DELTA pair, the base list's
+ * offset, size and checksum, the ranges removed from the base list and a
+ * terminating pair, then the ranges added to the base list and a terminating
+ * pair.  The base list's blocks belong to the live system, not a checkpoint,
+ * and are freed when the live system writes a new base list.
+ */
 #define	WT_BLOCK_EXTLIST_MAGIC		71002	/* Identify a list */
+#define	WT_BLOCK_EXTLIST_DELTA		1	/* Identify changes */
 //ȡcheckpointļֵ__wt_block_checkpoint_load  __block_buffer_to_ckpt
 //__wt_block.liveԱ
 struct __wt_block_ckpt { //__block_buffer_to_ckpt
@@ -145,6 +173,8 @@ struct __wt_block_ckpt { //__block_buffer_to_ckpt
 
 	WT_EXTLIST ckpt_avail;			/* Checkpoint free'd extents */
 
+	WT_EXTLIST avail_base;			/* Avail list changes base */
+
 	/*
 	 * Checkpoint archive: the block manager may potentially free a lot of
 	 * memory from the allocation and discard extent lists when checkpoint
@@ -242,6 +272,8 @@ struct __wt_block {//һ
 	/* Configuration information, set when the file is opened. */
 	/*ļʼдıʶ*/	
 	uint32_t allocfirst;		/* Allocation is first-fit */
+	bool	 allocclass;		/* Allocation uses size classes */
+	bool	 avail_delta;		/* Write avail list changes */
 	/*ļдĳ*/
 	uint32_t allocsize;		/* Allocation size */
 	/*ǰblockos page cacheеֽ*/
@@ -304,6 +336,28 @@ struct __wt_block {//һ
 	TAILQ_ENTRY(__wt_block) hashq;	/* Hashed list of handles */
 };
 
+/*
+ * WT_BLOCK_SCHED --
+ *	Block manager I/O scheduler: requests are classified as application
+ * reads, eviction writes or checkpoint writes. Background writes optionally
+ * yield to application reads, checkpoint writes are optionally rate limited.
+ */
+#define	WT_IO_CLASS_READ	0		/* Application reads */
+#define	WT_IO_CLASS_EVICT	1		/* Eviction writes */
+#define	WT_IO_CLASS_CHECKPOINT	2		/* Checkpoint writes */
+#define	WT_IO_CLASS_MAX		3
+struct __wt_block_sched {
+	bool	 read_priority;		/* Background writes yield to reads */
+
+	WT_SPINLOCK ckpt_lock;		/* Checkpoint token bucket lock */
+	uint64_t ckpt_rate;		/* Checkpoint bytes per second */
+	int64_t	 ckpt_tokens;		/* Checkpoint bytes available */
+	struct timespec ckpt_refill;	/* Last token bucket refill */
+
+					/* Requests in progress */
+	volatile uint32_t active[WT_IO_CLASS_MAX];
+};
+
 /*
  * WT_BLOCK_DESC --
  *	The file's description.
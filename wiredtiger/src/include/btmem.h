@@ -459,6 +459,9 @@ struct __wt_page_modify {
 	/* The largest update transaction ID (approximate). */
 	uint64_t update_txn; //ֵ__wt_page_only_modify_set
 
+	/* The dirty summary generation the page's ancestors were set to. */
+	uint64_t dirty_summary_gen;
+
 	WT_DECL_TIMESTAMP(last_eviction_timestamp)
 	WT_DECL_TIMESTAMP(obsolete_check_timestamp)
 	WT_DECL_TIMESTAMP(rec_max_timestamp)
@@ -528,6 +531,13 @@ struct __wt_page {  //__wt_ref.page
 			WT_REF	*parent_ref;	/* Parent reference */
 			uint64_t split_gen;	/* Generation of last split */
 
+			/*
+			 * Dirty summary generation when this page or one of
+			 * its descendants was last dirtied, see
+			 * __wt_page_dirty_summary.
+			 */
+			volatile uint64_t dirty_gen;
+
             //ռ͸ֵ__wt_page_alloc
 			struct __wt_page_index {
 				uint32_t entries;
@@ -552,7 +562,17 @@ struct __wt_page {  //__wt_ref.page
         //__inmem_row_int__inmem_row_leafֱشݵinternale pageleaf page
         //internal pageͨڴref->ref_ikey(internal pageֻҪkey)Ӧleaf pageͨpage->pg_rowӦ(leafpageҪkv)
         //Ϊ#define	pg_row		u.row  ֻҶӽڵleaf pageŻʹã__wt_page_allocռ
-        WT_ROW *row;            /* Key/value pairs */ //Ӧleaf page ļжȡrowУ__inmem_row_leaf
+		struct {
+			WT_ROW *row;		/* Key/value pairs */ //Ӧleaf page ļжȡrowУ__inmem_row_leaf
+
+			/*
+			 * Optional exact-match hash index over the keys in
+			 * the row array, built once the page has been searched
+			 * often enough, see WT_BTREE.leaf_hash_search.
+			 */
+			WT_ROW_HASH *hash;	/* Key hash index */
+			uint32_t hash_searches;	/* Searches before build */
+		} row;
     
         /* Fixed-length column-store leaf page. */
         uint8_t *fix_bitf;      /* Values */
@@ -643,7 +663,12 @@ struct __wt_page {  //__wt_ref.page
 #define	WT_PAGE_UPDATE_IGNORE	0x80	/* Ignore updates on page discard */
 	uint8_t flags_atomic;		/* Atomic flags, use F_*_ATOMIC */
 
-	uint8_t unused[2];		/* Unused padding */
+#define	WT_PAGE_EVICT_COLD	0	/* Referenced once */
+#define	WT_PAGE_EVICT_HOT	1	/* Referenced repeatedly */
+#define	WT_PAGE_EVICT_DEMOTED	2	/* Hot, then not referenced */
+	uint8_t evict_class;		/* Scan-resistant eviction class */
+
+	uint8_t unused[1];		/* Unused padding */
 
 	/*
 	 * The page's read generation acts as an LRU value for each page in the
@@ -712,6 +737,8 @@ https://yq.aliyun.com/articles/69040?spm=a2c4e.11155435.0.0.c19c4df38LYbba
 #define	pg_intl_parent_ref		u.intl.parent_ref
 #undef	pg_intl_split_gen
 #define	pg_intl_split_gen		u.intl.split_gen
+#undef	pg_intl_dirty_gen
+#define	pg_intl_dirty_gen		u.intl.dirty_gen
 
 //WT_ROW_FOREACH  WT_ROW_FOREACH_REVERSEб__rec_row_leafаleaf pageд    __value_return   
 //__inmem_row_leafдӴ̿ռݵleaf pageʱǷrowеģinsert update deleteеǷ mod_row_update  mod_row_insert
@@ -719,7 +746,11 @@ https://yq.aliyun.com/articles/69040?spm=a2c4e.11155435.0.0.c19c4df38LYbba
 //__inmem_row_int__inmem_row_leafֱشݵinternale pageleaf page
 //internal pageͨڴref->ref_ikey(internal pageֻҪkey)Ӧleaf pageͨpage->pg_rowӦ(leafpageҪkv)
 #undef	pg_row //ֻҶleaf pageŻʹøýڵ㣬__wt_page_allocռ
-#define	pg_row		u.row  //__wt_page_allocиֵ   ʵһ  
+#define	pg_row		u.row.row  //__wt_page_allocиֵ   ʵһ  
+#undef	pg_row_hash
+#define	pg_row_hash	u.row.hash
+#undef	pg_row_hash_searches
+#define	pg_row_hash_searches	u.row.hash_searches
                     
 #undef	pg_fix_bitf
 #define	pg_fix_bitf	u.fix_bitf
@@ -901,6 +932,12 @@ struct __wt_ref {
 		WT_PAGE_LOOKASIDE *page_las;	/* Lookaside information */
 	};
 
+	/*
+	 * Blind writes to the page while it's on disk, only set in the
+	 * WT_REF_DISK state, see WT_BTREE.change_buffer_max.
+	 */
+	WT_CHANGE_BUFFER *page_buf;
+
     //ĬWT_REF_DELETED__btree_tree_open_empty
 	volatile uint32_t state;	/* Page state */
 };
@@ -920,7 +957,7 @@ struct __wt_ref {
  * WT_REF_SIZE is the expected structure size -- we verify the build to ensure
  * the compiler hasn't inserted padding which would break the world.
  */
-#define	WT_REF_SIZE	48
+#define	WT_REF_SIZE	56
 
 /*
  * WT_ROW --
@@ -981,6 +1018,25 @@ struct __wt_row {	/* On-page key, on-page cell, or off-page WT_IKEY */
 #define	WT_ROW_SLOT(page, rip)						\
 	((uint32_t)(((WT_ROW *)(rip)) - (page)->pg_row))
 
+/*
+ * WT_ROW_HASH --
+ * An optional hash index over a row-store leaf page's keys, mapping the hash
+ * of a key to its WT_ROW slot so exact-match searches can skip the binary
+ * search of the page.  The index is built once from the page's original keys
+ * and never updated: keys inserted after the page was read are found in the
+ * insert lists, not here.  The table uses open addressing and linear probing,
+ * and is sized to at least twice the page entries so there is always an empty
+ * bucket to terminate a probe.
+ */
+struct __wt_row_hash_bucket {
+	uint32_t hash;			/* Key hash */
+	uint32_t slot;			/* WT_ROW slot + 1, 0 if empty */
+};
+struct __wt_row_hash {
+	uint32_t mask;			/* Bucket count - 1 */
+	WT_ROW_HASH_BUCKET bucket[0];	/* Hash buckets */
+};
+
 /*
  * WT_COL --
  * Each in-memory variable-length column-store leaf page has an array of WT_COL
@@ -1240,6 +1296,19 @@ struct __wt_insert_head {
 	WT_INSERT *tail[WT_SKIP_MAXDEPTH];	/* last item on skiplists */
 };
 
+/*
+ * WT_CHANGE_BUFFER --
+ *	Blind writes to an on-disk row-store leaf page, held until the page is
+ * next read into the cache.
+ */
+struct __wt_change_buffer {
+	WT_REF *ref;				/* Buffered page */
+	WT_INSERT_HEAD ins_head;		/* Buffered keys */
+	size_t bytes;				/* Memory footprint */
+
+	TAILQ_ENTRY(__wt_change_buffer) q;	/* Tree's buffered pages */
+};
+
 /*
  * The row-store leaf page insert lists are arrays of pointers to structures,
  * and may not exist.  The following macros return an array entry if the array
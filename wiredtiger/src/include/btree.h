@@ -108,6 +108,7 @@ struct __wt_btree { //btree
 	uint32_t id;			/* File ID, for logging */
     /*д洢ʱkeyǰ׺Χ*/
 	uint32_t key_gap;		/* Row-store prefix key gap */
+	uint32_t leaf_hash_search;	/* Row-store leaf hash index searches */
 
 	uint32_t allocsize;		/* Allocation size */
 	//internal_page_max
@@ -120,6 +121,7 @@ struct __wt_btree { //btree
 	uint64_t maxmempage;		/* In-memory page max size */
 	//Ĭ0.8*btree->maxmempage
 	uint64_t splitmempage;		/* In-memory split trigger size */
+	uint64_t change_buffer_max;	/* Change buffer max size */
 
 #define	WT_ASSERT_COMMIT_TS_ALWAYS	0x0001
 #define	WT_ASSERT_COMMIT_TS_NEVER	0x0002
@@ -197,6 +199,15 @@ struct __wt_btree { //btree
 		WT_CKPT_OFF, WT_CKPT_PREPARE, WT_CKPT_RUNNING
 	} checkpointing;		/* Checkpoint in progress */ 
 
+	/*
+	 * Internal pages summarize if they have dirty descendants: pages being
+	 * dirtied set their ancestors' dirty generation to the tree's current
+	 * generation, and checkpoint tree walks skip subtrees not dirtied
+	 * since the last complete checkpoint walk started.
+	 */
+	volatile uint64_t dirty_summary_gen;	/* Dirty summary generation */
+	uint64_t    dirty_summary_clean;/* Older subtrees are clean */
+
 	uint64_t    bytes_inmem;	/* Cache bytes in memory. */
 	uint64_t    bytes_dirty_intl;	/* Bytes in dirty internal pages. */
 	uint64_t    bytes_dirty_leaf;	/* Bytes in dirty leaf pages. */
@@ -208,6 +219,23 @@ struct __wt_btree { //btree
 	 */
 	WT_SPINLOCK	flush_lock;	/* Lock to flush the tree's pages */
 
+	/*
+	 * Checkpoint reconciles leaf pages in parallel, the tree's maximum
+	 * timestamp can't be updated atomically.
+	 */
+	WT_SPINLOCK	rec_max_lock;	/* Lock to update maximum timestamp */
+
+	/*
+	 * Row-store leaf pages with buffered blind writes, see
+	 * __wt_change_buffer_insert.  Each page's buffer is owned by whichever
+	 * thread has locked or is reading the page's WT_REF; the lock protects
+	 * the list and the total buffer size.
+	 */
+	WT_SPINLOCK	change_buffer_lock;
+	TAILQ_HEAD(__wt_change_buffer_qh, __wt_change_buffer) change_buffer_qh;
+	uint64_t	change_buffer_bytes;	/* Change buffer total size */
+	uint32_t	change_buffer_pages;	/* Change buffer pages */
+
 	/*
 	 * All of the following fields live at the end of the structure so it's
 	 * easier to clear everything but the fields that persist.
@@ -448,6 +448,8 @@ __wt_cache_page_evict(WT_SESSION_IMPL *session, WT_PAGE *page, bool rewrite)
 	/* Update bytes and pages evicted. */
 	(void)__wt_atomic_add64(&cache->bytes_evict, page->memory_footprint);
 	(void)__wt_atomic_addv64(&cache->pages_evicted, 1);
+	if (page->evict_class == WT_PAGE_EVICT_HOT)
+		(void)__wt_atomic_subv64(&cache->evict_hot_pages, 1);
 
 	/*
 	 * Track if eviction makes progress.  This is used in various places to
@@ -493,6 +495,55 @@ __wt_page_modify_init(WT_SESSION_IMPL *session, WT_PAGE *page)
 	    __wt_page_modify_alloc(session, page) : 0);
 }
 
+/*
+ * __wt_page_dirty_summary --
+ *	Record a dirty page in the dirty summaries of its ancestors, and of the
+ * page itself if it's an internal page.
+ */
+static inline void
+__wt_page_dirty_summary(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+	WT_BTREE *btree;
+	WT_PAGE *page;
+	uint64_t gen, old;
+
+	btree = S2BT(session);
+
+	/* Fast path: the page's ancestors have the current generation. */
+	gen = btree->dirty_summary_gen;
+	if (ref->page->modify->dirty_summary_gen == gen)
+		return;
+
+	/*
+	 * Set each page's generation up to the root, the walk up the tree is
+	 * looking at pages that splits may want to free. A checkpoint starting
+	 * a new generation while we're doing this may already have walked past
+	 * our ancestors, repeat until the generation is stable so the next
+	 * checkpoint doesn't skip them.
+	 */
+	WT_ENTER_PAGE_INDEX(session);
+	for (;;) {
+		page = WT_PAGE_IS_INTERNAL(ref->page) ? ref->page : ref->home;
+		while (page != NULL) {
+			while ((old = page->pg_intl_dirty_gen) < gen &&
+			    !__wt_atomic_casv64(&page->pg_intl_dirty_gen,
+			    old, gen))
+				;
+			if (page->pg_intl_parent_ref == NULL ||
+			    __wt_ref_is_root(page->pg_intl_parent_ref))
+				break;
+			page = page->pg_intl_parent_ref->home;
+		}
+		WT_FULL_BARRIER();
+		if (gen == btree->dirty_summary_gen)
+			break;
+		gen = btree->dirty_summary_gen;
+	}
+	WT_LEAVE_PAGE_INDEX(session);
+
+	ref->page->modify->dirty_summary_gen = gen;
+}
+
 /*
  * __wt_page_only_modify_set --
  *	Mark the page (but only the page) dirty.
@@ -537,6 +588,15 @@ __wt_page_only_modify_set(WT_SESSION_IMPL *session, WT_PAGE *page)
 		 */
 		if (last_running != 0)/*snapshotID*/
 			page->modify->first_dirty_txn = last_running;
+
+		/*
+		 * Internal pages know their parent, leaf pages are added to
+		 * the dirty summaries by the callers dirtying them.
+		 */
+		if (WT_PAGE_IS_INTERNAL(page) &&
+		    page->pg_intl_parent_ref != NULL)
+			__wt_page_dirty_summary(
+			    session, page->pg_intl_parent_ref);
 	}
 
     /*µtxn id*/
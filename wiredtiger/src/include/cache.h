@@ -30,8 +30,9 @@ struct __wt_evict_entry {
 	uint64_t  score;		/* Relative eviction priority */
 };
 
-#define	WT_EVICT_QUEUE_MAX	3	/* Two ordinary queues plus urgent */
-#define	WT_EVICT_URGENT_QUEUE	2	/* Urgent queue index */
+#define	WT_EVICT_SHARD_QUEUES	2	/* Ordinary queues per shard */
+#define	WT_EVICT_SHARD_MAX	64	/* Maximum eviction queue shards */
+#define	WT_EVICT_SHARD_CHECK	1000	/* Calls between node checks */
 
 /*
  * WT_EVICT_QUEUE --
@@ -48,6 +49,21 @@ struct __wt_evict_queue {
 	volatile uint32_t evict_max;	/* LRU maximum eviction slot used */
 };
 
+/*
+ * WT_EVICT_SHARD --
+ *	A pair of ordinary eviction queues with its own lock.  The eviction
+ * server fills shards in turn; eviction threads take pages from their home
+ * shard, stealing from other shards when it runs dry.
+ */
+struct __wt_evict_shard {
+	WT_CACHE_LINE_PAD_BEGIN
+	WT_SPINLOCK evict_queue_lock;	/* Shard current queue lock */
+	WT_EVICT_QUEUE *evict_current_queue; /* LRU current queue in use */
+	WT_EVICT_QUEUE *evict_fill_queue;    /* LRU next queue to fill */
+	WT_EVICT_QUEUE *evict_other_queue;   /* LRU queue not in use */
+	WT_CACHE_LINE_PAD_END
+};
+
 /* Cache operations. */
 typedef enum __wt_cache_op {
 	WT_SYNC_CHECKPOINT,
@@ -103,6 +119,17 @@ struct __wt_cache { //__wt_connection_impl.cache  ȫ
 					 * server saw in its last queue load */
 	uint64_t evict_pass_gen;	/* Number of eviction passes */
 
+	/*
+	 * Eviction policy information.
+	 */
+#define	WT_EVICT_POLICY_LRU		0	/* Read generation order */
+#define	WT_EVICT_POLICY_SCAN_RESISTANT	1	/* Separate hot and cold pages */
+#define	WT_EVICT_HOT_PCT		80	/* Share of pages kept hot */
+	u_int evict_policy;		/* Eviction policy */
+	volatile uint64_t evict_hot_pages;/* Hot pages in the cache */
+	uint64_t *evict_ghost;		/* Addresses of evicted pages */
+	uint64_t evict_ghost_mask;	/* Ghost table size - 1 */
+
 	/*
 	 * Eviction thread information.
 	 */
@@ -159,17 +186,14 @@ struct __wt_cache { //__wt_connection_impl.cache  ȫ
 	WT_SESSION_IMPL *walk_session;	/* Eviction pass session */
 	WT_DATA_HANDLE *evict_file_next;/* LRU next file to search */
 
-	WT_SPINLOCK evict_queue_lock;	/* Eviction current queue lock */
+	WT_SPINLOCK evict_queue_lock;	/* Eviction urgent queue lock */
 	//server̸߳ɨbtreeҵһЩpageȻlru򣬷һevict_queue
-	WT_EVICT_QUEUE evict_queues[WT_EVICT_QUEUE_MAX];
-	WT_EVICT_QUEUE *evict_current_queue; /* LRU current queue in use */
-	WT_EVICT_QUEUE *evict_fill_queue;    /* LRU next queue to fill.
-						This is usually the same as the
-						"other" queue but under heavy
-						load the eviction server will
-						start filling the current queue
-						before it switches. */
-	WT_EVICT_QUEUE *evict_other_queue;   /* LRU queue not in use */
+	WT_EVICT_QUEUE *evict_queues;	/* Shard queues plus urgent */
+	u_int evict_queue_count;	/* Number of eviction queues */
+	WT_EVICT_SHARD *evict_shards;	/* Ordinary queue shards */
+	u_int evict_shard_count;	/* Number of eviction shards */
+	u_int evict_shard_next;		/* Next shard to fill */
+	u_int evict_numa_nodes;		/* NUMA nodes, 0 if not configured */
 	WT_EVICT_QUEUE *evict_urgent_queue;  /* LRU urgent queue */
 	uint32_t evict_slots;		/* LRU list eviction slots */
 
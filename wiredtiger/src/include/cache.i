@@ -37,6 +37,39 @@ __wt_cache_read_gen_incr(WT_SESSION_IMPL *session)
 	++S2C(session)->cache->read_gen;
 }
 
+/*
+ * __wt_cache_read_gen_promote --
+ *      With the scan-resistant eviction policy, promote a page the
+ * application is referencing again to hot.
+ */
+static inline void
+__wt_cache_read_gen_promote(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_CACHE *cache;
+	uint8_t evict_class;
+
+	/*
+	 * A page referenced again after the eviction pass in which it was
+	 * read, or referenced again after its read generation was moved into
+	 * the future, is promoted. A scan references each page once, the
+	 * working set keeps referencing its pages whether or not eviction is
+	 * running. Ignore pages set for forcible eviction.
+	 */
+	cache = S2C(session)->cache;
+	if (cache->evict_policy != WT_EVICT_POLICY_SCAN_RESISTANT ||
+	    (evict_class = page->evict_class) == WT_PAGE_EVICT_HOT ||
+	    page->read_gen == WT_READGEN_OLDEST ||
+	    (page->cache_create_gen == cache->evict_pass_gen &&
+	    page->read_gen <= __wt_cache_read_gen(session)))
+		return;
+
+	if (__wt_atomic_cas8(
+	    &page->evict_class, evict_class, WT_PAGE_EVICT_HOT)) {
+		(void)__wt_atomic_addv64(&cache->evict_hot_pages, 1);
+		WT_STAT_CONN_INCR(session, cache_eviction_policy_promote);
+	}
+}
+
 /*
  * __wt_cache_read_gen_bump --
  *      Update the page's read generation.
@@ -74,8 +107,20 @@ __wt_cache_read_gen_new(WT_SESSION_IMPL *session, WT_PAGE *page)
 	WT_CACHE *cache;
 
 	cache = S2C(session)->cache;
-	page->read_gen =
-	    (__wt_cache_read_gen(session) + cache->read_gen_oldest) / 2;
+
+	/*
+	 * With the scan-resistant policy, leaf pages start cold at the oldest
+	 * read generation, making them the first candidates for eviction
+	 * unless they are referenced again. Pages remembered from a recent
+	 * eviction are already hot and start in the middle, as for LRU.
+	 */
+	if (cache->evict_policy == WT_EVICT_POLICY_SCAN_RESISTANT &&
+	    page->evict_class == WT_PAGE_EVICT_COLD &&
+	    !WT_PAGE_IS_INTERNAL(page))
+		page->read_gen = cache->read_gen_oldest;
+	else
+		page->read_gen =
+		    (__wt_cache_read_gen(session) + cache->read_gen_oldest) / 2;
 }
 
 /*
@@ -107,6 +107,19 @@ struct __wt_named_extractor {
 	TAILQ_ENTRY(__wt_named_extractor) q;	/* Linked list of extractors */
 };
 
+/*
+ * WT_READ_AHEAD_ENTRY --
+ *	A leaf page queued to be read into the cache by the read-ahead threads,
+ *	identified by the object's URI and the page's first key or record number.
+ */
+#define	WT_READ_AHEAD_QUEUE_MAX	1024	/* Maximum queued pages */
+struct __wt_read_ahead_entry {
+	char	*uri;			/* Object URI */
+	uint64_t recno;			/* Column-store record number */
+	WT_ITEM	 key;			/* Row-store key */
+	TAILQ_ENTRY(__wt_read_ahead_entry) q;	/* Linked list of entries */
+};
+
 /*
  * Allocate some additional slots for internal sessions so the user cannot
  * configure too few sessions for us to run.
@@ -239,6 +252,7 @@ struct __wt_connection_impl {
 	//WT_CONN_BLOCK_INSERT  ɾWT_CONN_BLOCK_REMOVE  __wt_block_open
 	TAILQ_HEAD(__wt_blockhash, __wt_block) blockhash[WT_HASH_ARRAY_SIZE];
 	TAILQ_HEAD(__wt_block_qh, __wt_block) blockqh;
+	WT_BLOCK_SCHED block_sched;	/* Block manager I/O scheduler */
 
 	u_int dhandle_count;		/* Locked: handles in the queue */
 	u_int open_btree_count;		/* Locked: open writable btree count */
@@ -290,6 +304,8 @@ struct __wt_connection_impl {
 	bool		 ckpt_signalled;/* Checkpoint signalled */
 
 	uint64_t  ckpt_usecs;		/* Checkpoint timer */
+	bool	  ckpt_pace;		/* Pace writes between checkpoints */
+	uint64_t  ckpt_pace_budget;	/* Paced write bytes left */
 	uint64_t  ckpt_time_max;	/* Checkpoint time min/max */
 	uint64_t  ckpt_time_min;
 	uint64_t  ckpt_time_recent;	/* Checkpoint time recent/total */
@@ -305,6 +321,31 @@ struct __wt_connection_impl {
 	uint64_t ckpt_write_bytes;
 	uint64_t ckpt_write_pages;
 
+	/*
+	 * Checkpoint worker threads: objects are handed out from an array, the
+	 * checkpoint waits for the count of objects written to reach the array
+	 * size.
+	 */
+	bool		 ckpt_workers_running;/* Worker threads operating */
+	WT_THREAD_GROUP	 ckpt_workers;	/* Checkpoint worker thread group */
+#define	WT_CKPT_THREADS_MAX	20	/* Configuration maximum */
+	uint32_t	 ckpt_threads;	/* Threads writing objects */
+	WT_CONDVAR	*ckpt_work_cond;/* Objects written condition */
+	WT_SESSION_IMPL	*ckpt_work_session;/* Session running the checkpoint */
+	WT_CKPT_WORK	*ckpt_work;	/* Objects to write */
+	uint32_t	 ckpt_work_count;/* Objects to write */
+	volatile uint32_t ckpt_work_next;/* Next object to write */
+	volatile uint32_t ckpt_work_done;/* Objects written */
+	volatile uint32_t ckpt_work_active;/* Workers looking for objects */
+	bool		 ckpt_work_sync;/* Objects to flush, not write */
+
+	/*
+	 * Dirty leaf pages queued by checkpoint tree walks, written by the
+	 * checkpoint worker threads while the checkpoint session is set.
+	 */
+	WT_SPINLOCK	 ckpt_leaf_lock;/* Leaf page queue lock */
+	TAILQ_HEAD(__wt_ckpt_leaf_qh, __wt_ckpt_leaf) ckpt_leaf_qh;
+
 	uint32_t stat_flags;		/* Options declared in flags.py */
 
 					/* Connection statistics */
@@ -336,6 +377,15 @@ struct __wt_connection_impl {
 	//ٲevict߳  Чο__wt_evict_create
 	uint32_t	 evict_threads_min;/* Min eviction threads */
 
+	bool		 read_ahead_running;/* Read-ahead threads operating */
+	WT_THREAD_GROUP  read_ahead_threads;/* Read-ahead thread group */
+	uint32_t	 read_ahead_workers;/* Number of read-ahead threads */
+	uint32_t	 read_ahead_pages;/* Pages to read ahead of a cursor */
+					/* Locked: read-ahead queue */
+	WT_SPINLOCK	 read_ahead_lock;/* Read-ahead queue lock */
+	TAILQ_HEAD(__wt_read_ahead_qh, __wt_read_ahead_entry) read_ahead_qh;
+	uint32_t	 read_ahead_queue_len;/* Read-ahead queue length */
+
     //ֵ__statlog_config
 #define	WT_STATLOG_FILENAME	"WiredTigerStat.%d.%H"
 	WT_SESSION_IMPL *stat_session;	/* Statistics log session */
@@ -374,6 +424,11 @@ struct __wt_connection_impl {
 	/* ־ļŵ·__wt_log_openд */
 	const char	*log_path;	/* Logging path format */
 	uint32_t	 log_prealloc;	/* Log file pre-allocation */
+	uint32_t	 log_streams;	/* Log streams */
+	uint32_t	 log_join_groups;/* Log slot join groups */
+	bool		 log_io_uring;	/* Log I/O through io_uring */
+	uint32_t	 log_recover_threads;/* Threads applying recovery */
+	uint64_t	 log_group_commit_max;/* Group commit delay cap */
 	//__logmgr_sync_cfgý  ḳֵ__wt_txn.txn_logsync
 	uint32_t	 txn_logsync;	/* Log sync configuration */
 
@@ -471,14 +526,16 @@ struct __wt_connection_impl {
 };
 
 #define	WT_CONN_LOG_ARCHIVE		0x001	/* Archive is enabled */
-#define	WT_CONN_LOG_DOWNGRADED		0x002	/* Running older version */
+#define	WT_CONN_LOG_COMPRESS_SLOTS	0x002	/* Compress slot buffers */
+#define	WT_CONN_LOG_DOWNGRADED		0x004	/* Running older version */
 //log.enabledǷʹ
-#define	WT_CONN_LOG_ENABLED		0x004	/* Logging is enabled */  //־ܣֵ__wt_logmgr_create
-#define	WT_CONN_LOG_EXISTED		0x008	/* Log files found */
-#define	WT_CONN_LOG_FORCE_DOWNGRADE	0x010	/* Force downgrade */
-#define	WT_CONN_LOG_RECOVER_DIRTY	0x020	/* Recovering unclean */
-#define	WT_CONN_LOG_RECOVER_DONE	0x040	/* Recovery completed */
-#define	WT_CONN_LOG_RECOVER_ERR		0x080	/* Error if recovery required */
-#define	WT_CONN_LOG_ZERO_FILL		0x100	/* Manually zero files */
+#define	WT_CONN_LOG_ENABLED		0x008	/* Logging is enabled */  //־ܣֵ__wt_logmgr_create
+#define	WT_CONN_LOG_EXISTED		0x010	/* Log files found */
+#define	WT_CONN_LOG_FORCE_DOWNGRADE	0x020	/* Force downgrade */
+#define	WT_CONN_LOG_RECOVER_DIRTY	0x040	/* Recovering unclean */
+#define	WT_CONN_LOG_RECOVER_DONE	0x080	/* Recovery completed */
+#define	WT_CONN_LOG_RECOVER_ERR		0x100	/* Error if recovery required */
+#define	WT_CONN_LOG_RECYCLE		0x200	/* Recycle archived files */
+#define	WT_CONN_LOG_ZERO_FILL		0x400	/* Manually zero files */
 
 
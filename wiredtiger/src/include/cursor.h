@@ -19,10 +19,13 @@
 	equals,								\
 	next,								\
 	prev,								\
+	next_batch,							\
 	reset,								\
 	search,								\
 	search_near,							\
+	search_batch,							\
 	insert,								\
+	insert_batch,							\
 	modify,								\
 	update,								\
 	remove,								\
@@ -42,10 +45,13 @@
 	equals,								\
 	next,								\
 	prev,								\
+	next_batch,							\
 	reset,								\
 	search,								\
 	search_near,							\
+	search_batch,							\
 	insert,								\
+	insert_batch,							\
 	modify,								\
 	update,								\
 	remove,								\
@@ -209,6 +215,12 @@ struct __wt_cursor_btree {//__wt_cursor_bulk.cbt  cbt = (WT_CURSOR_BTREE *)curso
 	//ֵ__wt_row_modify
 	WT_UPDATE *modify_update;
 
+	/*
+	 * Copies of the keys and values returned by the batched cursor methods,
+	 * WT_CURSOR.next_batch and WT_CURSOR.search_batch.
+	 */
+	WT_ITEM batch;
+
 	/*
 	 * Fixed-length column-store items are a single byte, and it's simpler
 	 * and cheaper to allocate the space for it now than keep checking to
@@ -218,6 +230,22 @@ struct __wt_cursor_btree {//__wt_cursor_bulk.cbt  cbt = (WT_CURSOR_BTREE *)curso
 
 	uint8_t	append_tree;		/* Cursor appended to the tree */
 
+	/*
+	 * Read-ahead state: the number of leaf pages the cursor has moved
+	 * through, and the parent page and slot of the furthest page queued
+	 * for read-ahead, so the same pages aren't queued repeatedly.
+	 */
+	uint32_t read_ahead_leaves;
+	WT_PAGE	*read_ahead_home;
+	uint32_t read_ahead_slot;
+
+	/*
+	 * A blind write was buffered rather than reading the leaf page: the
+	 * search returns the parent page as the cursor's page, and the locked
+	 * leaf page's reference here, see __wt_change_buffer_insert.
+	 */
+	WT_REF	*buffer_ref;
+
 #ifdef HAVE_DIAGNOSTIC
 	/* Check that cursor next/prev never returns keys out-of-order. */
 	WT_ITEM *lastkey, _lastkey;
@@ -232,12 +260,16 @@ struct __wt_cursor_btree {//__wt_cursor_bulk.cbt  cbt = (WT_CURSOR_BTREE *)curso
 					   (e.g. on a checkpoint) */
 #define	WT_CBT_SEARCH_SMALLEST	0x20	/* Row-store: small-key insert list */
 #define	WT_CBT_VAR_ONPAGE_MATCH	0x40	/* Var-store: on-page recno match */
+#define	WT_CBT_READ_AHEAD	0x80	/* Read-ahead configured at open */
+#define	WT_CBT_CHANGE_BUFFER	0x100	/* Row-store: search may buffer */
+#define	WT_CBT_SEARCH_IN_RANGE	0x200	/* Row-store: key in leaf's range */
 
 #define	WT_CBT_POSITION_MASK		/* Flags associated with position */ \
 	(WT_CBT_ITERATE_APPEND | WT_CBT_ITERATE_NEXT | WT_CBT_ITERATE_PREV | \
-	WT_CBT_SEARCH_SMALLEST | WT_CBT_VAR_ONPAGE_MATCH)
+	WT_CBT_SEARCH_IN_RANGE | WT_CBT_SEARCH_SMALLEST |		     \
+	WT_CBT_VAR_ONPAGE_MATCH)
 
-	uint8_t flags;
+	uint16_t flags;
 };
 
 //ռ͸ֵ__curfile_create   bulk__curfile_close
@@ -436,6 +468,12 @@ struct __wt_cursor_log {
 	uint32_t	rectype;	/* Record type */
 	uint64_t	txnid;		/* Record txnid */
 
+	WT_ITEM		batch;		/* Packed keys/values of a batch */
+	uint32_t	*fileids;	/* Target file IDs */
+	size_t		fileids_allocated;
+	u_int		fileid_count;
+	uint64_t	tail_wait;	/* Milliseconds to wait at the end */
+
 #define	WT_CURLOG_ARCHIVE_LOCK	0x01	/* Archive lock held */
 	uint8_t		flags;
 };
@@ -206,8 +206,14 @@ struct __wt_logslot {
 	WT_LSN	 slot_start_lsn;	/* Slot starting LSN */
 	WT_LSN	 slot_end_lsn;		/* Slot ending LSN */
 	WT_FH	*slot_fh;		/* File handle for this group */
+	uint32_t slot_stream;		/* Log stream joining the slot */
+	uint32_t slot_salt;		/* Record checksum salt */
+	volatile uint32_t slot_sync_commits;/* Synchronous commits joined */
+	volatile bool slot_placed;	/* Slot has its log position */
+	bool	 slot_compress;		/* Write as a compressed frame */
 	//kv log__wt_log_fill¼buf
 	WT_ITEM  slot_buf;		/* Buffer for grouped writes */
+	WT_ITEM  slot_frame;		/* Compressed slot frame */
 
     //WT_SLOT_CLOSEFH
 	uint32_t flags;			/* Flags */
@@ -247,6 +253,32 @@ slot buffer
 */
 #define	WT_MYSLOT_UNBUFFERED	0x04	/* Write directly */
 
+/*
+ * WT_LOG_JOIN_REQ --
+ *	A slot join waiting to be combined with the other joins in its group.
+ */
+struct __wt_log_join_req {
+	WT_LOG_JOIN_REQ *next;		/* Next pending join */
+	WT_MYSLOT	*myslot;	/* Joining thread's slot information */
+	uint64_t	 size;		/* Size to join */
+	uint32_t	 flags;		/* Log write flags */
+	uint32_t	 stream;	/* Log stream */
+	volatile bool	 done;		/* Joined by the combining thread */
+};
+
+/*
+ * WT_LOG_JOIN_GROUP --
+ *	Sessions are spread across join groups.  Joins pending in a group are
+ * combined by one of the joining threads into a single update of the active
+ * slot's state, so only one thread per group contends for the slot.
+ */
+struct __wt_log_join_group {
+	WT_CACHE_LINE_PAD_BEGIN
+	WT_LOG_JOIN_REQ *pending;	/* Joins waiting to be combined */
+	volatile uint32_t combining;	/* A thread is combining */
+	WT_CACHE_LINE_PAD_END
+};
+
 
 #define	WT_LOG_END_HEADER	log->allocsize
 
@@ -263,6 +295,9 @@ struct __wt_log {
 	uint32_t	 prep_fileid;	/* Pre-allocated file number */
 	uint32_t	 tmp_fileid;	/* Temporary file number */
 	uint32_t	 prep_missed;	/* Pre-allocated file misses */
+	uint32_t	 log_salt;	/* Current file's checksum salt */
+	bool		 log_frames;	/* Current file allows slot frames */
+	WT_LSN		 frame_hint;	/* Last slot frame read, atomic */
 	WT_FH           *log_fh;	/* Logging file handle */ /*ʹõlogļhandler*/
 	WT_FH           *log_dir_fh;	/* Log directory file handle */  /*logĿ¼ļhandler*/
 	WT_FH           *log_close_fh;	/* Logging file handle to close */ /*һرյlogļhandler*/
@@ -315,14 +350,47 @@ struct __wt_log {
 	 * gcc doesn't support that for arrays.
 	 */
 #define	WT_SLOT_POOL	128
+
+	/*
+	 * Log streams: with more than one stream, transactions join the
+	 * active slot of a stream chosen by the files they modify, and a
+	 * stream's slot is placed in the log when it's closed, merging the
+	 * streams in commit order.  Other records are written in order across
+	 * all of the streams.
+	 */
+#define	WT_LOG_STREAMS_MAX	16
+#define	WT_LOG_STREAM_ORDERED	UINT32_MAX	/* Not in a stream */
 //https://blog.csdn.net/yuanrxdu/article/details/78339295
     // ׼ҿΪϲlogrecslotbuffer
     //ֵ__log_slot_new  __wt_log_slot_init
-	WT_LOGSLOT	*active_slot;			/* Active slot */
+	WT_LOGSLOT	*active_slot[WT_LOG_STREAMS_MAX];/* Active slots */
 	//ϵͳslot buffer飬ںϲġ׼ϲõslot buffer
 	WT_LOGSLOT	 slot_pool[WT_SLOT_POOL];	/* Pool of all slots */
 	//ֵ__log_slot_new  __wt_log_slot_init
 	int32_t		 pool_index;		/* Index into slot pool */
+	uint32_t	 streams;		/* Log streams */
+	WT_LOG_JOIN_GROUP *join_groups;		/* Slot join groups */
+	uint32_t	 join_group_cnt;	/* Slot join group count */
+
+	/*
+	 * Asynchronous log I/O: a slot handed off to the wrlsn thread has its
+	 * write in flight until its request completes, the wrlsn thread skips
+	 * it until then.
+	 */
+	WT_URING	*uring;			/* Log I/O ring */
+	WT_URING_REQ	*slot_io;		/* Slot write requests */
+
+	/*
+	 * Group commit: moving averages of the time between synchronous
+	 * commits and of the time to sync the log, and the number of commits
+	 * waiting for a sync, decide how long to delay a synchronous commit's
+	 * slot so other commits can join it.  Updates aren't serialized, the
+	 * averages are only estimates.
+	 */
+	uint64_t	 gc_arrival_usecs;	/* Time between commits */
+	uint64_t	 gc_last_usecs;		/* Time of the last commit */
+	uint64_t	 gc_sync_usecs;		/* Time to sync the log */
+	volatile uint32_t gc_sync_waiters;	/* Commits waiting for a sync */
 	size_t		 slot_buf_size;		/* Buffer size for slots */
 #ifdef HAVE_DIAGNOSTIC
 	uint64_t	 write_calls;		/* Calls to log_write */
@@ -342,6 +410,7 @@ struct __wt_log_record {
 
 #define	WT_LOG_RECORD_COMPRESSED	0x01	/* Compressed except hdr */
 #define	WT_LOG_RECORD_ENCRYPTED		0x02	/* Encrypted except hdr */
+#define	WT_LOG_RECORD_FRAME		0x04	/* Compressed slot frame */
 	uint16_t	flags;		/* 08-09: Flags */
 	uint8_t		unused[2];	/* 10-11: Padding */
 	//lenmem_len:logrecϵĿռ䳤ȺڴеĳȣΪlogrecˢ֮ǰпռѹôϵĳȺڴеĳȾͲһ
@@ -375,9 +444,11 @@ __wt_log_record_byteswap(WT_LOG_RECORD *record)
 struct __wt_log_desc {
 #define	WT_LOG_MAGIC		0x101064
 	uint32_t	log_magic;	/* 00-03: Magic number */
-#define	WT_LOG_VERSION	2
+#define	WT_LOG_VERSION	3
 	uint16_t	version;	/* 04-05: Log version */
-	uint16_t	unused;		/* 06-07: Unused */
+#define	WT_LOG_DESC_SALTED	0x01	/* Record checksums are salted */
+#define	WT_LOG_DESC_FRAMES	0x02	/* Slot frames may be written */
+	uint16_t	flags;		/* 06-07: Flags */
 	uint64_t	log_size;	/* 08-15: Log file size */
 };
 /*
@@ -385,10 +456,26 @@ struct __wt_log_desc {
  */
 #define	WT_LOG_VERSION_SYSTEM	2
 
+/*
+ * This is the log version that introduced the description flags and salted
+ * record checksums.  Earlier versions have no flags, releases that only read
+ * earlier versions refuse the file rather than failing the salted checksums.
+ */
+#define	WT_LOG_VERSION_SALTED	3
+
+/*
+ * This is the log version that introduced slot frames: releases reading
+ * earlier versions would truncate the log at the first frame.
+ */
+#define	WT_LOG_VERSION_FRAMES	3
+
 /*
  * WiredTiger release version where log format version changed.
  * We only have to check the major version for now.  It is minor
- * version 0 once release numbers move on.
+ * version 0 once release numbers move on.  Log versions 2 and 3
+ * are both written by this major release (version 3 only when salted
+ * checksums or slot frames are configured), setting an older release
+ * compatibility writes version 1 files.
  */
 #define	WT_LOG_V2	3
 
@@ -403,7 +490,7 @@ __wt_log_desc_byteswap(WT_LOG_DESC *desc)
 #ifdef	WORDS_BIGENDIAN
 	desc->log_magic = __wt_bswap32(desc->log_magic);
 	desc->version = __wt_bswap16(desc->version);
-	desc->unused = __wt_bswap16(desc->unused);
+	desc->flags = __wt_bswap16(desc->flags);
 	desc->log_size = __wt_bswap64(desc->log_size);
 #else
 	WT_UNUSED(desc);
@@ -108,3 +108,49 @@ struct __wt_ckpt {
     /*checkpoint״̬ʶ*/
 	uint32_t flags;
 };
+
+/*
+ * WT_CKPT_WORK --
+ *	An object being written by a checkpoint, the state carried between
+ *	starting, writing and resolving the object's checkpoint.
+ */
+struct __wt_ckpt_work {
+	WT_DATA_HANDLE *dhandle;		/* Object being checkpointed */
+
+	WT_LSN	 ckptlsn;			/* Object's checkpoint LSN */
+	bool	 fake_ckpt;			/* Faking the checkpoint */
+	bool	 resolve_bm;			/* Block manager to resolve */
+
+	u_int	 thread_id;			/* Thread writing the object */
+	uint64_t bytes;				/* Bytes written */
+	uint64_t usecs;				/* Time writing the object */
+	int	 ret;				/* Return from writing */
+};
+
+/*
+ * WT_CKPT_LEAF --
+ *	A dirty leaf page queued by a checkpoint for the checkpoint worker
+ * threads to write. The thread walking the tree holds a hazard pointer on the
+ * page until it's written.
+ */
+struct __wt_ckpt_leaf {
+	WT_DATA_HANDLE *dhandle;		/* Tree being checkpointed */
+	WT_REF	 *ref;				/* Page to write */
+	WT_CKPT_LEAVES *leaves;			/* Owning set of pages */
+	bool	  ts_read;			/* Write at the read timestamp */
+
+	TAILQ_ENTRY(__wt_ckpt_leaf) q;		/* Worker queue */
+};
+
+/*
+ * WT_CKPT_LEAVES --
+ *	The leaf pages queued by a single tree walk, internal pages are not
+ * written until all of the queued pages have been written.
+ */
+struct __wt_ckpt_leaves {
+#define	WT_CKPT_LEAF_MAX	64		/* Maximum pages queued */
+	WT_CKPT_LEAF leaf[WT_CKPT_LEAF_MAX];
+	u_int	 count;				/* Queued pages */
+	volatile uint32_t pending;		/* Pages not yet written */
+	int	 ret;				/* First error writing pages */
+};
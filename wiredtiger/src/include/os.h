@@ -169,3 +169,44 @@ struct __wt_fstream {
 	int (*fstr_printf)(
 	    WT_SESSION_IMPL *, WT_FSTREAM *, const char *, va_list);
 };
+
+/*
+ * WT_URING_REQ --
+ *	A write, a write followed by a data sync, or a data sync, submitted
+ * through an io_uring.  The request is complete once it has no completions
+ * pending.
+ */
+struct __wt_uring_req {
+	WT_FH	*fh;				/* File handle */
+	const void *buf;			/* Write buffer */
+	size_t	 len;				/* Write length, 0 to sync */
+	wt_off_t offset;			/* Write offset */
+	int	 fd;				/* File descriptor */
+	bool	 sync;				/* Sync after the write */
+	bool	 resync;			/* Short write, sync again */
+
+	volatile uint32_t pending;		/* Completions pending */
+	int	 error;				/* Request error */
+};
+
+/*
+ * WT_URING --
+ *	A Linux io_uring: the kernel's submission and completion rings, mapped
+ * into our address space.
+ */
+struct __wt_uring {
+	int	 fd;				/* Ring file descriptor */
+
+	WT_SPINLOCK submit_lock;		/* Locked: submission ring */
+	uint32_t *sq_head, *sq_tail, *sq_mask, *sq_array;
+	void	 *sqes;				/* Submission queue entries */
+
+	WT_SPINLOCK reap_lock;			/* Locked: completion ring */
+	uint32_t *cq_head, *cq_tail, *cq_mask;
+	void	 *cqes;				/* Completion queue entries */
+
+	void	 *sq_ring, *cq_ring;		/* Mapped rings */
+	size_t	  sq_ring_size, cq_ring_size, sqes_size;
+
+	volatile uint32_t inflight;		/* Completions pending */
+};
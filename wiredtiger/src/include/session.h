@@ -164,6 +164,7 @@ struct __wt_session_impl {
 	WT_DATA_HANDLE **ckpt_handle;	/* Handle list */ 
 	u_int   ckpt_handle_next;	/* Next empty slot */
 	size_t  ckpt_handle_allocated;	/* Bytes allocated */
+	uint64_t ckpt_write_bytes;	/* Checkpoint bytes written */
 
 	/*
 	 * Operations acting on handles.
@@ -186,6 +187,15 @@ struct __wt_session_impl {
 	//__open_sessionиֵ
 	u_int	stat_bucket;		/* Statistics bucket offset */
 
+	/*
+	 * With NUMA eviction queues, the shard the session takes eviction
+	 * candidates from first depends on the node its thread is running on.
+	 * Threads rarely move between nodes, so the shard is cached and the
+	 * node is only checked occasionally.
+	 */
+	u_int	evict_shard;		/* Eviction queue shard */
+	u_int	evict_shard_check;	/* Calls until the node is checked */
+
 	uint32_t flags;
 
 	/*
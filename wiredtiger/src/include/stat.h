@@ -282,6 +282,19 @@ struct __wt_connection_stats { //__stats_connection_desc
 	int64_t async_op_remove;
 	int64_t async_op_search;
 	int64_t async_op_update;
+	int64_t block_sched_read_time;
+	int64_t block_sched_read;
+	int64_t block_sched_read_active;
+	int64_t block_sched_checkpoint_throttle_time;
+	int64_t block_sched_checkpoint_time;
+	int64_t block_sched_checkpoint;
+	int64_t block_sched_checkpoint_active;
+	int64_t block_sched_checkpoint_throttle;
+	int64_t block_sched_evict_time;
+	int64_t block_sched_evict;
+	int64_t block_sched_evict_active;
+	int64_t block_sched_write_yield_time;
+	int64_t block_sched_write_yield;
 	int64_t block_preload;
 	int64_t block_read;
 	int64_t block_write;
@@ -300,18 +313,29 @@ struct __wt_connection_stats { //__stats_connection_desc
 	int64_t cache_bytes_other;
 	int64_t cache_bytes_read;
 	int64_t cache_bytes_write;
+	int64_t cache_change_buffer_merge;
+	int64_t cache_change_buffer_write;
+	int64_t cache_change_buffer_skip_full;
 	int64_t cache_eviction_checkpoint;
 	int64_t cache_eviction_get_ref;
 	int64_t cache_eviction_get_ref_empty;
 	int64_t cache_eviction_get_ref_empty2;
+	int64_t cache_eviction_shard_steal;
 	int64_t cache_eviction_aggressive_set;
 	int64_t cache_eviction_empty_score;
 	int64_t cache_eviction_walk_passes;
+	int64_t cache_eviction_policy_ghost_add;
+	int64_t cache_eviction_policy_hot_pages;
+	int64_t cache_eviction_policy_demote;
+	int64_t cache_eviction_policy_promote;
+	int64_t cache_eviction_policy_ghost_hit;
 	int64_t cache_eviction_queue_empty;
 	int64_t cache_eviction_queue_not_empty;
 	int64_t cache_eviction_server_evicting;
 	int64_t cache_eviction_server_slept;
 	int64_t cache_eviction_slow;
+	int64_t cache_eviction_shard_depth_max;
+	int64_t cache_eviction_shard_depth_min;
 	int64_t cache_eviction_state;
 	int64_t cache_eviction_target_page_lt10;
 	int64_t cache_eviction_target_page_lt32;
@@ -376,6 +400,10 @@ struct __wt_connection_stats { //__stats_connection_desc
 	int64_t cache_write;
 	int64_t cache_write_restore;
 	int64_t cache_overhead;
+	int64_t cache_read_ahead_queued;
+	int64_t cache_read_ahead_run;
+	int64_t cache_read_ahead_skip_cache;
+	int64_t cache_read_ahead_skip_queue;
 	int64_t cache_bytes_internal;
 	int64_t cache_bytes_leaf;
 	int64_t cache_bytes_dirty;
@@ -397,15 +425,22 @@ struct __wt_connection_stats { //__stats_connection_desc
 	int64_t write_io;
 	int64_t cursor_create;
 	int64_t cursor_insert;
+	int64_t cursor_insert_batch;
+	int64_t cursor_insert_batch_pinned;
 	int64_t cursor_modify;
 	int64_t cursor_next;
+	int64_t cursor_next_batch;
 	int64_t cursor_prev;
 	int64_t cursor_remove;
 	int64_t cursor_reserve;
 	int64_t cursor_reset;
 	int64_t cursor_restart;
 	int64_t cursor_search;
+	int64_t cursor_search_hash_hit;
+	int64_t cursor_search_hash_miss;
+	int64_t cursor_search_hash_build;
 	int64_t cursor_search_near;
+	int64_t cursor_search_batch;
 	int64_t cursor_update;
 	int64_t cursor_truncate;
 	int64_t dh_conn_handle_count;
@@ -426,6 +461,12 @@ struct __wt_connection_stats { //__stats_connection_desc
 	int64_t lock_dhandle_wait_internal;
 	int64_t lock_dhandle_read_count;
 	int64_t lock_dhandle_write_count;
+	int64_t lock_evict_queue_count;
+	int64_t lock_evict_queue_wait_application;
+	int64_t lock_evict_queue_wait_internal;
+	int64_t lock_evict_shard_count;
+	int64_t lock_evict_shard_wait_application;
+	int64_t lock_evict_shard_wait_internal;
 	//ֵοWT_RWLOCK_INIT_TRACKED
 	int64_t lock_metadata_count;
 	int64_t lock_metadata_wait_application;
@@ -444,6 +485,9 @@ struct __wt_connection_stats { //__stats_connection_desc
 	
 	int64_t log_slot_switch_busy;
 	int64_t log_force_ckpt_sleep;
+	int64_t log_group_commit_delay_time;
+	int64_t log_group_commit_delay;
+	int64_t log_io_uring_enabled;
 	int64_t log_bytes_payload;
 	int64_t log_bytes_written;
 	int64_t log_zero_fills;
@@ -453,21 +497,28 @@ struct __wt_connection_stats { //__stats_connection_desc
 	int64_t log_compress_writes;
 	int64_t log_compress_write_fails;
 	int64_t log_compress_small;
+	int64_t log_stream_ordered;
+	int64_t log_stream_writes;
 	int64_t log_release_write_lsn;
 	int64_t log_scans;
 	int64_t log_scan_rereads;
 	int64_t log_write_lsn;
 	int64_t log_write_lsn_skip;
+	int64_t log_compress_slots;
+	int64_t log_compress_slot_fails;
 	int64_t log_sync;
 	int64_t log_sync_duration;
 	int64_t log_sync_dir;
 	int64_t log_sync_dir_duration;
+	int64_t log_io_uring_sync;
 	int64_t log_writes;
+	int64_t log_io_uring_write;
 	int64_t log_slot_consolidated;
 	int64_t log_max_filesize;
 	int64_t log_prealloc_max;
 	int64_t log_prealloc_missed;
 	int64_t log_prealloc_files;
+	int64_t log_prealloc_recycled;
 	int64_t log_prealloc_used;
 	int64_t log_scan_records;
 	int64_t log_slot_close_race;
@@ -478,11 +529,26 @@ struct __wt_connection_stats { //__stats_connection_desc
 	int64_t log_slot_immediate;
 	int64_t log_slot_yield_close;
 	int64_t log_slot_yield_sleep;
+	int64_t log_slot_combine_wait;
 	int64_t log_slot_yield;
+	int64_t log_slot_combine;
+	int64_t log_slot_combine_wait_duration;
 	int64_t log_slot_active_closed;
+	int64_t log_slot_join_retries;
+	int64_t log_slot_combined;
 	int64_t log_slot_yield_duration;
 	int64_t log_slot_no_free_slots;
 	int64_t log_slot_unbuffered;
+	int64_t log_commit_latency_lt100;
+	int64_t log_commit_latency_lt250;
+	int64_t log_commit_latency_lt10000;
+	int64_t log_commit_latency_ge10000;
+	int64_t log_commit_latency_lt1000;
+	int64_t log_sync_commits_lt2;
+	int64_t log_sync_commits_ge16;
+	int64_t log_sync_commits_lt4;
+	int64_t log_sync_commits_lt8;
+	int64_t log_sync_commits_lt16;
 	int64_t log_compress_mem;
 	int64_t log_buffer_size;
 	int64_t log_compress_len;
@@ -539,25 +605,39 @@ struct __wt_connection_stats { //__stats_connection_desc
 	int64_t txn_snapshots_created;
 	//"transaction: number of named snapshots dropped",
 	int64_t txn_snapshots_dropped;
+	int64_t txn_recover_parallel_ops;
 	//"transaction: transaction begins",
 	int64_t txn_begin;
 	//"transaction: transaction checkpoint currently running",
 	//__txn_checkpoint_wrapperиֵ
 	int64_t txn_checkpoint_running; //1ʾǰcheckpoint__txn_checkpoint_wrapper
+	int64_t txn_checkpoint_pace_remaining;
 	////"transaction: transaction checkpoint generation",
 	int64_t txn_checkpoint_generation;
+	int64_t txn_checkpoint_leaf_parallel;
 	//"transaction: transaction checkpoint max time (msecs)",
 	int64_t txn_checkpoint_time_max;
 	//"transaction: transaction checkpoint min time (msecs)",
 	int64_t txn_checkpoint_time_min;
     //"transaction: transaction checkpoint most recent time (msecs)",
 	int64_t txn_checkpoint_time_recent;
+	int64_t txn_checkpoint_fsync_parallel;
+	int64_t txn_checkpoint_thread_trees;
+	int64_t txn_checkpoint_pace_bytes;
+	int64_t txn_checkpoint_pace_pages;
+	int64_t txn_checkpoint_pace_rate;
 	//"transaction: transaction checkpoint scrub dirty target",
 	int64_t txn_checkpoint_scrub_target;
 	//"transaction: transaction checkpoint scrub time (msecs)",
 	int64_t txn_checkpoint_scrub_time;
+	int64_t txn_checkpoint_thread_bytes_max;
+	int64_t txn_checkpoint_thread_time_max;
+	int64_t txn_checkpoint_thread_bytes_min;
+	int64_t txn_checkpoint_thread_time_min;
 	//"transaction: transaction checkpoint total time (msecs)",
 	int64_t txn_checkpoint_time_total;
+	int64_t txn_checkpoint_walk_skipped;
+	int64_t txn_checkpoint_walk_pages;
 	//"transaction: transaction checkpoints",
 	int64_t txn_checkpoint;
 	//"transaction: transaction checkpoints skipped because database was clean",
@@ -620,6 +700,8 @@ struct __wt_dsrc_stats { //__wt_cursor_stat.dsrc_stats
 	int64_t lsm_merge_throttle;
 	int64_t bloom_size;
 	int64_t block_extension;
+	int64_t block_avail_base;
+	int64_t block_avail_delta;
 	int64_t block_alloc;
 	int64_t block_free;
 	int64_t block_checkpoint_size;
@@ -650,6 +732,10 @@ struct __wt_dsrc_stats { //__wt_cursor_stat.dsrc_stats
 	int64_t cache_bytes_inuse;
 	int64_t cache_bytes_read;
 	int64_t cache_bytes_write;
+	int64_t cache_change_buffer_bytes;
+	int64_t cache_change_buffer_merge;
+	int64_t cache_change_buffer_write;
+	int64_t cache_change_buffer_skip_full;
 	int64_t cache_eviction_checkpoint;
 	int64_t cache_eviction_fail;
 	int64_t cache_eviction_walk_passes;
@@ -717,15 +803,21 @@ struct __wt_dsrc_stats { //__wt_cursor_stat.dsrc_stats
 	int64_t cursor_remove_bytes;
 	int64_t cursor_update_bytes;
 	int64_t cursor_insert;
+	int64_t cursor_insert_batch;
 	int64_t cursor_modify;
 	int64_t cursor_next;
+	int64_t cursor_next_batch;
 	int64_t cursor_prev;
 	int64_t cursor_remove;
 	int64_t cursor_reserve;
 	int64_t cursor_reset;
 	int64_t cursor_restart;
 	int64_t cursor_search;
+	int64_t cursor_search_hash_hit;
+	int64_t cursor_search_hash_miss;
+	int64_t cursor_search_hash_build;
 	int64_t cursor_search_near;
+	int64_t cursor_search_batch;
 	int64_t cursor_truncate;
 	int64_t cursor_update;
 	int64_t rec_dictionary;
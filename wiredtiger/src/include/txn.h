@@ -29,8 +29,17 @@
 //ǰsessionڴ״̬Ϣ
 #define	WT_SESSION_TXN_STATE(s) (&S2C(s)->txn_global.states[(s)->id])
 
+/* Word W of an active session bitmap: each word is on its own cache line. */
+#define	WT_TXN_STATE_WORD(bitmap, w)					\
+	((bitmap)[(w) * (WT_CACHE_LINE_ALIGNMENT / sizeof(uint64_t))])
+
+/*
+ * Checkpoint worker threads write objects on behalf of the checkpoint, and
+ * behave as the checkpoint while they do.
+ */
 #define	WT_SESSION_IS_CHECKPOINT(s)					\
-	((s)->id != 0 && (s)->id == S2C(s)->txn_global.checkpoint_id)
+	(F_ISSET(s, WT_SESSION_CHECKPOINT_WORKER) ||			\
+	((s)->id != 0 && (s)->id == S2C(s)->txn_global.checkpoint_id))
 
 /*
  * Perform an operation at the specified isolation level.
@@ -194,6 +203,21 @@ struct __wt_txn_global {
     //洢sessionidϢο__wt_txn_am_oldest
     //һͻռ䣬__wt_txn_global_initÿsessionӦWT_TXN_STATEĸֵ__wt_txn_get_snapshot
 	WT_TXN_STATE *states;		/* Per-session transaction states */ 
+
+	/*
+	 * If configured, bitmaps of the sessions that have published an ID or a
+	 * pinned ID in the transaction states, so scans of the states can skip
+	 * the idle sessions, see __wt_txn_state_next.
+	 *
+	 * Every transaction begin and commit updates a bit, so the bits are
+	 * interleaved across words, each on its own cache line: session N's
+	 * bit is bit N / states_words of word N % states_words, and sessions
+	 * with adjacent IDs, usually the busy ones, update different lines.
+	 */
+	bool states_track;		/* Track active sessions */
+	uint32_t states_words;		/* Words in each bitmap */
+	volatile uint64_t *states_id;	/* Sessions with an ID */
+	volatile uint64_t *states_pinned;/* Sessions with a pinned ID */
 };
 
 //Բοhttps://blog.csdn.net/yuanrxdu/article/details/78339295
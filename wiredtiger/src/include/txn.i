@@ -618,6 +618,81 @@ __wt_txn_autocommit_check(WT_SESSION_IMPL *session)
 	return (0);
 }
 
+/*
+ * __wt_txn_state_track --
+ *	Set or clear the session's bit in one of the bitmaps tracking active
+ * transaction states.
+ */
+static inline void
+__wt_txn_state_track(
+    WT_SESSION_IMPL *session, volatile uint64_t *bitmap, bool active)
+{
+	WT_TXN_GLOBAL *txn_global;
+	volatile uint64_t *word;
+	uint64_t mask, v;
+
+	txn_global = &S2C(session)->txn_global;
+	if (!txn_global->states_track)
+		return;
+
+	/*
+	 * Only this session sets or clears its own bit, other sessions may be
+	 * updating other bits in the same word: the compare-and-swap also acts
+	 * as the barrier ensuring the bit is set before the caller publishes
+	 * a value in its transaction state.
+	 */
+	word = &WT_TXN_STATE_WORD(
+	    bitmap, session->id % txn_global->states_words);
+	mask = (uint64_t)1 << (session->id / txn_global->states_words);
+	for (;;) {
+		v = *word;
+		if (((v & mask) != 0) == active)
+			break;
+		if (__wt_atomic_casv64(word, v, active ? v | mask : v & ~mask))
+			break;
+	}
+}
+
+/*
+ * __wt_txn_state_next --
+ *	Return the next transaction state to check in a scan of the global
+ * table, starting from the position referenced by slotp and setting slotp to
+ * the position returned, or NULL at the end of the table. If active sessions
+ * are tracked, positions are bits in the bitmaps rather than slots in the
+ * table, and sessions that have published neither a transaction ID nor, if
+ * checking pinned IDs, a pinned ID, are skipped.
+ */
+static inline WT_TXN_STATE *
+__wt_txn_state_next(WT_SESSION_IMPL *session,
+    uint32_t session_cnt, bool pinned, uint32_t *slotp)
+{
+	WT_TXN_GLOBAL *txn_global;
+	uint64_t bits;
+	uint32_t i, id, w, words;
+
+	txn_global = &S2C(session)->txn_global;
+
+	i = *slotp;
+	if (!txn_global->states_track)
+		return (i < session_cnt ? &txn_global->states[i] : NULL);
+
+	words = txn_global->states_words;
+	while (i < words * 64) {
+		w = i / 64;
+		bits = WT_TXN_STATE_WORD(txn_global->states_id, w);
+		if (pinned)
+			bits |= WT_TXN_STATE_WORD(txn_global->states_pinned, w);
+		for (bits >>= i % 64; bits != 0; bits >>= 1, ++i)
+			if ((bits & 1) != 0 &&
+			    (id = (i % 64) * words + w) < session_cnt) {
+				*slotp = i;
+				return (&txn_global->states[id]);
+			}
+		i = (w + 1) * 64;
+	}
+	return (NULL);
+}
+
 /*
  * __wt_txn_idle_cache_check --
  *	If there is no transaction active in this thread and we haven't checked
@@ -688,6 +763,7 @@ __wt_txn_id_alloc(WT_SESSION_IMPL *session, bool publish)
 
 	if (publish) {
 		session->txn.id = id;
+		__wt_txn_state_track(session, txn_global->states_id, true);
 		WT_PUBLISH(txn_state->id, id);
 	}
 
@@ -854,6 +930,7 @@ __wt_txn_cursor_op(WT_SESSION_IMPL *session)
 	 * positioned on a value, it can't be freed.
 	 */
 	if (txn->isolation == WT_ISO_READ_UNCOMMITTED) {
+		__wt_txn_state_track(session, txn_global->states_pinned, true);
 		if (txn_state->pinned_id == WT_TXN_NONE)
 			txn_state->pinned_id = txn_global->last_running;
 		if (txn_state->metadata_pinned == WT_TXN_NONE)
@@ -872,21 +949,21 @@ __wt_txn_am_oldest(WT_SESSION_IMPL *session)
 {
 	WT_CONNECTION_IMPL *conn;
 	WT_TXN *txn;
-	WT_TXN_GLOBAL *txn_global;
 	WT_TXN_STATE *s;
 	uint64_t id;
 	uint32_t i, session_cnt;
 
 	conn = S2C(session);
 	txn = &session->txn; 
-	txn_global = &conn->txn_global;
 
 	if (txn->id == WT_TXN_NONE)
 		return (false);
 
 	WT_ORDERED_READ(session_cnt, conn->session_cnt);
 	//idȵǰϵͳеidС˵ϵid
-	for (i = 0, s = txn_global->states; i < session_cnt; i++, s++)
+	for (i = 0;
+	    (s = __wt_txn_state_next(session, session_cnt, false, &i)) != NULL;
+	    ++i)
 		if ((id = s->id) != WT_TXN_NONE && WT_TXNID_LT(id, txn->id))
 			return (false);
 
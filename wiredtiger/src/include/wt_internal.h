@@ -84,6 +84,8 @@ struct __wt_block_desc;
     typedef struct __wt_block_desc WT_BLOCK_DESC;
 struct __wt_block_header;
     typedef struct __wt_block_header WT_BLOCK_HEADER;
+struct __wt_block_sched;
+    typedef struct __wt_block_sched WT_BLOCK_SCHED;
 struct __wt_bloom;
     typedef struct __wt_bloom WT_BLOOM;
 struct __wt_bloom_hash;
@@ -100,8 +102,16 @@ struct __wt_cell;
     typedef struct __wt_cell WT_CELL;
 struct __wt_cell_unpack;
     typedef struct __wt_cell_unpack WT_CELL_UNPACK;
+struct __wt_change_buffer;
+    typedef struct __wt_change_buffer WT_CHANGE_BUFFER;
 struct __wt_ckpt;
     typedef struct __wt_ckpt WT_CKPT;
+struct __wt_ckpt_leaf;
+    typedef struct __wt_ckpt_leaf WT_CKPT_LEAF;
+struct __wt_ckpt_leaves;
+    typedef struct __wt_ckpt_leaves WT_CKPT_LEAVES;
+struct __wt_ckpt_work;
+    typedef struct __wt_ckpt_work WT_CKPT_WORK;
 struct __wt_col;
     typedef struct __wt_col WT_COL;
 struct __wt_col_rle;
@@ -172,6 +182,8 @@ struct __wt_evict_entry;
     typedef struct __wt_evict_entry WT_EVICT_ENTRY;
 struct __wt_evict_queue;
     typedef struct __wt_evict_queue WT_EVICT_QUEUE;
+struct __wt_evict_shard;
+    typedef struct __wt_evict_shard WT_EVICT_SHARD;
 struct __wt_ext;
     typedef struct __wt_ext WT_EXT;
 struct __wt_extlist;
@@ -206,6 +218,10 @@ struct __wt_log;
     typedef struct __wt_log WT_LOG;
 struct __wt_log_desc;
     typedef struct __wt_log_desc WT_LOG_DESC;
+struct __wt_log_join_group;
+    typedef struct __wt_log_join_group WT_LOG_JOIN_GROUP;
+struct __wt_log_join_req;
+    typedef struct __wt_log_join_req WT_LOG_JOIN_REQ;
 struct __wt_log_op_desc;
     typedef struct __wt_log_op_desc WT_LOG_OP_DESC;
 struct __wt_log_rec_desc;
@@ -264,10 +280,16 @@ struct __wt_page_modify;
     typedef struct __wt_page_modify WT_PAGE_MODIFY;
 struct __wt_process;
     typedef struct __wt_process WT_PROCESS;
+struct __wt_read_ahead_entry;
+    typedef struct __wt_read_ahead_entry WT_READ_AHEAD_ENTRY;
 struct __wt_ref;
     typedef struct __wt_ref WT_REF;
 struct __wt_row;
     typedef struct __wt_row WT_ROW;
+struct __wt_row_hash;
+    typedef struct __wt_row_hash WT_ROW_HASH;
+struct __wt_row_hash_bucket;
+    typedef struct __wt_row_hash_bucket WT_ROW_HASH_BUCKET;
 struct __wt_rwlock;
     typedef struct __wt_rwlock WT_RWLOCK;
 struct __wt_salvage_cookie;
@@ -304,6 +326,10 @@ struct __wt_txn_state;
     typedef struct __wt_txn_state WT_TXN_STATE;
 struct __wt_update;
     typedef struct __wt_update WT_UPDATE;
+struct __wt_uring;
+    typedef struct __wt_uring WT_URING;
+struct __wt_uring_req;
+    typedef struct __wt_uring_req WT_URING_REQ;
 union __wt_lsn;
     typedef union __wt_lsn WT_LSN;
 union __wt_rand_state;
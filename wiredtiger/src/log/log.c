@@ -11,13 +11,14 @@
 static int __log_newfile(WT_SESSION_IMPL *, bool, bool *);
 static int __log_openfile(WT_SESSION_IMPL *, uint32_t, uint32_t, WT_FH **);
 static int __log_write_internal(
-	WT_SESSION_IMPL *, WT_ITEM *, WT_LSN *, uint32_t);
+	WT_SESSION_IMPL *, WT_ITEM *, WT_LSN *, uint32_t, uint32_t);
 
 #define	WT_LOG_COMPRESS_SKIP	(offsetof(WT_LOG_RECORD, record))
 #define	WT_LOG_ENCRYPT_SKIP	(offsetof(WT_LOG_RECORD, record))
 
 /* Flags to __log_openfile */
 #define	WT_LOG_OPEN_CREATE_OK	0x01
+#define	WT_LOG_OPEN_TMPNAME	0x02	/* Existing temporary file */
 
 /*
  * __wt_log_printf --
@@ -35,12 +36,31 @@ __wt_log_printf(WT_SESSION_IMPL *session, const char *fmt, ...)
 	return (ret);
 }
 
+/*
+ * __log_salt --
+ *	Return the value stored checksums are salted with for a record at an
+ *	offset in a log file.  Records in files that may be recycled are salted
+ *	with the log file number, so stale records left from the file's earlier
+ *	use don't match.  The file header is never salted.
+ */
+static inline uint32_t
+__log_salt(uint32_t salt, wt_off_t offset)
+{
+	if (offset == 0)
+		return (0);
+#ifdef WORDS_BIGENDIAN
+	salt = __wt_bswap32(salt);
+#endif
+	return (salt);
+}
+
 /*
  * __log_checksum_match --
  *	Given a log record, return whether the checksum matches.
  */
 static bool
-__log_checksum_match(WT_SESSION_IMPL *session, WT_ITEM *buf, uint32_t reclen)
+__log_checksum_match(
+    WT_SESSION_IMPL *session, WT_ITEM *buf, uint32_t reclen, uint32_t salt)
 {
 	WT_LOG_RECORD *logrec;
 	uint32_t checksum_calculate, checksum_tmp;
@@ -54,7 +74,7 @@ __log_checksum_match(WT_SESSION_IMPL *session, WT_ITEM *buf, uint32_t reclen)
 	checksum_calculate = __wt_bswap32(checksum_calculate);
 #endif
 	logrec->checksum = checksum_tmp;
-	return (logrec->checksum == checksum_calculate);
+	return (logrec->checksum == (checksum_calculate ^ salt));
 }
 
 /*
@@ -176,7 +196,7 @@ __log_fs_write(WT_SESSION_IMPL *session,
 	 * writes to the previous log file to complete otherwise there could
 	 * be a hole at the end of the previous log file that we cannot detect.
 	 */
-	if (S2C(session)->log->log_version != WT_LOG_VERSION &&
+	if (S2C(session)->log->log_version < WT_LOG_VERSION_SYSTEM &&
 	    slot->slot_release_lsn.l.file < slot->slot_start_lsn.l.file) {
 		__log_wait_for_earlier_slot(session, slot);
 		
@@ -188,6 +208,54 @@ __log_fs_write(WT_SESSION_IMPL *session,
 	return (ret);
 }
 
+/*
+ * __log_fs_submit --
+ *	Submit the write of a slot's buffered records through the log's
+ *	io_uring.  A synchronous write is followed by a data sync of the log
+ *	file, linked to the write, and waited for; otherwise, the slot's write
+ *	is in flight until the wrlsn thread sees its request complete.
+ */
+static int
+__log_fs_submit(WT_SESSION_IMPL *session,
+    WT_LOGSLOT *slot, void *buf, size_t len, bool sync)
+{
+	WT_DECL_RET;
+	WT_LOG *log;
+	WT_URING_REQ *req;
+
+	log = S2C(session)->log;
+	req = &log->slot_io[slot - log->slot_pool];
+
+	/* File handles the ring can't use fall back to synchronous I/O. */
+	if ((ret = __wt_uring_submit(session, log->uring, slot->slot_fh,
+	    slot->slot_start_offset, len, buf, sync, req)) == ENOTSUP)
+		return (ret);
+	if (ret == 0 && sync)
+		ret = __wt_uring_wait(session, log->uring, req);
+	if (ret != 0)
+		WT_PANIC_MSG(session, ret,
+		    "%s: fatal log failure", slot->slot_fh->name);
+	else if (sync)
+		WT_STAT_CONN_INCR(session, log_io_uring_sync);
+	else
+		WT_STAT_CONN_INCR(session, log_io_uring_write);
+	return (ret);
+}
+
+/*
+ * __log_group_commit_sync --
+ *	Note the time taken to sync the log.
+ */
+static void
+__log_group_commit_sync(WT_SESSION_IMPL *session, uint64_t usecs)
+{
+	WT_LOG *log;
+
+	log = S2C(session)->log;
+	log->gc_sync_usecs = log->gc_sync_usecs == 0 ?
+	    usecs : (7 * log->gc_sync_usecs + usecs) / 8;
+}
+
 /*
  * __wt_log_ckpt --
  *	Record the given LSN as the checkpoint LSN and signal the archive
@@ -220,6 +288,9 @@ __wt_log_flush_lsn(WT_SESSION_IMPL *session, WT_LSN *lsn, bool start)
 	conn = S2C(session);
 	log = conn->log;
 	WT_RET(__wt_log_force_write(session, 1, NULL));
+	/* Wait for writes in flight so the LSN includes the forced records. */
+	if (log->uring != NULL)
+		WT_RET(__wt_uring_drain(session, log->uring));
 	__wt_log_wrlsn(session, NULL);
 	if (start)
 		*lsn = log->write_start_lsn;
@@ -324,6 +395,7 @@ __wt_log_force_sync(WT_SESSION_IMPL *session, WT_LSN *min_lsn)
 		WT_ERR(__wt_fsync(session, log_fh, true));
 		__wt_epoch(session, &fsync_stop);
 		fsync_duration_usecs = WT_TIMEDIFF_US(fsync_stop, fsync_start);
+		__log_group_commit_sync(session, fsync_duration_usecs);
 		log->sync_lsn = *min_lsn;
 		WT_STAT_CONN_INCR(session, log_sync);
 		WT_STAT_CONN_INCRV(session,
@@ -752,6 +824,34 @@ __log_decrypt(WT_SESSION_IMPL *session, WT_ITEM *in, WT_ITEM *out)
 	return (__wt_decrypt(session, encryptor, WT_LOG_ENCRYPT_SKIP, in, out));
 }
 
+/*
+ * __log_record_finish --
+ *	Zero-pad a log record to its allocated length and fill in its header.
+ */
+static void
+__log_record_finish(WT_LOG_RECORD *logrec, size_t size, uint32_t rdup_len)
+{
+	/*
+	 * If the record only partially fills the necessary space, we need to
+	 * zero-fill the remainder.
+	 */
+	if (size != rdup_len)
+		memset((uint8_t *)logrec + size, 0, rdup_len - size);
+
+	/*
+	 * Checksum a little-endian version of the header, and write everything
+	 * in little-endian format. The checksum is (potentially) returned in a
+	 * big-endian format, swap it into place in a separate step.
+	 */
+	logrec->len = rdup_len;
+	logrec->checksum = 0;
+	__wt_log_record_byteswap(logrec);
+	logrec->checksum = __wt_checksum(logrec, rdup_len);
+#ifdef WORDS_BIGENDIAN
+	logrec->checksum = __wt_bswap32(logrec->checksum);
+#endif
+}
+
 /*
  * __wt_log_fill --
  *	Copy a thread's log records into the assigned slot.
@@ -764,7 +864,9 @@ __wt_log_fill(WT_SESSION_IMPL *session,
     WT_MYSLOT *myslot, bool force, WT_ITEM *record, WT_LSN *lsnp)
 {
 	WT_DECL_RET;
-
+	WT_LOG_RECORD *logrec;
+	size_t len;
+	uint32_t salt;
 
 	/*
 	 * Call write or copy into the buffer.  For now the offset is the
@@ -772,18 +874,34 @@ __wt_log_fill(WT_SESSION_IMPL *session,
 	 * is where we would multiply by WT_LOG_ALIGN to get the real file byte
 	 * offset for write().
 	 */
-	if (!force && !F_ISSET(myslot, WT_MYSLOT_UNBUFFERED)) /*дslot,Чʸã*/
-		memcpy((char *)myslot->slot->slot_buf.mem + myslot->offset,
-		    record->mem, record->size);
-	else /*־ֱ̲ҪȴIO*/
+	len = record->size;
+	if (!force && !F_ISSET(myslot, WT_MYSLOT_UNBUFFERED)) { /*дslot,Чʸã*/
+		/*
+		 * Buffered records are finished in the slot: the caller's
+		 * record is copied once, then padded and checksummed in place.
+		 */
+		len = (size_t)(myslot->end_offset - myslot->offset);
+		logrec = (WT_LOG_RECORD *)
+		    ((uint8_t *)myslot->slot->slot_buf.mem + myslot->offset);
+		memcpy(logrec, record->mem, record->size);
+		__log_record_finish(logrec, record->size, (uint32_t)len);
+	} else { /*־ֱ̲ҪȴIO*/
 		/*
 		 * If this is a force or unbuffered write, write it now.
+		 * Buffered records are salted when the slot is written.
 		 */
-		WT_ERR(__log_fs_write(session, myslot->slot,
+		salt = __log_salt(myslot->slot->slot_salt,
+		    myslot->offset + myslot->slot->slot_start_offset);
+		logrec = (WT_LOG_RECORD *)record->mem;
+		logrec->checksum ^= salt;
+		ret = __log_fs_write(session, myslot->slot,
 		    myslot->offset + myslot->slot->slot_start_offset,
-		    record->size, record->mem));
+		    record->size, record->mem);
+		logrec->checksum ^= salt;
+		WT_ERR(ret);
+	}
 
-	WT_STAT_CONN_INCRV(session, log_bytes_written, record->size);
+	WT_STAT_CONN_INCRV(session, log_bytes_written, len);
 	if (lsnp != NULL) {
 		*lsnp = myslot->slot->slot_start_lsn;
 		lsnp->l.offset += (uint32_t)myslot->offset;
@@ -835,6 +953,12 @@ __log_file_header(
 	desc->log_magic = WT_LOG_MAGIC;
 	desc->version = log->log_version;
 	desc->log_size = (uint64_t)conn->log_file_max;
+	if (FLD_ISSET(conn->log_flags, WT_CONN_LOG_RECYCLE) &&
+	    log->log_version >= WT_LOG_VERSION_SALTED)
+		F_SET(desc, WT_LOG_DESC_SALTED);
+	if (FLD_ISSET(conn->log_flags, WT_CONN_LOG_COMPRESS_SLOTS) &&
+	    log->log_version >= WT_LOG_VERSION_FRAMES)
+		F_SET(desc, WT_LOG_DESC_FRAMES);
 	__wt_log_desc_byteswap(desc);
 
 	/*
@@ -904,8 +1028,9 @@ __log_openfile(
 	 * If we are creating the file then we use a temporary file name.
 	 * Otherwise it is a log file name.
 	 */
-	if (LF_ISSET(WT_LOG_OPEN_CREATE_OK)) {
-		wtopen_flags = WT_FS_OPEN_CREATE;
+	if (LF_ISSET(WT_LOG_OPEN_CREATE_OK | WT_LOG_OPEN_TMPNAME)) {
+		wtopen_flags =
+		    LF_ISSET(WT_LOG_OPEN_CREATE_OK) ? WT_FS_OPEN_CREATE : 0;
 		WT_ERR(__log_filename(session, id, WT_LOG_TMPNAME, buf));
 	} else {
 		wtopen_flags = 0;
@@ -930,7 +1055,7 @@ err:	__wt_scr_free(session, &buf);
 //־ļжϼ
 static int
 __log_open_verify(WT_SESSION_IMPL *session, uint32_t id, WT_FH **fhp,
-    WT_LSN *lsnp, uint16_t *versionp)
+    WT_LSN *lsnp, uint16_t *versionp, uint32_t *saltp, bool *framesp)
 {
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_ITEM(buf);
@@ -939,7 +1064,7 @@ __log_open_verify(WT_SESSION_IMPL *session, uint32_t id, WT_FH **fhp,
 	WT_LOG *log;
 	WT_LOG_DESC *desc;
 	WT_LOG_RECORD *logrec;
-	uint32_t allocsize, rectype;
+	uint32_t allocsize, rectype, salt;
 	const uint8_t *end, *p;
 
 	conn = S2C(session);
@@ -985,6 +1110,13 @@ __log_open_verify(WT_SESSION_IMPL *session, uint32_t id, WT_FH **fhp,
 	 */
 	if (versionp != NULL)
 		*versionp = desc->version;
+	salt = desc->version >= WT_LOG_VERSION_SALTED &&
+	    F_ISSET(desc, WT_LOG_DESC_SALTED) ? id : 0;
+	if (saltp != NULL)
+		*saltp = salt;
+	if (framesp != NULL)
+		*framesp = desc->version >= WT_LOG_VERSION_FRAMES &&
+		    F_ISSET(desc, WT_LOG_DESC_FRAMES);
 
 	/*
 	 * Skip reading in the previous LSN if log file is an old version
@@ -1009,7 +1141,8 @@ __log_open_verify(WT_SESSION_IMPL *session, uint32_t id, WT_FH **fhp,
 		goto err;
 	}
 
-	if (!__log_checksum_match(session, buf, allocsize))
+	if (!__log_checksum_match(
+	    session, buf, allocsize, __log_salt(salt, allocsize)))
 		WT_ERR_MSG(session, WT_ERROR,
 		    "%s: System log record checksum mismatch", fh->name);
 
@@ -1185,7 +1318,9 @@ __log_newfile(WT_SESSION_IMPL *session, bool conn_open, bool *created)
 	 * window where another thread could see a NULL log file handle.
 	 */
 	/*´־ļ жϼ*/
-	WT_RET(__log_open_verify(session, log->fileid, &log_fh, NULL, NULL));
+	WT_RET(__log_open_verify(
+	    session, log->fileid, &log_fh, NULL, NULL,
+	    &log->log_salt, &log->log_frames));
 	/*
 	 * Write the LSN at the end of the last record in the previous log file
 	 * as the first record in this log file.
@@ -1205,7 +1340,7 @@ __log_newfile(WT_SESSION_IMPL *session, bool conn_open, bool *created)
 	 * If we're running the version where we write a system record
 	 * do so now and update the alloc_lsn.
 	 */
-	if (log->log_version == WT_LOG_VERSION) {
+	if (log->log_version >= WT_LOG_VERSION_SYSTEM) {
 		WT_RET(__wt_log_system_record(session,
 		    log_fh, &logrec_lsn));
 		WT_SET_LSN(&log->alloc_lsn, log->fileid, log->first_record);
@@ -1357,9 +1492,9 @@ __wt_log_acquire(WT_SESSION_IMPL *session, uint64_t recsize, WT_LOGSLOT *slot)
 	if (log->alloc_lsn.l.offset == log->first_record && created_log)
 		WT_RET(__log_prealloc(session, log->log_fh));
 	/*
-	 * Initialize the slot for activation.
+	 * Set the slot's starting position in the log.
 	 */
-	__wt_log_slot_activate(session, slot);
+	__wt_log_slot_position(session, slot);
 
 	return (0);
 }
@@ -1523,6 +1658,70 @@ err:	__wt_scr_free(session, &from_path);
 	return (ret);
 }
 
+/*
+ * __wt_log_recycle --
+ *	Given the number of an archived log file, reuse the file as a
+ *	pre-allocated log file: move it to a temporary file, write a new
+ *	header and move it into the pre-allocated files.
+ */
+int
+__wt_log_recycle(WT_SESSION_IMPL *session, uint32_t lognum)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_ITEM(from_path);
+	WT_DECL_ITEM(tmp_path);
+	WT_DECL_ITEM(to_path);
+	WT_DECL_RET;
+	WT_FH *log_fh;
+	WT_LOG *log;
+	wt_off_t size;
+	uint32_t prep_id, tmp_id;
+
+	conn = S2C(session);
+	log = conn->log;
+	log_fh = NULL;
+
+	WT_RET(__wt_scr_alloc(session, 0, &from_path));
+	WT_ERR(__wt_scr_alloc(session, 0, &tmp_path));
+	WT_ERR(__wt_scr_alloc(session, 0, &to_path));
+	tmp_id = __wt_atomic_add32(&log->tmp_fileid, 1);
+	prep_id = __wt_atomic_add32(&log->prep_fileid, 1);
+	WT_ERR(__log_filename(session, lognum, WT_LOG_FILENAME, from_path));
+	WT_ERR(__log_filename(session, tmp_id, WT_LOG_TMPNAME, tmp_path));
+	WT_ERR(__log_filename(session, prep_id, WT_LOG_PREPNAME, to_path));
+	__wt_spin_lock(session, &log->log_fs_lock);
+	__wt_verbose(session, WT_VERB_LOG,
+	    "log_recycle: recycle log %s to %s",
+	    (const char *)from_path->data, (const char *)to_path->data);
+
+	/*
+	 * The file keeps its old records after the header: they are salted
+	 * with the old log file number, or not at all, and are never read as
+	 * records of the new file.  Only the size of the file is adjusted in
+	 * case the maximum log file size changed.
+	 */
+	WT_ERR(__wt_fs_rename(
+	    session, from_path->data, tmp_path->data, false));
+	WT_ERR(__log_openfile(session, tmp_id, WT_LOG_OPEN_TMPNAME, &log_fh));
+	WT_ERR(__log_file_header(session, log_fh, NULL, true));
+	WT_ERR(__wt_filesize(session, log_fh, &size));
+	if (size > conn->log_file_max)
+		WT_ERR_ERROR_OK(__wt_ftruncate(
+		    session, log_fh, conn->log_file_max), ENOTSUP);
+	WT_ERR(__log_prealloc(session, log_fh));
+	WT_ERR(__wt_fsync(session, log_fh, true));
+	WT_ERR(__wt_close(session, &log_fh));
+	WT_ERR(__wt_fs_rename(session, tmp_path->data, to_path->data, false));
+	WT_STAT_CONN_INCR(session, log_prealloc_recycled);
+
+err:	__wt_scr_free(session, &from_path);
+	__wt_scr_free(session, &tmp_path);
+	__wt_scr_free(session, &to_path);
+	__wt_spin_unlock(session, &log->log_fs_lock);
+	WT_TRET(__wt_close(session, &log_fh));
+	return (ret);
+}
+
 /*
  * __wt_log_remove --
  *	Given a log number, remove that log file.
@@ -1635,7 +1834,7 @@ __wt_log_open(WT_SESSION_IMPL *session)
 				 * have to close the file.
 				 */
 				WT_ERR(__log_open_verify(session,
-				    lognum, NULL, NULL, &version));
+				    lognum, NULL, NULL, &version, NULL, NULL));
 				/*
 				 * If we find any log file at the wrong version
 				 * set the flag and we're done.
@@ -1757,6 +1956,97 @@ err:	__wt_free(session, buf);
 	return (ret);
 }
 
+/*
+ * __log_sync_commits_stat --
+ *	Update the synchronous commits per log sync histogram.
+ */
+static void
+__log_sync_commits_stat(WT_SESSION_IMPL *session, uint32_t commits)
+{
+	if (commits < 2)
+		WT_STAT_CONN_INCR(session, log_sync_commits_lt2);
+	else if (commits < 4)
+		WT_STAT_CONN_INCR(session, log_sync_commits_lt4);
+	else if (commits < 8)
+		WT_STAT_CONN_INCR(session, log_sync_commits_lt8);
+	else if (commits < 16)
+		WT_STAT_CONN_INCR(session, log_sync_commits_lt16);
+	else
+		WT_STAT_CONN_INCR(session, log_sync_commits_ge16);
+}
+
+/*
+ * __log_slot_compress --
+ *	Compress a slot's buffered records into a single frame record.  The
+ *	frame keeps the slot's place in the log: only the compressed bytes are
+ *	written and a scan passes over the rest of the slot's range.  Return
+ *	the slot's buffer unchanged if compression doesn't gain at least one
+ *	allocation unit.
+ */
+static int
+__log_slot_compress(WT_SESSION_IMPL *session,
+    WT_LOGSLOT *slot, void **bufp, size_t *lenp)
+{
+	WT_COMPRESSOR *compressor;
+	WT_LOG *log;
+	WT_LOG_RECORD *frame;
+	size_t dst_len, len, rdup_len, result_len;
+	int compression_failed;
+
+	compressor = S2C(session)->log_compressor;
+	log = S2C(session)->log;
+	len = *lenp;
+
+	/* The frame header takes an allocation unit of its own. */
+	if (len < 2 * log->allocsize) {
+		WT_STAT_CONN_INCR(session, log_compress_slot_fails);
+		return (0);
+	}
+
+	if (compressor->pre_size == NULL)
+		dst_len = len;
+	else
+		WT_RET(compressor->pre_size(compressor,
+		    &session->iface, slot->slot_buf.mem, len, &dst_len));
+	WT_RET(__wt_buf_init(session, &slot->slot_frame,
+	    WT_LOG_COMPRESS_SKIP + dst_len + log->allocsize));
+	frame = (WT_LOG_RECORD *)slot->slot_frame.mem;
+
+	compression_failed = 0;
+	WT_RET(compressor->compress(compressor, &session->iface,
+	    slot->slot_buf.mem, len, (uint8_t *)frame + WT_LOG_COMPRESS_SKIP,
+	    dst_len, &result_len, &compression_failed));
+	result_len += WT_LOG_COMPRESS_SKIP;
+	rdup_len = __wt_rduppo2((uint32_t)result_len, log->allocsize);
+	if (compression_failed || rdup_len >= len) {
+		WT_STAT_CONN_INCR(session, log_compress_slot_fails);
+		return (0);
+	}
+	WT_STAT_CONN_INCR(session, log_compress_slots);
+	WT_STAT_CONN_INCRV(session, log_compress_mem, len);
+	WT_STAT_CONN_INCRV(session, log_compress_len, result_len);
+
+	/*
+	 * The frame's in-memory length is the slot's buffer: its records
+	 * follow the header as if it were a compressed log record.
+	 */
+	memset(frame, 0, WT_LOG_COMPRESS_SKIP);
+	memset((uint8_t *)frame + result_len, 0, rdup_len - result_len);
+	frame->len = (uint32_t)result_len;
+	frame->flags = WT_LOG_RECORD_FRAME;
+	frame->mem_len = WT_STORE_SIZE(len + WT_LOG_COMPRESS_SKIP);
+	__wt_log_record_byteswap(frame);
+	frame->checksum = __wt_checksum(frame, result_len);
+#ifdef WORDS_BIGENDIAN
+	frame->checksum = __wt_bswap32(frame->checksum);
+#endif
+	frame->checksum ^= __log_salt(slot->slot_salt, slot->slot_start_offset);
+
+	*bufp = frame;
+	*lenp = rdup_len;
+	return (0);
+}
+
 /*
  * __wt_log_release --
  *	Release a log slot.
@@ -1769,17 +2059,21 @@ __wt_log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, bool *freep)
 	WT_DECL_RET;
 	WT_LOG *log;
 	WT_LSN sync_lsn;
+	size_t write_len;
 	uint64_t fsync_duration_usecs;
 	int64_t release_buffered, release_bytes;
-	bool locked;
+	void *write_buf;
+	bool async, handoff, linked, locked;
 
 	conn = S2C(session);
 	log = conn->log;
-	locked = false;
+	linked = locked = false;
 	if (freep != NULL)
 		*freep = 1;
 	release_buffered = WT_LOG_SLOT_RELEASED_BUFFERED(slot->slot_state);
 	release_bytes = release_buffered + slot->slot_unbuffered;
+	write_buf = slot->slot_buf.mem;
+	write_len = (size_t)release_buffered;
 
 	/*
 	 * Checkpoints can be configured based on amount of log written.
@@ -1796,18 +2090,47 @@ __wt_log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, bool *freep)
 		__wt_checkpoint_signal(session, log->log_written);
 	}
 
-	/* Write the buffered records */
-	if (release_buffered != 0) //дݵ־ļWiredTigerLog
-		WT_ERR(__log_fs_write(session, slot, slot->slot_start_offset,
-		    (size_t)release_buffered, slot->slot_buf.mem));
-
 	/*
 	 * If we have to wait for a synchronous operation, we do not pass
 	 * handling of this slot off to the worker thread.  The caller is
 	 * responsible for freeing the slot in that case.  Otherwise the
-	 * worker thread will free it.
+	 * worker thread will free it.  If the worker thread isn't running
+	 * (for example, during recovery), handle the slot here: slots are
+	 * not all consolidated when writing to multiple log streams.
 	 */ //Ҫflushsync
-	if (!F_ISSET(slot, WT_SLOT_FLUSH | WT_SLOT_SYNC | WT_SLOT_SYNC_DIR)) {
+	handoff = conn->log_wrlsn_tid_set &&
+	    !F_ISSET(slot, WT_SLOT_FLUSH | WT_SLOT_SYNC | WT_SLOT_SYNC_DIR);
+
+	/*
+	 * Write the buffered records.  With asynchronous log I/O, the write of
+	 * a slot handed off to the worker thread is submitted and not waited
+	 * for, and the write of a slot we sync is deferred until the earlier
+	 * slots are written, then submitted with the sync linked to it.  The
+	 * first write to a new log file in compatibility mode is synchronous.
+	 */
+	if (release_buffered != 0) { //дݵ־ļWiredTigerLog
+		__wt_log_slot_salt(session, slot, release_buffered);
+		if (slot->slot_compress)
+			WT_ERR(__log_slot_compress(
+			    session, slot, &write_buf, &write_len));
+		async = log->uring != NULL &&
+		    (log->log_version >= WT_LOG_VERSION_SYSTEM ||
+		    slot->slot_release_lsn.l.file >=
+		    slot->slot_start_lsn.l.file);
+		if (async && handoff)
+			ret = __log_fs_submit(
+			    session, slot, write_buf, write_len, false);
+		else if (async && F_ISSET(slot, WT_SLOT_SYNC))
+			linked = true;
+		else
+			ret = ENOTSUP;
+		if (ret == ENOTSUP)
+			ret = __log_fs_write(session, slot,
+			    slot->slot_start_offset, write_len, write_buf);
+		WT_ERR(ret);
+	}
+
+	if (handoff) {
 		if (freep != NULL)
 			*freep = 0;
 		slot->slot_state = WT_LOG_SLOT_WRITTEN;
@@ -1830,11 +2153,26 @@ __wt_log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, bool *freep)
 	 */
 	WT_STAT_CONN_INCR(session, log_release_write_lsn);
 	__log_wait_for_earlier_slot(session, slot);
+	if (linked) {
+		__wt_epoch(session, &fsync_start);
+		if ((ret = __log_fs_submit(session,
+		    slot, write_buf, write_len, true)) == ENOTSUP) {
+			linked = false;
+			ret = __log_fs_write(session, slot,
+			    slot->slot_start_offset, write_len, write_buf);
+		} else if (ret == 0) {
+			__wt_epoch(session, &fsync_stop);
+			__log_group_commit_sync(session,
+			    WT_TIMEDIFF_US(fsync_stop, fsync_start));
+		}
+	}
+	WT_ERR(ret);
 
 	log->write_start_lsn = slot->slot_start_lsn;
 	log->write_lsn = slot->slot_end_lsn;
 
-	WT_ASSERT(session, slot != log->active_slot);
+	WT_ASSERT(session, slot->slot_stream == WT_LOG_STREAM_ORDERED ||
+	    slot != log->active_slot[slot->slot_stream]);
 	//__log_write_internalеwait
 	__wt_cond_signal(session, log->log_write_cond);
 	F_CLR(slot, WT_SLOT_FLUSH);
@@ -1908,14 +2246,24 @@ __wt_log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, bool *freep)
 			    log->log_fh->name,
 			    sync_lsn.l.file, sync_lsn.l.offset);
 			WT_STAT_CONN_INCR(session, log_sync);
-			__wt_epoch(session, &fsync_start);
-			//fysnc
-			WT_ERR(__wt_fsync(session, log->log_fh, true));
-			__wt_epoch(session, &fsync_stop);
-			fsync_duration_usecs =
-			    WT_TIMEDIFF_US(fsync_stop, fsync_start);
-			WT_STAT_CONN_INCRV(session,
-			    log_sync_duration, fsync_duration_usecs);
+			__log_sync_commits_stat(
+			    session, slot->slot_sync_commits);
+			/*
+			 * A linked sync of the file holding our write has
+			 * already completed, the data is stable.
+			 */
+			if (!linked) {
+				__wt_epoch(session, &fsync_start);
+				//fysnc
+				WT_ERR(__wt_fsync(session, log->log_fh, true));
+				__wt_epoch(session, &fsync_stop);
+				fsync_duration_usecs =
+				    WT_TIMEDIFF_US(fsync_stop, fsync_start);
+				WT_STAT_CONN_INCRV(session,
+				    log_sync_duration, fsync_duration_usecs);
+				__log_group_commit_sync(
+				    session, fsync_duration_usecs);
+			}
 			
 			log->sync_lsn = sync_lsn;
 			//__log_write_internalеwait
@@ -1935,6 +2283,95 @@ err:	if (locked)
 	return (ret);
 }
 
+/*
+ * __log_scan_position --
+ *	Return where a scan starting at an LSN in a log file holding slot
+ *	frames begins reading.  Records in a frame aren't found at their own
+ *	LSN: walk the record headers from an earlier record boundary to the
+ *	record or frame holding the LSN.
+ */
+static int
+__log_scan_position(WT_SESSION_IMPL *session, WT_FH *log_fh,
+    wt_off_t log_size, uint32_t allocsize, WT_ITEM *buf, WT_LSN *lsnp)
+{
+	WT_LOG *log;
+	WT_LOG_RECORD *logrec;
+	WT_LSN hint, lsn;
+	uint32_t mem_len, reclen, span;
+	uint16_t flags;
+
+	log = S2C(session)->log;
+
+	/*
+	 * Scans reading the log in order, log cursors in particular, start
+	 * where the last frame read was.  Concurrent scans update the hint,
+	 * read it once, as a single value.
+	 */
+	WT_SET_LSN(&lsn, lsnp->l.file, 0);
+	if (log != NULL) {
+		WT_ORDERED_READ(hint.file_offset, log->frame_hint.file_offset);
+		if (hint.l.file == lsn.l.file && __wt_log_cmp(&hint, lsnp) <= 0)
+			lsn = hint;
+	}
+	while (lsn.l.offset < lsnp->l.offset &&
+	    lsn.l.offset + allocsize <= log_size) {
+		WT_RET(__wt_read(session,
+		    log_fh, lsn.l.offset, (size_t)allocsize, buf->mem));
+		logrec = (WT_LOG_RECORD *)buf->mem;
+		reclen = logrec->len;
+		flags = logrec->flags;
+		mem_len = logrec->mem_len;
+#ifdef WORDS_BIGENDIAN
+		reclen = __wt_bswap32(reclen);
+		flags = __wt_bswap16(flags);
+		mem_len = __wt_bswap32(mem_len);
+#endif
+		if (reclen == 0)
+			break;
+		span = FLD_ISSET(flags, WT_LOG_RECORD_FRAME) ?
+		    mem_len - (uint32_t)WT_LOG_COMPRESS_SKIP :
+		    __wt_rduppo2(reclen, allocsize);
+		if (lsn.l.offset + span > lsnp->l.offset)
+			break;
+		lsn.l.offset += span;
+	}
+	*lsnp = lsn;
+	return (0);
+}
+
+/*
+ * __log_scan_callback --
+ *	Pass a record read by a log scan to the callback, decrypting and
+ *	decompressing it as necessary.
+ */
+static int
+__log_scan_callback(WT_SESSION_IMPL *session, WT_ITEM *record,
+    WT_ITEM *decryptitem, WT_ITEM *uncitem, WT_LSN *lsnp, WT_LSN *next_lsnp,
+    int (*func)(WT_SESSION_IMPL *session,
+    WT_ITEM *record, WT_LSN *lsnp, WT_LSN *next_lsnp,
+    void *cookie, int firstrecord), void *cookie, int firstrecord)
+{
+	WT_ITEM *cbbuf;
+	WT_LOG_RECORD *logrec;
+
+	/*
+	 * We need to manage the different buffers here.  The record is the
+	 * buffer the scan read from the disk.  The callback buffer may change
+	 * based on whether encryption and compression are used.
+	 */
+	logrec = (WT_LOG_RECORD *)record->mem;
+	cbbuf = record;
+	if (F_ISSET(logrec, WT_LOG_RECORD_ENCRYPTED)) {
+		WT_RET(__log_decrypt(session, cbbuf, decryptitem));
+		cbbuf = decryptitem;
+	}
+	if (F_ISSET(logrec, WT_LOG_RECORD_COMPRESSED)) {
+		WT_RET(__log_decompress(session, cbbuf, uncitem));
+		cbbuf = uncitem;
+	}
+	return ((*func)(session, cbbuf, lsnp, next_lsnp, cookie, firstrecord));
+}
+
 /*
  * __wt_log_scan --
  *	Scan the logs, calling a function on each record found.
@@ -1948,27 +2385,30 @@ __wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *lsnp, uint32_t flags,
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_ITEM(buf);
 	WT_DECL_ITEM(decryptitem);
+	WT_DECL_ITEM(frameitem);
 	WT_DECL_ITEM(uncitem);
 	WT_DECL_RET;
 	WT_FH *log_fh;
-	WT_ITEM *cbbuf;
+	WT_ITEM framerec;
 	WT_LOG *log;
 	WT_LOG_RECORD *logrec;
 	WT_LSN end_lsn, next_lsn, prev_eof, prev_lsn, rd_lsn, start_lsn;
+	WT_LSN rec_lsn, rec_next_lsn, skip_lsn;
 	wt_off_t log_size;
-	uint32_t allocsize, firstlog, lastlog, lognum, rdup_len, reclen;
+	uint32_t allocsize, firstlog, lastlog, lognum, rdup_len, reclen, salt;
+	uint32_t frame_len, off;
 	uint16_t version;
 	u_int i, logcount;
 	int firstrecord;
 	char **logfiles;
-	bool eol, partial_record;
+	bool eol, frames, partial_record, recycled_end;
 
 	conn = S2C(session);
 	log = conn->log;
 	log_fh = NULL;
 	logcount = 0;
 	logfiles = NULL;
-	eol = false;
+	eol = recycled_end = false;
 	firstrecord = 1;
 
 	/*
@@ -2068,7 +2508,7 @@ __wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *lsnp, uint32_t flags,
 			start_lsn = *lsnp;
 	}
 	WT_ERR(__log_open_verify(session,
-	    start_lsn.l.file, &log_fh, &prev_lsn, NULL));
+	    start_lsn.l.file, &log_fh, &prev_lsn, NULL, &salt, &frames));
 	WT_ERR(__wt_filesize(session, log_fh, &log_size));
 	rd_lsn = start_lsn;
 	if (LF_ISSET(WT_LOGSCAN_RECOVER))
@@ -2078,11 +2518,25 @@ __wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *lsnp, uint32_t flags,
 
 	WT_ERR(__wt_scr_alloc(session, WT_LOG_ALIGN, &buf));
 	WT_ERR(__wt_scr_alloc(session, 0, &decryptitem));
+	WT_ERR(__wt_scr_alloc(session, 0, &frameitem));
 	WT_ERR(__wt_scr_alloc(session, 0, &uncitem));
+
+	/*
+	 * If the log file holds slot frames, the starting LSN may be a record
+	 * inside a frame: start at the frame and skip the records before the
+	 * starting LSN.
+	 */
+	WT_ZERO_LSN(&skip_lsn);
+	if (frames && rd_lsn.l.offset != 0) {
+		WT_ERR(__log_scan_position(
+		    session, log_fh, log_size, allocsize, buf, &rd_lsn));
+		if (__wt_log_cmp(&rd_lsn, &start_lsn) != 0)
+			skip_lsn = start_lsn;
+	}
 	for (;;) {
 		if (rd_lsn.l.offset + allocsize > log_size) {
 advance:
-			if (rd_lsn.l.offset == log_size)
+			if (rd_lsn.l.offset == log_size || recycled_end)
 				partial_record = false;
 			else
 				/*
@@ -2130,8 +2584,8 @@ advance:
 				    "Recovering log %" PRIu32
 				    " through %" PRIu32,
 				    rd_lsn.l.file, end_lsn.l.file);
-			WT_ERR(__log_open_verify(session,
-			    rd_lsn.l.file, &log_fh, &prev_lsn, &version));
+			WT_ERR(__log_open_verify(session, rd_lsn.l.file,
+			    &log_fh, &prev_lsn, &version, &salt, NULL));
 			/*
 			 * Opening the log file reads with verify sets up the
 			 * previous LSN from the first record.  This detects
@@ -2151,7 +2605,7 @@ advance:
 			 * that header.  We're done.
 			 */
 			if (LF_ISSET(WT_LOGSCAN_RECOVER) &&
-			    version == WT_LOG_VERSION_SYSTEM &&
+			    version >= WT_LOG_VERSION_SYSTEM &&
 			    WT_IS_ZERO_LSN(&prev_lsn)) {
 				__wt_verbose(session, WT_VERB_LOG,
 				    "log_scan: Stopping, no system "
@@ -2159,7 +2613,7 @@ advance:
 				break;
 			}
 			WT_ERR(__wt_filesize(session, log_fh, &log_size));
-			eol = false;
+			eol = recycled_end = false;
 			continue;
 		}
 		/*
@@ -2187,8 +2641,17 @@ advance:
 		 * Otherwise if the rest is all zeroes advance to the next file.
 		 * When recovery finds the end of the log, truncate the file
 		 * and remove any later log files that may exist.
+		 *
+		 * A recycled log file can hold stale records from its earlier
+		 * use after its last record: if there are later log files,
+		 * anything we can't read in a salted log file is the end of
+		 * that file rather than the end of the log.  Recovery checks
+		 * the next file's previous LSN record matches.
 		 */
+		recycled_end = salt != 0 && rd_lsn.l.file < end_lsn.l.file;
 		if (reclen == 0) {
+			if (recycled_end)
+				goto advance;
 			WT_ERR(__log_has_hole(
 			    session, log_fh, log_size, rd_lsn.l.offset, &eol));
 			if (eol)
@@ -2205,6 +2668,8 @@ advance:
 			 * then this is considered the end of the log.
 			 */
 			if (rd_lsn.l.offset + rdup_len > log_size) {
+				if (recycled_end)
+					goto advance;
 				eol = true;
 				break;
 			}
@@ -2229,7 +2694,10 @@ advance:
 		 */
 		buf->size = reclen;
 		logrec = (WT_LOG_RECORD *)buf->mem;
-		if (!__log_checksum_match(session, buf, reclen)) {
+		if (!__log_checksum_match(session,
+		    buf, reclen, __log_salt(salt, rd_lsn.l.offset))) {
+			if (recycled_end)
+				goto advance;
 			/*
 			 * A checksum mismatch means we have reached the end of
 			 * the useful part of the log.  This should be found on
@@ -2256,29 +2724,82 @@ advance:
 		WT_STAT_CONN_INCR(session, log_scan_records);
 		next_lsn = rd_lsn;
 		next_lsn.l.offset += rdup_len;
-		if (rd_lsn.l.offset != 0) {
+		if (rd_lsn.l.offset != 0 &&
+		    F_ISSET(logrec, WT_LOG_RECORD_FRAME)) {
 			/*
-			 * We need to manage the different buffers here.
-			 * Buf is the buffer this function uses to read from
-			 * the disk.  The callback buffer may change based
-			 * on whether encryption and compression are used.
-			 *
-			 * We want to free any buffers from compression and
-			 * encryption but keep the one we use for reading.
+			 * A slot frame: decompress the slot's buffer and pass
+			 * its records to the callback in turn, each at its own
+			 * LSN.  The frame keeps the slot's place in the log,
+			 * the next record follows the slot's records.
 			 */
-			cbbuf = buf;
-			if (F_ISSET(logrec, WT_LOG_RECORD_ENCRYPTED)) {
-				WT_ERR(__log_decrypt(
-				    session, cbbuf, decryptitem));
-				cbbuf = decryptitem;
+			WT_ERR(__log_decompress(session, buf, frameitem));
+			frame_len =
+			    logrec->mem_len - (uint32_t)WT_LOG_COMPRESS_SKIP;
+			next_lsn = rd_lsn;
+			next_lsn.l.offset += frame_len;
+			if (log != NULL)
+				WT_PUBLISH(log->frame_hint.file_offset,
+				    rd_lsn.file_offset);
+			WT_CLEAR(framerec);
+			for (off = 0; off < frame_len; off += rdup_len) {
+				framerec.mem = (uint8_t *)frameitem->mem +
+				    WT_LOG_COMPRESS_SKIP + off;
+				framerec.data = framerec.mem;
+				logrec = (WT_LOG_RECORD *)framerec.mem;
+				reclen = logrec->len;
+#ifdef WORDS_BIGENDIAN
+				reclen = __wt_bswap32(reclen);
+#endif
+				if (reclen == 0)
+					break;
+				rdup_len = __wt_rduppo2(reclen, allocsize);
+				rec_lsn = rec_next_lsn = rd_lsn;
+				rec_lsn.l.offset += off;
+				rec_next_lsn.l.offset += off + rdup_len;
+				if (__wt_log_cmp(&rec_lsn, &skip_lsn) < 0)
+					continue;
+				if (LF_ISSET(WT_LOGSCAN_ONE) &&
+				    !WT_IS_ZERO_LSN(&skip_lsn) &&
+				    __wt_log_cmp(&rec_lsn, &skip_lsn) != 0) {
+					ret = WT_NOTFOUND;
+					break;
+				}
+				WT_ZERO_LSN(&skip_lsn);
+				framerec.size = reclen;
+				__wt_log_record_byteswap(logrec);
+				WT_ERR(__log_scan_callback(session, &framerec,
+				    decryptitem, uncitem, &rec_lsn,
+				    &rec_next_lsn, func, cookie, firstrecord));
+
+				firstrecord = 0;
+
+				if (LF_ISSET(WT_LOGSCAN_ONE))
+					break;
 			}
-			if (F_ISSET(logrec, WT_LOG_RECORD_COMPRESSED)) {
-				WT_ERR(__log_decompress(
-				    session, cbbuf, uncitem));
-				cbbuf = uncitem;
+			if (ret != 0 ||
+			    (LF_ISSET(WT_LOGSCAN_ONE) && firstrecord == 0))
+				break;
+		} else if (rd_lsn.l.offset != 0 &&
+		    __wt_log_cmp(&rd_lsn, &skip_lsn) < 0) {
+			/*
+			 * A record before the starting LSN: the starting LSN
+			 * isn't the start of a record.
+			 */
+			if (LF_ISSET(WT_LOGSCAN_ONE)) {
+				ret = WT_NOTFOUND;
+				break;
+			}
+		} else if (rd_lsn.l.offset != 0) {
+			if (LF_ISSET(WT_LOGSCAN_ONE) &&
+			    !WT_IS_ZERO_LSN(&skip_lsn) &&
+			    __wt_log_cmp(&rd_lsn, &skip_lsn) != 0) {
+				ret = WT_NOTFOUND;
+				break;
 			}
-			WT_ERR((*func)(session,
-			    cbbuf, &rd_lsn, &next_lsn, cookie, firstrecord));
+			WT_ZERO_LSN(&skip_lsn);
+			WT_ERR(__log_scan_callback(session, buf, decryptitem,
+			    uncitem, &rd_lsn, &next_lsn, func, cookie,
+			    firstrecord));
 
 			firstrecord = 0;
 
@@ -2301,9 +2822,11 @@ err:	WT_STAT_CONN_INCR(session, log_scans);
 	/*
 	 * If the first attempt to read a log record results in
 	 * an error recovery is likely going to fail.  Try to provide
-	 * a helpful failure message.
+	 * a helpful failure message.  Reading a single record at the end
+	 * of the log isn't an error, log cursors do it all the time.
 	 */
-	if (ret != 0 && firstrecord) {
+	if (ret != 0 && firstrecord &&
+	    !(LF_ISSET(WT_LOGSCAN_ONE) && ret == WT_NOTFOUND)) {
 		__wt_errx(session,
 		    "WiredTiger is unable to read the recovery log.");
 		__wt_errx(session, "This may be due to the log"
@@ -2318,6 +2841,7 @@ err:	WT_STAT_CONN_INCR(session, log_scans);
 
 	__wt_scr_free(session, &buf);
 	__wt_scr_free(session, &decryptitem);
+	__wt_scr_free(session, &frameitem);
 	__wt_scr_free(session, &uncitem);
 
 	/*
@@ -2338,17 +2862,26 @@ err:	WT_STAT_CONN_INCR(session, log_scans);
 int
 __wt_log_force_write(WT_SESSION_IMPL *session, bool retry, bool *did_work)
 {
+	WT_DECL_RET;
 	WT_LOG *log;
 	WT_MYSLOT myslot;
+	uint32_t stream;
+	bool stream_work, work;
 
 	log = S2C(session)->log;
-	memset(&myslot, 0, sizeof(myslot));
 	WT_STAT_CONN_INCR(session, log_force_write);
+	work = false;
+	for (stream = 0; stream < log->streams; ++stream) {
+		memset(&myslot, 0, sizeof(myslot));
+		myslot.slot = log->active_slot[stream];
+		stream_work = true;
+		WT_TRET(__wt_log_slot_switch(
+		    session, &myslot, retry, true, &stream_work));
+		work = work || stream_work;
+	}
 	if (did_work != NULL)
-		*did_work = true;
-		
-	myslot.slot = log->active_slot;
-	return (__wt_log_slot_switch(session, &myslot, retry, true, did_work));
+		*did_work = work;
+	return (ret);
 }
 
 /*
@@ -2360,6 +2893,18 @@ __wt_log_force_write(WT_SESSION_IMPL *session, bool retry, bool *did_work)
 int
 __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
     uint32_t flags)
+{
+	return (__wt_log_write_stream(
+	    session, record, lsnp, flags, WT_LOG_STREAM_ORDERED));
+}
+
+/*
+ * __wt_log_write_stream --
+ *	Write a record into a log stream, compressing as necessary.
+ */
+int
+__wt_log_write_stream(WT_SESSION_IMPL *session, WT_ITEM *record,
+    WT_LSN *lsnp, uint32_t flags, uint32_t stream)
 {
 	WT_COMPRESSOR *compressor;
 	WT_CONNECTION_IMPL *conn;
@@ -2385,10 +2930,15 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 	if (!F_ISSET(log, WT_LOG_OPENED) || F_ISSET(conn, WT_CONN_READONLY))
 		return (0);
 	ip = record;
+	/*
+	 * If slot buffers are compressed, buffered records are compressed
+	 * with the rest of their slot, not one at a time.
+	 */
 	if ((compressor = conn->log_compressor) != NULL &&
 	    record->size < log->allocsize) {
 		WT_STAT_CONN_INCR(session, log_compress_small);
-	} else if (compressor != NULL) { //ѹ
+	} else if (compressor != NULL && (!log->log_frames ||
+	    record->size >= WT_LOG_SLOT_BUF_MAX)) { //ѹ
 		/* Skip the log header */
 		src = (uint8_t *)record->mem + WT_LOG_COMPRESS_SKIP;
 		src_len = record->size - WT_LOG_COMPRESS_SKIP;
@@ -2476,13 +3026,118 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 		    ip->size < UINT32_MAX);
 	}
 	/*־д*/
-	ret = __log_write_internal(session, ip, lsnp, flags);
+	ret = __log_write_internal(session, ip, lsnp, flags, stream);
 
 err:	__wt_scr_free(session, &citem);
 	__wt_scr_free(session, &eitem);
 	return (ret);
 }
 
+/*
+ * __log_group_commit_delay --
+ *	Note the arrival of a synchronous commit and return how long to delay
+ *	closing its slot, and the number of commits worth waiting for.
+ */
+static uint64_t
+__log_group_commit_delay(
+    WT_SESSION_IMPL *session, uint64_t now, uint32_t *targetp)
+{
+	WT_LOG *log;
+	uint64_t arrival, cap, interval, last, sync;
+	uint32_t waiters;
+
+	log = S2C(session)->log;
+	cap = S2C(session)->log_group_commit_max;
+	*targetp = 0;
+
+	/* Idle periods aren't part of the commit rate: cap the interval. */
+	last = log->gc_last_usecs;
+	log->gc_last_usecs = now;
+	interval = now > last ? WT_MIN(now - last, WT_MILLION) : 0;
+	arrival = log->gc_arrival_usecs =
+	    (7 * log->gc_arrival_usecs + interval) / 8;
+	sync = log->gc_sync_usecs;
+	waiters = log->gc_sync_waiters;
+
+	/*
+	 * Delaying a commit only pays off if other commits are expected to
+	 * arrive while a sync would be running: commits are arriving faster
+	 * than the log syncs, or other commits are waiting for a sync.  When
+	 * every commit syncs on its own, commits can't arrive faster than the
+	 * log syncs, but the waiting threads commit again once their sync
+	 * completes.  Wait for the commits expected during a sync, no longer
+	 * than a sync takes or the configured cap.
+	 */
+	if (cap == 0 || sync == 0 || (arrival >= sync && waiters == 0))
+		return (0);
+	*targetp = (uint32_t)WT_MIN(
+	    WT_MAX(sync / WT_MAX(arrival, 1), waiters) + 1, WT_THOUSAND);
+	return (WT_MIN(cap, sync));
+}
+
+/*
+ * __log_group_commit_wait --
+ *	Delay closing a synchronous commit's slot so concurrent commits can
+ *	join it and share its log sync.
+ */
+static void
+__log_group_commit_wait(
+    WT_SESSION_IMPL *session, WT_MYSLOT *myslot, struct timespec *start)
+{
+	struct timespec now;
+	WT_LOG *log;
+	WT_LOGSLOT *slot;
+	uint64_t delay, elapsed;
+	uint32_t target;
+	u_int yield_count;
+
+	log = S2C(session)->log;
+	slot = myslot->slot;
+
+	if ((delay = __log_group_commit_delay(session,
+	    (uint64_t)start->tv_sec * WT_MILLION +
+	    (uint64_t)start->tv_nsec / WT_THOUSAND, &target)) == 0)
+		return;
+
+	/*
+	 * Stop waiting once enough commits have joined, or another thread
+	 * closed the slot.
+	 */
+	WT_STAT_CONN_INCR(session, log_group_commit_delay);
+	for (yield_count = 0;; ++yield_count) {
+		__wt_epoch(session, &now);
+		elapsed = WT_TIMEDIFF_US(now, *start);
+		if (elapsed >= delay || slot->slot_sync_commits >= target ||
+		    slot != log->active_slot[slot->slot_stream] ||
+		    !WT_LOG_SLOT_OPEN(slot->slot_state))
+			break;
+		if (yield_count < WT_THOUSAND / 10)
+			__wt_yield();
+		else
+			__wt_sleep(0, WT_MIN(delay - elapsed, 100));
+	}
+	WT_STAT_CONN_INCRV(session, log_group_commit_delay_time, elapsed);
+}
+
+/*
+ * __log_commit_latency_stat --
+ *	Update the synchronous commit latency histogram.
+ */
+static void
+__log_commit_latency_stat(WT_SESSION_IMPL *session, uint64_t usecs)
+{
+	if (usecs < 100)
+		WT_STAT_CONN_INCR(session, log_commit_latency_lt100);
+	else if (usecs < 250)
+		WT_STAT_CONN_INCR(session, log_commit_latency_lt250);
+	else if (usecs < WT_THOUSAND)
+		WT_STAT_CONN_INCR(session, log_commit_latency_lt1000);
+	else if (usecs < 10 * WT_THOUSAND)
+		WT_STAT_CONN_INCR(session, log_commit_latency_lt10000);
+	else
+		WT_STAT_CONN_INCR(session, log_commit_latency_ge10000);
+}
+
 /*
  * __log_write_internal --
  *	Write a record into the log.
@@ -2498,20 +3153,21 @@ err:	__wt_scr_free(session, &citem);
 //ÿβ  ɾȲͨ TXN_API_END_RETRY ߵ
 static int
 __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
-    uint32_t flags)
+    uint32_t flags, uint32_t stream)
 {
+	struct timespec start, stop;
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
 	WT_LOG *log;
-	WT_LOG_RECORD *logrec;
 	WT_LSN lsn;
 	WT_MYSLOT myslot;
 	int64_t release_size;
 	uint32_t force, rdup_len;
-	bool free_slot;
+	bool free_slot, sync_waiting;
 
 	conn = S2C(session);
 	log = conn->log;
+	sync_waiting = false;
 
 	if (record->size > UINT32_MAX)
 		WT_RET_MSG(session, EFBIG,
@@ -2521,43 +3177,30 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 	WT_INIT_LSN(&lsn);
 	myslot.slot = NULL;
 	memset(&myslot, 0, sizeof(myslot));
+	if (LF_ISSET(WT_LOG_FSYNC))
+		__wt_epoch(session, &start);
 	/*
 	 * Assume the WT_ITEM the caller passed is a WT_LOG_RECORD, which has a
 	 * header at the beginning for us to fill in.
 	 *
-	 * If using direct_io, the caller should pass us an aligned record.
-	 * But we need to make sure it is big enough and zero-filled so
-	 * that we can write the full amount.  Do this whether or not
-	 * direct_io is in use because it makes the reading code cleaner.
+	 * Records copied into a slot buffer are padded and checksummed in the
+	 * slot, there's no reason to touch the caller's record twice.  Records
+	 * too large for a slot buffer are written from the caller's buffer: if
+	 * using direct_io, the caller should pass us an aligned record.  But we
+	 * need to make sure it is big enough and zero-filled so that we can
+	 * write the full amount.  Do this whether or not direct_io is in use
+	 * because it makes the reading code cleaner.
 	 */
 	WT_STAT_CONN_INCRV(session, log_bytes_payload, record->size);
 	/*ȷlogrecĳ,볤ȵbuf*/
 	rdup_len = __wt_rduppo2((uint32_t)record->size, log->allocsize);
-	WT_ERR(__wt_buf_grow(session, record, rdup_len));
 	WT_ASSERT(session, record->data == record->mem);
-	/*
-	 * If the caller's record only partially fills the necessary
-	 * space, we need to zero-fill the remainder.
-	 */
-	if (record->size != rdup_len) {
-		memset((uint8_t *)record->mem + record->size, 0,
-		    rdup_len - record->size);
+	if (rdup_len > WT_LOG_SLOT_BUF_MAX) {
+		WT_ERR(__wt_buf_grow(session, record, rdup_len));
+		//record->memͷ
+		__log_record_finish(record->mem, record->size, rdup_len);
 		record->size = rdup_len;
 	}
-	/*
-	 * Checksum a little-endian version of the header, and write everything
-	 * in little-endian format. The checksum is (potentially) returned in a
-	 * big-endian format, swap it into place in a separate step.
-	 */
-	 //record->memͷ
-	logrec = (WT_LOG_RECORD *)record->mem;
-	logrec->len = (uint32_t)record->size;
-	logrec->checksum = 0;
-	__wt_log_record_byteswap(logrec);
-	logrec->checksum = __wt_checksum(logrec, record->size);
-#ifdef WORDS_BIGENDIAN
-	logrec->checksum = __wt_bswap32(logrec->checksum);
-#endif
 
 	WT_STAT_CONN_INCR(session, log_writes);
 
@@ -2565,7 +3208,7 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 	 * The only time joining a slot should ever return an error is if it
 	 * detects a panic.
 	 */ /*ѡȡһready slotlog writeлȷдslotԼдλ*/
-	__wt_log_slot_join(session, rdup_len, flags, &myslot);
+	WT_ERR(__wt_log_slot_join(session, rdup_len, flags, stream, &myslot));
 	/*
 	 * If the addition of this record crosses the buffer boundary,
 	 * switch in a new slot.
@@ -2574,9 +3217,35 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 	force = LF_ISSET(WT_LOG_FLUSH | WT_LOG_FSYNC);
 	ret = 0;
 
+	/*
+	 * A synchronous commit closes its log stream's slot to have it synced.
+	 * With group commit configured, delay closing the slot if other
+	 * commits are expected to join it and share the sync.
+	 */
+	if (LF_ISSET(WT_LOG_FSYNC)) {
+		(void)__wt_atomic_addv32(&myslot.slot->slot_sync_commits, 1);
+		if (myslot.slot->slot_stream != WT_LOG_STREAM_ORDERED &&
+		    myslot.end_offset < WT_LOG_SLOT_BUF_MAX &&
+		    !F_ISSET(&myslot, WT_MYSLOT_UNBUFFERED))
+			__log_group_commit_wait(session, &myslot, &start);
+
+		/* From here until its sync completes, the commit waits. */
+		(void)__wt_atomic_addv32(&log->gc_sync_waiters, 1);
+		sync_waiting = true;
+	}
+
    // printf("yang test ............... __log_write_internal  %x  %x  %x  %x\r\n", myslot.end_offset,  WT_LOG_SLOT_BUF_MAX, myslot.flags, force);
-	if (myslot.end_offset >= WT_LOG_SLOT_BUF_MAX || //slotˣҪһµslot
-	    F_ISSET(&myslot, WT_MYSLOT_UNBUFFERED) || force)
+	/*
+	 * A log stream's slot is given its position in the log when it's
+	 * closed: if the caller needs this record's LSN, switch the slot.
+	 * Records written in order across the streams have a closed slot
+	 * of their own.
+	 */
+	if (myslot.slot->slot_stream != WT_LOG_STREAM_ORDERED &&
+	    (myslot.end_offset >= WT_LOG_SLOT_BUF_MAX || //slotˣҪһµslot
+	    F_ISSET(&myslot, WT_MYSLOT_UNBUFFERED) || force ||
+	    (log->streams > 1 &&
+	    (lsnp != NULL || LF_ISSET(WT_LOG_BACKGROUND)))))
 		ret = __wt_log_slot_switch(session, &myslot, true, false, NULL);
 
 	//recordݵslot_buf
@@ -2595,6 +3264,13 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 	WT_ASSERT(session, ret == 0);
 	if (WT_LOG_SLOT_DONE(release_size)) {
 	//ֻWT_LOG_SLOT_UNBUFFEREDʱߵ slotռ䲻ˣǰ»ȡһslotslotǰslotҪ
+		/*
+		 * A log stream's slot may have been closed but not yet placed
+		 * in the log, wait for its position.
+		 */
+		while (!myslot.slot->slot_placed)
+			__wt_yield();
+		WT_READ_BARRIER();
 	
 	    ////дݵ־ļWiredTigerLog
 		WT_ERR(__wt_log_release(session, myslot.slot, &free_slot));
@@ -2628,6 +3304,9 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 		    myslot.slot->slot_error == 0)
 			__wt_cond_wait(
 			    session, log->log_sync_cond, 10000, NULL);
+		__wt_epoch(session, &stop);
+		__log_commit_latency_stat(
+		    session, WT_TIMEDIFF_US(stop, start));
 	}
 
 	/*
@@ -2637,6 +3316,8 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 		__wt_log_background(session, &lsn);
 
 err:
+	if (sync_waiting)
+		(void)__wt_atomic_subv32(&log->gc_sync_waiters, 1);
 	if (ret == 0 && lsnp != NULL)
 		*lsnp = lsn;
 	/*
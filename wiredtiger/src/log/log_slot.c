@@ -51,6 +51,58 @@ __log_slot_dump(WT_SESSION_IMPL *session)
 }
 #endif
 
+/*
+ * __wt_log_slot_position --
+ *	Set a slot's starting position in the log to the current allocation
+ *	point.
+ */
+void
+__wt_log_slot_position(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
+{
+	WT_LOG *log;
+
+	log = S2C(session)->log;
+
+	slot->slot_start_lsn = slot->slot_end_lsn = log->alloc_lsn;
+	slot->slot_start_offset = log->alloc_lsn.l.offset;
+	slot->slot_last_offset = log->alloc_lsn.l.offset;
+	slot->slot_fh = log->log_fh;
+	slot->slot_salt = log->log_salt;
+	slot->slot_compress = log->log_frames;
+}
+
+/*
+ * __wt_log_slot_salt --
+ *	Salt the checksums of the records buffered in a slot before the buffer
+ *	is written.  This isn't done as records are copied into the buffer, a
+ *	log stream's slot doesn't know which log file it's in until it's
+ *	placed in the log.
+ */
+void
+__wt_log_slot_salt(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, int64_t len)
+{
+	WT_LOG_RECORD *logrec;
+	int64_t off;
+	uint32_t allocsize, reclen, salt;
+
+	if ((salt = slot->slot_salt) == 0)
+		return;
+	allocsize = S2C(session)->log->allocsize;
+#ifdef WORDS_BIGENDIAN
+	salt = __wt_bswap32(salt);
+#endif
+	for (off = 0; off < len; off += __wt_rduppo2(reclen, allocsize)) {
+		logrec = (WT_LOG_RECORD *)((uint8_t *)slot->slot_buf.mem + off);
+		reclen = logrec->len;
+#ifdef WORDS_BIGENDIAN
+		reclen = __wt_bswap32(reclen);
+#endif
+		if (reclen == 0)
+			break;
+		logrec->checksum ^= salt;
+	}
+}
+
 /*
  * __wt_log_slot_activate --
  *	Initialize a slot to become active.
@@ -58,12 +110,6 @@ __log_slot_dump(WT_SESSION_IMPL *session)
 void
 __wt_log_slot_activate(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
 {
-	WT_CONNECTION_IMPL *conn;
-	WT_LOG *log;
-
-	conn = S2C(session);
-	log = conn->log;
-
 	/*
 	 * !!! slot_release_lsn must be set outside this function because
 	 * this function may be called after a log file switch and the
@@ -73,10 +119,8 @@ __wt_log_slot_activate(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
 	 * are reset when the slot is freed.  See log_slot_free.
 	 */
 	slot->slot_unbuffered = 0;
-	slot->slot_start_lsn = slot->slot_end_lsn = log->alloc_lsn;
-	slot->slot_start_offset = log->alloc_lsn.l.offset;
-	slot->slot_last_offset = log->alloc_lsn.l.offset;
-	slot->slot_fh = log->log_fh;
+	__wt_log_slot_position(session, slot);
+	slot->slot_placed = true;
 	slot->slot_error = 0;
 	WT_DIAGNOSTIC_YIELD;
 	/*
@@ -87,6 +131,24 @@ __wt_log_slot_activate(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
 	WT_PUBLISH(slot->slot_state, 0);
 }
 
+/*
+ * __log_slot_stream_activate --
+ *	Initialize a log stream's slot to become active.  The slot is given
+ *	its position in the log when it's closed.
+ */
+static void
+__log_slot_stream_activate(
+    WT_SESSION_IMPL *session, WT_LOGSLOT *slot, uint32_t stream)
+{
+	WT_UNUSED(session);
+
+	slot->slot_unbuffered = 0;
+	slot->slot_stream = stream;
+	slot->slot_placed = false;
+	slot->slot_error = 0;
+	WT_PUBLISH(slot->slot_state, 0);
+}
+
 /*
  * __log_slot_close --
  *	Close out the slot the caller is using.  The slot may already be
@@ -189,8 +251,14 @@ retry:
 
 	end_offset =
 	    WT_LOG_SLOT_JOINED_BUFFERED(old_state) + slot->slot_unbuffered;
-	slot->slot_end_lsn.l.offset += (uint32_t)end_offset;
 	WT_STAT_CONN_INCRV(session, log_slot_consolidated, end_offset);
+	/*
+	 * A log stream's slot is placed in the log by the caller, now that
+	 * its size is known.
+	 */
+	if (!slot->slot_placed)
+		return (0);
+	slot->slot_end_lsn.l.offset += (uint32_t)end_offset;
 	/*
 	 * XXX Would like to change so one piece of code advances the LSN.
 	 */
@@ -200,12 +268,44 @@ retry:
 }
 
 /*
- * __log_slot_new --
- *	Find a free slot and switch it as the new active slot.
+ * __log_slot_place --
+ *	Give a closed log stream slot its position in the log: the streams
+ *	are merged into the log in the order their slots are closed.
  *	Must be called holding the slot lock.
  */
 static int
-__log_slot_new(WT_SESSION_IMPL *session)
+__log_slot_place(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
+{
+	WT_LOG *log;
+	int64_t size;
+
+	WT_ASSERT(session, F_ISSET(session, WT_SESSION_LOCKED_SLOT));
+	log = S2C(session)->log;
+
+	size = WT_LOG_SLOT_JOINED_BUFFERED(slot->slot_state) +
+	    slot->slot_unbuffered;
+	if (size == 0) {
+		slot->slot_release_lsn = log->alloc_lsn;
+		__wt_log_slot_position(session, slot);
+	} else {
+		WT_RET(__wt_log_acquire(session, (uint64_t)size, slot));
+		slot->slot_end_lsn.l.offset += (uint32_t)size;
+		log->alloc_lsn = slot->slot_end_lsn;
+	}
+	/*
+	 * Threads that finish copying their records into the slot wait for
+	 * its position before writing it out, set the flag last.
+	 */
+	WT_PUBLISH(slot->slot_placed, true);
+	return (0);
+}
+
+/*
+ * __log_slot_find --
+ *	Find a free slot in the pool.  Must be called holding the slot lock.
+ */
+static int
+__log_slot_find(WT_SESSION_IMPL *session, WT_LOGSLOT **slotp)
 {
 	WT_CONNECTION_IMPL *conn;
 	WT_LOG *log;
@@ -219,14 +319,7 @@ __log_slot_new(WT_SESSION_IMPL *session)
 	WT_ASSERT(session, F_ISSET(session, WT_SESSION_LOCKED_SLOT));
 	conn = S2C(session);
 	log = conn->log;
-	/*
-	 * Although this function is single threaded, multiple threads could
-	 * be trying to set a new active slot sequentially.  If we find an
-	 * active slot that is valid, return.
-	 */
-	if ((slot = log->active_slot) != NULL &&
-	    WT_LOG_SLOT_OPEN(slot->slot_state))
-		return (0);
+	*slotp = NULL;
 
 #ifdef	HAVE_DIAGNOSTIC
 	count = 0;
@@ -246,18 +339,8 @@ __log_slot_new(WT_SESSION_IMPL *session)
 				pool_i = 0;
 			slot = &log->slot_pool[pool_i];
 			if (slot->slot_state == WT_LOG_SLOT_FREE) {
-				/*
-				 * Acquire our starting position in the
-				 * log file.  Assume the full buffer size.
-				 */
-				WT_RET(__wt_log_acquire(session,
-				    log->slot_buf_size, slot));
-				/*
-				 * We have a new, initialized slot to use.
-				 * Set it as the active slot.
-				 */
-				log->active_slot = slot;
 				log->pool_index = pool_i;
+				*slotp = slot;
 				return (0);
 			}
 		}
@@ -284,6 +367,46 @@ __log_slot_new(WT_SESSION_IMPL *session)
 	/* NOTREACHED */
 }
 
+/*
+ * __log_slot_new --
+ *	Find a free slot and switch it as the new active slot of a log
+ *	stream.  Must be called holding the slot lock.
+ */
+static int
+__log_slot_new(WT_SESSION_IMPL *session, uint32_t stream)
+{
+	WT_LOG *log;
+	WT_LOGSLOT *slot;
+
+	WT_ASSERT(session, F_ISSET(session, WT_SESSION_LOCKED_SLOT));
+	log = S2C(session)->log;
+	/*
+	 * Although this function is single threaded, multiple threads could
+	 * be trying to set a new active slot sequentially.  If we find an
+	 * active slot that is valid, return.
+	 */
+	if ((slot = log->active_slot[stream]) != NULL &&
+	    WT_LOG_SLOT_OPEN(slot->slot_state))
+		return (0);
+
+	WT_RET(__log_slot_find(session, &slot));
+	if (log->streams == 1) {
+		/*
+		 * Acquire our starting position in the log file.  Assume the
+		 * full buffer size.
+		 */
+		WT_RET(__wt_log_acquire(session, log->slot_buf_size, slot));
+		slot->slot_stream = stream;
+		__wt_log_slot_activate(session, slot);
+	} else
+		__log_slot_stream_activate(session, slot, stream);
+	/*
+	 * We have a new, initialized slot to use.  Set it as the active slot.
+	 */
+	log->active_slot[stream] = slot;
+	return (0);
+}
+
 /*
  * __log_slot_switch_internal --
  *	Switch out the current slot and set up a new one.
@@ -307,9 +430,11 @@ __log_slot_switch_internal(
 
 	/*
 	 * If someone else raced us to closing this specific slot, we're
-	 * done here.
+	 * done here.  The slot may since have been reused to write a record
+	 * in order across the log streams.
 	 */
-	if (slot != log->active_slot)
+	if (slot->slot_stream == WT_LOG_STREAM_ORDERED ||
+	    slot != log->active_slot[slot->slot_stream])
 		return (0);
 	/*
 	 * If the current active slot is unused and this is a forced switch,
@@ -350,13 +475,19 @@ __log_slot_switch_internal(
 		if (release)
 			F_SET(myslot, WT_MYSLOT_NEEDS_RELEASE);
 	}
+	/*
+	 * A log stream's slot is placed in the log once it's closed, before
+	 * the stream's new slot can be joined.
+	 */
+	if (!slot->slot_placed)
+		WT_RET(__log_slot_place(session, slot));
 	/*
 	 * Now that the slot is closed, set up a new one so that joining
 	 * threads don't have to wait on writing the previous slot if we
 	 * release it.  Release after setting a new one.
 	 */
 
-	WT_RET(__log_slot_new(session));
+	WT_RET(__log_slot_new(session, slot->slot_stream));
 	F_CLR(myslot, WT_MYSLOT_CLOSE);
 	//־ǷҪд̣ͷųslot
 	if (F_ISSET(myslot, WT_MYSLOT_NEEDS_RELEASE)) {
@@ -426,6 +557,7 @@ __wt_log_slot_init(WT_SESSION_IMPL *session, bool alloc)
 	WT_LOG *log;
 	WT_LOGSLOT *slot;
 	int32_t i;
+	uint32_t stream;
 
 	conn = S2C(session);
 	log = conn->log;
@@ -451,20 +583,53 @@ __wt_log_slot_init(WT_SESSION_IMPL *session, bool alloc)
 		}
 		WT_STAT_CONN_SET(session,
 		    log_buffer_size, log->slot_buf_size * WT_SLOT_POOL);
+		if (conn->log_join_groups != 0) {
+			WT_ERR(__wt_calloc_def(session,
+			    conn->log_join_groups, &log->join_groups));
+			log->join_group_cnt = conn->log_join_groups;
+		}
+		if (conn->log_io_uring) {
+			/*
+			 * A slot has a write and a sync in flight at most.  If
+			 * there's no io_uring, log I/O is synchronous.
+			 */
+			if ((ret = __wt_uring_open(session,
+			    2 * WT_SLOT_POOL, &log->uring)) == ENOTSUP) {
+				__wt_verbose(session, WT_VERB_LOG, "%s",
+				    "io_uring not available, "
+				    "log I/O is synchronous");
+				ret = 0;
+			}
+			WT_ERR(ret);
+			if (log->uring != NULL) {
+				WT_ERR(__wt_calloc_def(
+				    session, WT_SLOT_POOL, &log->slot_io));
+				WT_STAT_CONN_SET(
+				    session, log_io_uring_enabled, 1);
+			}
+		}
 	}
 	/*
 	 * Set up the available slot from the pool the first time.
 	 */
-	slot = &log->slot_pool[0];
-	/*
-	 * We cannot initialize the release LSN in the activate function
-	 * because that function can be called after a log file switch.
-	 * The release LSN is usually the same as the slot_start_lsn except
-	 * around a log file switch.
-	 */
-	slot->slot_release_lsn = log->alloc_lsn;
-	__wt_log_slot_activate(session, slot);
-	log->active_slot = slot;
+	if (log->streams == 1) {
+		slot = &log->slot_pool[0];
+		/*
+		 * We cannot initialize the release LSN in the activate function
+		 * because that function can be called after a log file switch.
+		 * The release LSN is usually the same as the slot_start_lsn
+		 * except around a log file switch.
+		 */
+		slot->slot_release_lsn = log->alloc_lsn;
+		slot->slot_stream = 0;
+		__wt_log_slot_activate(session, slot);
+		log->active_slot[0] = slot;
+	} else
+		for (stream = 0; stream < log->streams; ++stream) {
+			slot = &log->slot_pool[stream];
+			__log_slot_stream_activate(session, slot, stream);
+			log->active_slot[stream] = slot;
+		}
 	log->pool_index = 0;
 
 	if (0) {
@@ -490,72 +655,128 @@ __wt_log_slot_destroy(WT_SESSION_IMPL *session)
 	conn = S2C(session);
 	log = conn->log;
 
+	__wt_free(session, log->join_groups);
+
+	/* Wait for writes in flight before writing out remaining buffers. */
+	WT_RET(__wt_uring_close(session, &log->uring));
+	__wt_free(session, log->slot_io);
+
 	/*
 	 * Write out any remaining buffers.  Free the buffer.
 	 */
 	for (i = 0; i < WT_SLOT_POOL; i++) {
 		slot = &log->slot_pool[i];
-		if (!FLD64_ISSET(
+		if (slot->slot_placed && !FLD64_ISSET(
 		    (uint64_t)slot->slot_state, WT_LOG_SLOT_RESERVED)) {
 			rel = WT_LOG_SLOT_RELEASED_BUFFERED(slot->slot_state);
-			if (rel != 0)
+			if (rel != 0) {
+				__wt_log_slot_salt(session, slot, rel);
 				WT_RET(__wt_write(session, slot->slot_fh,
 				    slot->slot_start_offset, (size_t)rel,
 				    slot->slot_buf.mem));
+			}
 		}
 		__wt_buf_free(session, &log->slot_pool[i].slot_buf);
+		__wt_buf_free(session, &log->slot_pool[i].slot_frame);
 	}
 	return (0);
 }
 
 /*
- * __wt_log_slot_join --
- *	Join a consolidated logging slot.
- WiredTigerLogjamƪԤдʽ־The Write-Ahead Log
- https://cloud.tencent.com/developer/article/1405902
- WiredTigerLogjamƪ޵ȴ
- */ 
-/*ѡȡһready slotlog writeлȷдslotԼдλ*/
-void
-__wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize,
-    uint32_t flags, WT_MYSLOT *myslot)
+ * __log_slot_join_flags --
+ *	Set the flags a joining write needs on its slot.
+ */
+static void
+__log_slot_join_flags(WT_LOGSLOT *slot, uint32_t flags)
+{
+	if (LF_ISSET(WT_LOG_DSYNC | WT_LOG_FSYNC))
+		F_SET(slot, WT_SLOT_SYNC_DIR);
+	if (LF_ISSET(WT_LOG_FLUSH))
+		F_SET(slot, WT_SLOT_FLUSH);
+	if (LF_ISSET(WT_LOG_FSYNC))
+		F_SET(slot, WT_SLOT_SYNC);
+}
+
+/*
+ * __log_slot_join_ordered --
+ *	Write a record in order across the log streams: close and place any
+ *	stream slots with joined records, then give the record a closed slot
+ *	of its own at the end of the log.  Must be called holding the slot
+ *	lock.
+ */
+static int
+__log_slot_join_ordered(WT_SESSION_IMPL *session,
+    uint64_t mysize, uint32_t flags, WT_MYSLOT *myslot)
+{
+	WT_LOG *log;
+	WT_LOGSLOT *slot;
+	WT_MYSLOT stream_slot;
+	uint32_t stream;
+	bool unbuffered;
+
+	WT_ASSERT(session, F_ISSET(session, WT_SESSION_LOCKED_SLOT));
+	log = S2C(session)->log;
+
+	for (stream = 0; stream < log->streams; ++stream) {
+		slot = log->active_slot[stream];
+		if (WT_LOG_SLOT_JOINED(slot->slot_state) == 0)
+			continue;
+		memset(&stream_slot, 0, sizeof(stream_slot));
+		stream_slot.slot = slot;
+		WT_RET(__log_slot_switch_internal(
+		    session, &stream_slot, false, NULL));
+	}
+
+	WT_RET(__log_slot_find(session, &slot));
+	WT_RET(__wt_log_acquire(session, mysize, slot));
+	unbuffered = mysize > WT_LOG_SLOT_BUF_MAX;
+	slot->slot_unbuffered = unbuffered ? (int64_t)mysize : 0;
+	slot->slot_stream = WT_LOG_STREAM_ORDERED;
+	slot->slot_placed = true;
+	slot->slot_error = 0;
+	slot->slot_end_lsn.l.offset += (uint32_t)mysize;
+	log->alloc_lsn = slot->slot_end_lsn;
+	__log_slot_join_flags(slot, flags);
+	if (unbuffered) {
+		WT_STAT_CONN_INCR(session, log_slot_unbuffered);
+		F_SET(myslot, WT_MYSLOT_UNBUFFERED);
+	}
+	slot->slot_state = (int64_t)WT_LOG_SLOT_JOIN_REL(unbuffered ?
+	    (int64_t)WT_LOG_SLOT_UNBUFFERED : (int64_t)mysize, 0, 0) |
+	    WT_LOG_SLOT_CLOSE;
+
+	myslot->slot = slot;
+	myslot->offset = 0;
+	myslot->end_offset = (wt_off_t)mysize;
+	return (0);
+}
+
+/*
+ * __log_slot_join_state --
+ *	Join a size into the active slot of a stream: return the slot and the
+ *	offset of the joined space in the slot's buffer.
+ */
+static void
+__log_slot_join_state(WT_SESSION_IMPL *session, uint64_t mysize,
+    uint32_t stream, bool unbuffered, bool diag_yield,
+    WT_LOGSLOT **slotp, int32_t *join_offsetp)
 {
 	struct timespec start, stop;
-	WT_CONNECTION_IMPL *conn;
 	WT_LOG *log;
-	WT_LOGSLOT *slot;  
+	WT_LOGSLOT *slot;
 	uint64_t usecs;
 	int64_t flag_state, new_state, old_state, released;
 	int32_t join_offset, new_join, wait_cnt;
-	bool closed, diag_yield, raced, slept, unbuffered, yielded;
-
-	conn = S2C(session);
-	log = conn->log;
-
-	WT_ASSERT(session, !F_ISSET(session, WT_SESSION_LOCKED_SLOT));
-	WT_ASSERT(session, mysize != 0);
+	bool closed, raced, slept, yielded;
 
-	/*
-	 * There should almost always be a slot open.
-	 */
-	unbuffered = yielded = false;
-	closed = raced = slept = false;
+	log = S2C(session)->log;
+	closed = raced = slept = yielded = false;
 	wait_cnt = 0;
-//#ifdef	HAVE_DIAGNOSTIC // YANG CHANGE
-//	diag_yield = (++log->write_calls % 7) == 0;
-//	if ((log->write_calls % WT_THOUSAND) == 0 ||
-//	    mysize > WT_LOG_SLOT_BUF_MAX) {
-//#else
-	diag_yield = false;
-	if (mysize > WT_LOG_SLOT_BUF_MAX) {
-//#endif
-		unbuffered = true;
-		F_SET(myslot, WT_MYSLOT_UNBUFFERED); 
-	}
+
 	for (;;) {
 		WT_BARRIER();
 		//ȷǰʹõslot
-		slot = log->active_slot;
+		slot = log->active_slot[stream];
 		//ϴKV״̬Ϣ
 		old_state = slot->slot_state;
 		if (WT_LOG_SLOT_OPEN(old_state)) { //
@@ -613,6 +834,7 @@ __wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize,
 			closed = true;
 			++wait_cnt;
 		}
+		WT_STAT_CONN_INCR(session, log_slot_join_retries);
 		if (!yielded)
 			__wt_epoch(session, &start);
 		yielded = true;
@@ -645,12 +867,214 @@ __wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize,
 		if (slept)
 			WT_STAT_CONN_INCR(session, log_slot_yield_sleep);
 	}
-	if (LF_ISSET(WT_LOG_DSYNC | WT_LOG_FSYNC))
-		F_SET(slot, WT_SLOT_SYNC_DIR);
-	if (LF_ISSET(WT_LOG_FLUSH))
-		F_SET(slot, WT_SLOT_FLUSH);
-	if (LF_ISSET(WT_LOG_FSYNC))
-		F_SET(slot, WT_SLOT_SYNC);
+	*slotp = slot;
+	*join_offsetp = join_offset;
+}
+
+/*
+ * __log_slot_combine --
+ *	Join the pending joins of a group into their slots.
+ */
+static void
+__log_slot_combine(WT_SESSION_IMPL *session, WT_LOG_JOIN_GROUP *group)
+{
+	WT_LOG *log;
+	WT_LOGSLOT *slot;
+	WT_LOG_JOIN_REQ *batch, *next, *pending, *req;
+	wt_off_t offset;
+	uint64_t total;
+	int32_t join_offset;
+	uint32_t stream;
+
+	log = S2C(session)->log;
+
+	/* Take all of the pending joins. */
+	do {
+		pending = group->pending;
+	} while (!__wt_atomic_cas_ptr(&group->pending, pending, NULL));
+	if (pending == NULL)
+		return;
+
+	WT_STAT_CONN_INCR(session, log_slot_combine);
+	while (pending != NULL) {
+		/*
+		 * Combine the joins for the first pending join's stream, up to
+		 * the most a single join can add to a slot.  The rest wait for
+		 * another pass.
+		 */
+		stream = pending->stream;
+		batch = NULL;
+		total = 0;
+		for (req = pending, pending = NULL; req != NULL; req = next) {
+			next = req->next;
+			if (req->stream == stream &&
+			    total + req->size <= WT_LOG_SLOT_BUF_MAX) {
+				total += req->size;
+				req->next = batch;
+				batch = req;
+			} else {
+				req->next = pending;
+				pending = req;
+			}
+		}
+
+		__log_slot_join_state(
+		    session, total, stream, false, false, &slot, &join_offset);
+
+		/*
+		 * Give each thread its piece of the joined space.  None of the
+		 * joining threads has returned, so any order is a valid order
+		 * for their records.  A request's memory belongs to its thread
+		 * again once it's marked done.
+		 */
+		offset = join_offset;
+		for (req = batch; req != NULL; req = next) {
+			next = req->next;
+			__log_slot_join_flags(slot, req->flags);
+			req->myslot->slot = slot;
+			req->myslot->offset = offset;
+			req->myslot->end_offset = offset + (wt_off_t)req->size;
+			offset = req->myslot->end_offset;
+			WT_STAT_CONN_INCR(session, log_slot_combined);
+			WT_PUBLISH(req->done, true);
+		}
+	}
+}
+
+/*
+ * __log_slot_join_combine --
+ *	Join a slot through the session's join group: queue the join, then
+ *	either combine the group's pending joins or wait for the thread that
+ *	is combining them.
+ */
+static void
+__log_slot_join_combine(WT_SESSION_IMPL *session,
+    uint64_t mysize, uint32_t flags, uint32_t stream, WT_MYSLOT *myslot)
+{
+	struct timespec start, stop;
+	WT_LOG *log;
+	WT_LOG_JOIN_GROUP *group;
+	WT_LOG_JOIN_REQ req;
+	uint64_t usecs;
+	u_int spins;
+	bool waited;
+
+	log = S2C(session)->log;
+	group = &log->join_groups[session->id % log->join_group_cnt];
+
+	req.myslot = myslot;
+	req.size = mysize;
+	req.flags = flags;
+	req.stream = stream;
+	req.done = false;
+	do {
+		req.next = group->pending;
+	} while (!__wt_atomic_cas_ptr(&group->pending, req.next, &req));
+
+	/*
+	 * If we get the group's combining flag, any earlier combining thread
+	 * has finished and our join is still pending: combining it and the
+	 * rest of the group's pending joins completes our join.
+	 */
+	waited = false;
+	for (spins = 0; !req.done; ++spins) {
+		if (group->combining == 0 &&
+		    __wt_atomic_casv32(&group->combining, 0, 1)) {
+			__log_slot_combine(session, group);
+			WT_PUBLISH(group->combining, 0);
+			continue;
+		}
+		if (!waited) {
+			__wt_epoch(session, &start);
+			waited = true;
+		}
+		if (spins < WT_THOUSAND)
+			WT_PAUSE();
+		else
+			__wt_yield();
+	}
+	WT_READ_BARRIER();
+
+	if (waited) {
+		__wt_epoch(session, &stop);
+		usecs = WT_TIMEDIFF_US(stop, start);
+		WT_STAT_CONN_INCR(session, log_slot_combine_wait);
+		WT_STAT_CONN_INCRV(
+		    session, log_slot_combine_wait_duration, usecs);
+	}
+}
+
+
+/*
+ * __wt_log_slot_join --
+ *	Join a consolidated logging slot.
+ WiredTigerLogjamƪԤдʽ־The Write-Ahead Log
+ https://cloud.tencent.com/developer/article/1405902
+ WiredTigerLogjamƪ޵ȴ
+ */ 
+/*ѡȡһready slotlog writeлȷдslotԼдλ*/
+int
+__wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize,
+    uint32_t flags, uint32_t stream, WT_MYSLOT *myslot)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_LOG *log;
+	WT_LOGSLOT *slot;
+	int32_t join_offset;
+	bool diag_yield, unbuffered;
+
+	conn = S2C(session);
+	log = conn->log;
+
+	WT_ASSERT(session, !F_ISSET(session, WT_SESSION_LOCKED_SLOT));
+	WT_ASSERT(session, mysize != 0);
+
+	/*
+	 * With log streams, records that must be ordered across the streams
+	 * and records too large to buffer are written in their own slot.
+	 */
+	if (log->streams == 1)
+		stream = 0;
+	else if (stream == WT_LOG_STREAM_ORDERED ||
+	    mysize > WT_LOG_SLOT_BUF_MAX) {
+		WT_WITH_SLOT_LOCK(session, log, ret =
+		    __log_slot_join_ordered(session, mysize, flags, myslot));
+		if (ret == 0)
+			WT_STAT_CONN_INCR(session, log_stream_ordered);
+		return (ret);
+	} else
+		WT_STAT_CONN_INCR(session, log_stream_writes);
+
+	/*
+	 * There should almost always be a slot open.
+	 */
+	unbuffered = false;
+//#ifdef	HAVE_DIAGNOSTIC // YANG CHANGE
+//	diag_yield = (++log->write_calls % 7) == 0;
+//	if ((log->write_calls % WT_THOUSAND) == 0 ||
+//	    mysize > WT_LOG_SLOT_BUF_MAX) {
+//#else
+	diag_yield = false;
+	if (mysize > WT_LOG_SLOT_BUF_MAX) {
+//#endif
+		unbuffered = true;
+		F_SET(myslot, WT_MYSLOT_UNBUFFERED); 
+	}
+
+	/*
+	 * With join groups, buffered joins are combined with the other joins
+	 * pending in the session's group.
+	 */
+	if (log->join_groups != NULL && !unbuffered) {
+		__log_slot_join_combine(session, mysize, flags, stream, myslot);
+		return (0);
+	}
+
+	__log_slot_join_state(session,
+	    mysize, stream, unbuffered, diag_yield, &slot, &join_offset);
+
+	__log_slot_join_flags(slot, flags);
 	if (F_ISSET(myslot, WT_MYSLOT_UNBUFFERED)) {
 		WT_ASSERT(session, slot->slot_unbuffered == 0);
 		WT_STAT_CONN_INCR(session, log_slot_unbuffered);
@@ -661,6 +1085,7 @@ __wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize,
 	myslot->slot = slot;
 	myslot->offset = join_offset;
 	myslot->end_offset = (wt_off_t)((uint64_t)join_offset + mysize);
+	return (0);
 }
 
 /*
@@ -677,12 +1102,18 @@ __wt_log_slot_release(WT_MYSLOT *myslot, int64_t size)
 	int64_t my_size, rel_size;
 
 	slot = myslot->slot;
-	my_start = slot->slot_start_offset + myslot->offset;
 	/*
 	 * We maintain the last starting offset within this slot.
 	 * This is used to know the offset of the last record that
 	 * was written rather than the beginning record of the slot.
+	 * A log stream's slot may not have its position yet, in which
+	 * case the last offset stays at the start of the slot.
 	 */
+	my_start = 0;
+	if (slot->slot_placed) {
+		WT_READ_BARRIER();
+		my_start = slot->slot_start_offset + myslot->offset;
+	}
 	while ((cur_offset = slot->slot_last_offset) < my_start) {
 		/*
 		 * Set our offset if we are larger.
@@ -721,5 +1152,6 @@ __wt_log_slot_free(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
 	WT_UNUSED(session);
 	slot->flags = WT_SLOT_INIT_FLAGS;
 	slot->slot_error = 0;
+	slot->slot_sync_commits = 0;
 	slot->slot_state = WT_LOG_SLOT_FREE;
 }
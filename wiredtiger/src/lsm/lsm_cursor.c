@@ -1751,10 +1751,13 @@ __wt_clsm_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_equals,			/* equals */
 	    __clsm_next,			/* next */
 	    __clsm_prev,			/* prev */
+	    __wt_cursor_next_batch_notsup,	/* next-batch */
 	    __clsm_reset,			/* reset */
 	    __clsm_search,			/* search */
 	    __clsm_search_near,			/* search-near */
+	    __wt_cursor_search_batch_notsup,	/* search-batch */
 	    __clsm_insert,			/* insert */  //__wt_clsm_open_bulkпܻ¸ֵ__clsm_insert_bulk
+	    __wt_cursor_insert_batch_notsup,	/* insert-batch */
 	    __wt_cursor_modify_notsup,		/* modify */
 	    __clsm_update,			/* update */
 	    __clsm_remove,			/* remove */
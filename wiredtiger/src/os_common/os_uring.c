@@ -0,0 +1,418 @@
+/*-
+ * Copyright (c) 2014-2017 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Asynchronous file writes and syncs through a Linux io_uring.  There's no
+ * dependency on liburing: the rings are set up and driven with the system
+ * calls directly.  Writes are supported from kernels with IORING_OP_WRITE
+ * (Linux 5.6); everywhere else, opening a ring returns ENOTSUP and callers
+ * fall back to the file handle's write and sync methods.
+ *
+ * Submitting and reaping are serialized separately, so threads can submit
+ * while a thread waits for completions.  Only the thread holding the reap
+ * lock waits in the kernel, and it consumes every completion available, so
+ * no thread waits for a completion another thread has already consumed.
+ */
+#if defined(HAVE_LINUX_IO_URING_H)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+#if defined(IORING_FEAT_RW_CUR_POS) && defined(__NR_io_uring_setup)
+#define	WT_HAVE_URING	1
+#endif
+#endif
+
+#ifdef WT_HAVE_URING
+/*
+ * Completion user data is the request's address, with the low bit set for
+ * the data sync of a write followed by a sync.
+ */
+#define	WT_URING_DATA_SYNC	0x01
+
+/*
+ * __uring_enter --
+ *	Submit entries and/or wait for completions.
+ */
+static int
+__uring_enter(WT_URING *ring, uint32_t to_submit, uint32_t min_complete)
+{
+	long n;
+
+	for (;;) {
+		n = syscall(__NR_io_uring_enter, ring->fd, to_submit,
+		    min_complete, min_complete == 0 ? 0 : IORING_ENTER_GETEVENTS,
+		    NULL, 0);
+		if (n >= 0)
+			break;
+		if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+			return (__wt_errno());
+		__wt_yield();
+	}
+
+	/*
+	 * Without SQPOLL the kernel consumes every entry it accepts during the
+	 * call: entries it didn't accept are submitted the next time around.
+	 */
+	if ((uint32_t)n < to_submit)
+		return (__uring_enter(ring, to_submit - (uint32_t)n, 0));
+	return (0);
+}
+
+/*
+ * __uring_complete --
+ *	Handle a completion.
+ */
+static void
+__uring_complete(
+    WT_SESSION_IMPL *session, WT_URING *ring, struct io_uring_cqe *cqe)
+{
+	WT_URING_REQ *req;
+	size_t done;
+
+	req = (WT_URING_REQ *)(uintptr_t)
+	    (cqe->user_data & ~(uint64_t)WT_URING_DATA_SYNC);
+
+	if (FLD_ISSET(cqe->user_data, WT_URING_DATA_SYNC) || req->len == 0) {
+		/*
+		 * A short write cancels the data sync linked to it: sync the
+		 * file here once the write is finished.
+		 */
+		if (cqe->res == -ECANCELED)
+			req->resync = true;
+		else if (cqe->res < 0 && req->error == 0)
+			req->error = -cqe->res;
+	} else if (cqe->res < 0)
+		req->error = -cqe->res;
+	else if ((done = (size_t)cqe->res) < req->len)
+		/* Finish a short write through the file handle. */
+		req->error = __wt_write(session, req->fh,
+		    req->offset + (wt_off_t)done, req->len - done,
+		    (const uint8_t *)req->buf + done);
+
+	/*
+	 * Only the thread holding the reap lock handles completions, so this
+	 * is the request's last completion if one is pending.
+	 */
+	if (req->pending == 1 && req->resync && req->error == 0)
+		req->error = __wt_fsync(session, req->fh, true);
+
+	(void)__wt_atomic_subv32(&req->pending, 1);
+	(void)__wt_atomic_subv32(&ring->inflight, 1);
+}
+
+/*
+ * __uring_reap --
+ *	Handle the available completions, waiting for at least one if there
+ *	are none and the request (if any) is still pending.  Must be called
+ *	holding the reap lock.
+ */
+static int
+__uring_reap(
+    WT_SESSION_IMPL *session, WT_URING *ring, WT_URING_REQ *req, bool wait)
+{
+	struct io_uring_cqe *cqes;
+	uint32_t head, mask, tail;
+
+	cqes = ring->cqes;
+	mask = *ring->cq_mask;
+	for (;;) {
+		head = *ring->cq_head;
+		WT_ORDERED_READ(tail, *ring->cq_tail);
+		if (head != tail) {
+			for (; head != tail; ++head)
+				__uring_complete(
+				    session, ring, &cqes[head & mask]);
+			WT_PUBLISH(*ring->cq_head, head);
+			if (req == NULL || req->pending == 0)
+				return (0);
+		}
+		if (!wait || ring->inflight == 0 ||
+		    (req != NULL && req->pending == 0))
+			return (0);
+		WT_RET(__uring_enter(ring, 0, 1));
+	}
+}
+
+/*
+ * __uring_push --
+ *	Fill in the next submission queue entry.  Must be called holding the
+ *	submit lock.
+ */
+static void
+__uring_push(WT_URING *ring, uint32_t *tailp,
+    uint8_t opcode, uint8_t flags, WT_URING_REQ *req, uint64_t user_data)
+{
+	struct io_uring_sqe *sqe;
+	uint32_t index;
+
+	index = *tailp & *ring->sq_mask;
+	sqe = &((struct io_uring_sqe *)ring->sqes)[index];
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->opcode = opcode;
+	sqe->flags = flags;
+	sqe->fd = req->fd;
+	if (opcode == IORING_OP_WRITE) {
+		sqe->addr = (uint64_t)(uintptr_t)req->buf;
+		sqe->len = (uint32_t)req->len;
+		sqe->off = (uint64_t)req->offset;
+	} else
+		sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+	sqe->user_data = user_data;
+	ring->sq_array[index] = index;
+	++*tailp;
+}
+#endif
+
+/*
+ * __wt_uring_open --
+ *	Set up an io_uring, returning ENOTSUP if it isn't available.
+ */
+int
+__wt_uring_open(WT_SESSION_IMPL *session, uint32_t entries, WT_URING **ringp)
+{
+#ifdef WT_HAVE_URING
+	struct io_uring_params p;
+	WT_DECL_RET;
+	WT_URING *ring;
+	uint8_t *sq, *cq;
+
+	*ringp = NULL;
+
+	WT_RET(__wt_calloc_one(session, &ring));
+	ring->fd = -1;
+	WT_ERR(__wt_spin_init(session, &ring->submit_lock, "io_uring submit"));
+	WT_ERR(__wt_spin_init(session, &ring->reap_lock, "io_uring reap"));
+
+	/*
+	 * Failing to set up the ring for any reason (an older kernel, a
+	 * seccomp policy disallowing io_uring, resource limits) means it's
+	 * not available.
+	 */
+	memset(&p, 0, sizeof(p));
+	if ((ring->fd = (int)syscall(
+	    __NR_io_uring_setup, entries, &p)) < 0 ||
+	    !FLD_ISSET(p.features, IORING_FEAT_RW_CUR_POS))
+		WT_ERR(ENOTSUP);
+
+	ring->sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(uint32_t);
+	ring->cq_ring_size =
+	    p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	if (FLD_ISSET(p.features, IORING_FEAT_SINGLE_MMAP))
+		ring->sq_ring_size = ring->cq_ring_size =
+		    WT_MAX(ring->sq_ring_size, ring->cq_ring_size);
+	if ((ring->sq_ring = mmap(NULL, ring->sq_ring_size,
+	    PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+	    ring->fd, IORING_OFF_SQ_RING)) == MAP_FAILED) {
+		ring->sq_ring = NULL;
+		WT_ERR(ENOTSUP);
+	}
+	if (FLD_ISSET(p.features, IORING_FEAT_SINGLE_MMAP))
+		ring->cq_ring = ring->sq_ring;
+	else if ((ring->cq_ring = mmap(NULL, ring->cq_ring_size,
+	    PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+	    ring->fd, IORING_OFF_CQ_RING)) == MAP_FAILED) {
+		ring->cq_ring = NULL;
+		WT_ERR(ENOTSUP);
+	}
+	ring->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+	if ((ring->sqes = mmap(NULL, ring->sqes_size,
+	    PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+	    ring->fd, IORING_OFF_SQES)) == MAP_FAILED) {
+		ring->sqes = NULL;
+		WT_ERR(ENOTSUP);
+	}
+
+	sq = ring->sq_ring;
+	ring->sq_head = (uint32_t *)(sq + p.sq_off.head);
+	ring->sq_tail = (uint32_t *)(sq + p.sq_off.tail);
+	ring->sq_mask = (uint32_t *)(sq + p.sq_off.ring_mask);
+	ring->sq_array = (uint32_t *)(sq + p.sq_off.array);
+	cq = ring->cq_ring;
+	ring->cq_head = (uint32_t *)(cq + p.cq_off.head);
+	ring->cq_tail = (uint32_t *)(cq + p.cq_off.tail);
+	ring->cq_mask = (uint32_t *)(cq + p.cq_off.ring_mask);
+	ring->cqes = cq + p.cq_off.cqes;
+
+	*ringp = ring;
+	return (0);
+
+err:	WT_TRET(__wt_uring_close(session, &ring));
+	return (ret);
+#else
+	WT_UNUSED(session);
+	WT_UNUSED(entries);
+	*ringp = NULL;
+	return (ENOTSUP);
+#endif
+}
+
+/*
+ * __wt_uring_close --
+ *	Wait for any requests in flight and discard an io_uring.
+ */
+int
+__wt_uring_close(WT_SESSION_IMPL *session, WT_URING **ringp)
+{
+#ifdef WT_HAVE_URING
+	WT_DECL_RET;
+	WT_URING *ring;
+
+	if ((ring = *ringp) == NULL)
+		return (0);
+	*ringp = NULL;
+
+	if (ring->cq_ring != NULL)
+		WT_TRET(__wt_uring_drain(session, ring));
+	if (ring->sqes != NULL)
+		(void)munmap(ring->sqes, ring->sqes_size);
+	if (ring->cq_ring != NULL && ring->cq_ring != ring->sq_ring)
+		(void)munmap(ring->cq_ring, ring->cq_ring_size);
+	if (ring->sq_ring != NULL)
+		(void)munmap(ring->sq_ring, ring->sq_ring_size);
+	if (ring->fd >= 0)
+		(void)close(ring->fd);
+	__wt_spin_destroy(session, &ring->submit_lock);
+	__wt_spin_destroy(session, &ring->reap_lock);
+	__wt_free(session, ring);
+	return (ret);
+#else
+	WT_UNUSED(session);
+	*ringp = NULL;
+	return (0);
+#endif
+}
+
+/*
+ * __wt_uring_submit --
+ *	Submit a write of a buffer to a file, a write followed by a data sync
+ *	of the file, or with a zero length, a data sync.  The sync is linked to
+ *	the write, the kernel starts it once the write completes.  Returns
+ *	ENOTSUP if the file handle can't be used with the ring.
+ */
+int
+__wt_uring_submit(WT_SESSION_IMPL *session, WT_URING *ring, WT_FH *fh,
+    wt_off_t offset, size_t len, const void *buf, bool sync,
+    WT_URING_REQ *req)
+{
+#ifdef WT_HAVE_URING
+	WT_DECL_RET;
+	uint32_t n, tail;
+
+	/* Writes are limited to what one entry can describe. */
+	if (len > UINT32_MAX)
+		return (ENOTSUP);
+	WT_RET(__wt_posix_file_fd(fh, &req->fd));
+	WT_ASSERT(session, len != 0 || sync);
+
+	req->fh = fh;
+	req->buf = buf;
+	req->len = len;
+	req->offset = offset;
+	req->sync = sync;
+	req->resync = false;
+	req->error = 0;
+	n = (len == 0 ? 0 : 1) + (sync ? 1 : 0);
+	req->pending = n;
+	(void)__wt_atomic_addv32(&ring->inflight, n);
+
+	__wt_spin_lock(session, &ring->submit_lock);
+	tail = *ring->sq_tail;
+	if (len != 0)
+		__uring_push(ring, &tail, IORING_OP_WRITE,
+		    sync ? IOSQE_IO_LINK : 0, req, (uint64_t)(uintptr_t)req);
+	if (sync)
+		__uring_push(ring, &tail, IORING_OP_FSYNC, 0, req,
+		    (uint64_t)(uintptr_t)req |
+		    (len == 0 ? 0 : WT_URING_DATA_SYNC));
+	WT_PUBLISH(*ring->sq_tail, tail);
+	ret = __uring_enter(ring, n, 0);
+	__wt_spin_unlock(session, &ring->submit_lock);
+
+	if (ret == 0 && len != 0)
+		WT_STAT_CONN_INCR(session, write_io);
+	return (ret);
+#else
+	WT_UNUSED(session);
+	WT_UNUSED(ring);
+	WT_UNUSED(fh);
+	WT_UNUSED(offset);
+	WT_UNUSED(len);
+	WT_UNUSED(buf);
+	WT_UNUSED(sync);
+	WT_UNUSED(req);
+	return (ENOTSUP);
+#endif
+}
+
+/*
+ * __wt_uring_reap --
+ *	Handle the completions available, optionally waiting for at least one
+ *	if requests are in flight.  Without waiting, return immediately if
+ *	another thread is handling completions.
+ */
+int
+__wt_uring_reap(WT_SESSION_IMPL *session, WT_URING *ring, bool wait)
+{
+#ifdef WT_HAVE_URING
+	WT_DECL_RET;
+
+	if (wait)
+		__wt_spin_lock(session, &ring->reap_lock);
+	else if (__wt_spin_trylock(session, &ring->reap_lock) != 0)
+		return (0);
+	ret = __uring_reap(session, ring, NULL, wait);
+	__wt_spin_unlock(session, &ring->reap_lock);
+	return (ret);
+#else
+	WT_UNUSED(session);
+	WT_UNUSED(ring);
+	WT_UNUSED(wait);
+	return (0);
+#endif
+}
+
+/*
+ * __wt_uring_wait --
+ *	Wait for a request to complete and return its error.
+ */
+int
+__wt_uring_wait(WT_SESSION_IMPL *session, WT_URING *ring, WT_URING_REQ *req)
+{
+#ifdef WT_HAVE_URING
+	WT_DECL_RET;
+
+	while (req->pending != 0) {
+		__wt_spin_lock(session, &ring->reap_lock);
+		ret = __uring_reap(session, ring, req, true);
+		__wt_spin_unlock(session, &ring->reap_lock);
+		WT_RET(ret);
+	}
+	WT_READ_BARRIER();
+	return (req->error);
+#else
+	WT_UNUSED(session);
+	WT_UNUSED(ring);
+	WT_UNUSED(req);
+	return (ENOTSUP);
+#endif
+}
+
+/*
+ * __wt_uring_drain --
+ *	Wait for all requests in flight to complete.
+ */
+int
+__wt_uring_drain(WT_SESSION_IMPL *session, WT_URING *ring)
+{
+	while (ring->inflight != 0)
+		WT_RET(__wt_uring_reap(session, ring, true));
+	return (0);
+}
@@ -537,6 +537,20 @@ __posix_file_write(WT_FILE_HANDLE *file_handle, WT_SESSION *wt_session,
 	return (0);
 }
 
+/*
+ * __wt_posix_file_fd --
+ *	Return the file descriptor of a file opened by the POSIX file system,
+ *	ENOTSUP for other file systems.
+ */
+int
+__wt_posix_file_fd(WT_FH *fh, int *fdp)
+{
+	if (fh->handle->fh_write != __posix_file_write)
+		return (ENOTSUP);
+	*fdp = ((WT_FILE_HANDLE_POSIX *)fh->handle)->fd;
+	return (0);
+}
+
 /*
  * __posix_open_file_cloexec --
  *	Prevent child access to file handles.
@@ -8,6 +8,10 @@
 
 #include "wt_internal.h"
 
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
 /*
  * __wt_thread_create --
  *	Create a new thread of control.
@@ -115,3 +119,59 @@ __wt_thread_str(char *buf, size_t buflen)
 	    //"%" PRIuMAX ":%d", (uintmax_t)getpid(), (int)self));
 #endif
 }
+
+/*
+ * __wt_numa_node_count --
+ *	Return the number of NUMA nodes in the system, 1 if it can't be
+ *	determined.
+ */
+u_int
+__wt_numa_node_count(void)
+{
+#if defined(__linux__)
+	ssize_t len;
+	u_long node;
+	int fd;
+	char buf[64], *p;
+
+	/*
+	 * The online node list is a comma-separated list of ranges, such as
+	 * "0-3" or "0,2-3"; the node count is one more than the highest node.
+	 */
+	if ((fd = open("/sys/devices/system/node/online", O_RDONLY)) == -1)
+		return (1);
+	len = read(fd, buf, sizeof(buf) - 1);
+	(void)close(fd);
+	if (len <= 0)
+		return (1);
+	buf[len] = '\0';
+
+	for (node = 0, p = buf; *p != '\0';) {
+		if (!__wt_isdigit((u_char)*p)) {
+			++p;
+			continue;
+		}
+		node = WT_MAX(node, strtoul(p, &p, 10));
+	}
+	return ((u_int)node + 1);
+#else
+	return (1);
+#endif
+}
+
+/*
+ * __wt_numa_node_current --
+ *	Return the NUMA node the calling thread is running on, 0 if it can't
+ *	be determined.
+ */
+u_int
+__wt_numa_node_current(void)
+{
+#if defined(__linux__) && defined(SYS_getcpu)
+	unsigned cpu, node;
+
+	if (syscall(SYS_getcpu, &cpu, &node, NULL) == 0)
+		return ((u_int)node);
+#endif
+	return (0);
+}
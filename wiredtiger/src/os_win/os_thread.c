@@ -96,3 +96,35 @@ __wt_thread_str(char *buf, size_t buflen)
 	    "%" PRIu64 ":%" PRIu64,
 	    (uint64_t)GetCurrentProcessId(), (uint64_t)GetCurrentThreadId));
 }
+
+/*
+ * __wt_numa_node_count --
+ *	Return the number of NUMA nodes in the system, 1 if it can't be
+ *	determined.
+ */
+u_int
+__wt_numa_node_count(void)
+{
+	ULONG node;
+
+	if (!GetNumaHighestNodeNumber(&node))
+		return (1);
+	return ((u_int)node + 1);
+}
+
+/*
+ * __wt_numa_node_current --
+ *	Return the NUMA node the calling thread is running on, 0 if it can't
+ *	be determined.
+ */
+u_int
+__wt_numa_node_current(void)
+{
+	PROCESSOR_NUMBER proc;
+	USHORT node;
+
+	GetCurrentProcessorNumberEx(&proc);
+	if (!GetNumaProcessorNodeEx(&proc, &node) || node == MAXUSHORT)
+		return (0);
+	return ((u_int)node);
+}
@@ -705,6 +705,7 @@ __rec_write_page_status(WT_SESSION_IMPL *session, WT_RECONCILE *r)
 	WT_BTREE *btree;
 	WT_PAGE *page;
 	WT_PAGE_MODIFY *mod;
+	uint64_t max_txn;
 
 	btree = S2BT(session);
 	page = r->page;
@@ -751,15 +752,30 @@ __rec_write_page_status(WT_SESSION_IMPL *session, WT_RECONCILE *r)
 		 * ID when doing a checkpoint. That's sufficient, we only care
 		 * about the maximum transaction ID of current updates in the
 		 * tree, and checkpoint visits every dirty page in the tree.
+		 *
+		 * Checkpoint worker threads reconcile a tree's leaf pages in
+		 * parallel: update the transaction ID atomically and the
+		 * timestamp under a lock so the larger value is never lost.
 		 */
 		if (!F_ISSET(r, WT_REC_EVICT)) {
-			if (WT_TXNID_LT(btree->rec_max_txn, r->max_txn))
-				btree->rec_max_txn = r->max_txn;
+			for (;;) {
+				WT_ORDERED_READ(max_txn, btree->rec_max_txn);
+				if (!WT_TXNID_LT(max_txn, r->max_txn) ||
+				    __wt_atomic_cas64(
+				    &btree->rec_max_txn, max_txn, r->max_txn))
+					break;
+			}
 #ifdef HAVE_TIMESTAMPS
 			if (__wt_timestamp_cmp(
-			    &btree->rec_max_timestamp, &r->max_timestamp) < 0)
-				__wt_timestamp_set(&btree->rec_max_timestamp,
-				    &r->max_timestamp);
+			    &btree->rec_max_timestamp, &r->max_timestamp) < 0) {
+				__wt_spin_lock(session, &btree->rec_max_lock);
+				if (__wt_timestamp_cmp(&btree->rec_max_timestamp,
+				    &r->max_timestamp) < 0)
+					__wt_timestamp_set(
+					    &btree->rec_max_timestamp,
+					    &r->max_timestamp);
+				__wt_spin_unlock(session, &btree->rec_max_lock);
+			}
 #endif
 		}
 
@@ -19,6 +19,8 @@ static const char * const __stats_dsrc_desc[] = {
 	"LSM: sleep for LSM merge throttle",
 	"LSM: total size of bloom filters",
 	"block-manager: allocations requiring file extension",
+	"block-manager: avail extent list bases written",
+	"block-manager: avail extent lists written as changes",
 	"block-manager: blocks allocated",
 	"block-manager: blocks freed",
 	"block-manager: checkpoint size",
@@ -49,6 +51,10 @@ static const char * const __stats_dsrc_desc[] = {
 	"cache: bytes currently in the cache",
 	"cache: bytes read into cache",
 	"cache: bytes written from cache",
+	"cache: change buffer bytes",
+	"cache: change buffer pages merged",
+	"cache: change buffer writes buffered for pages not in the cache",
+	"cache: change buffer writes not buffered because the buffer is full",
 	"cache: checkpoint blocked page eviction",
 	"cache: data source pages selected for eviction unable to be evicted",
 	"cache: eviction walk passes of a file",
@@ -116,15 +122,21 @@ static const char * const __stats_dsrc_desc[] = {
 	"cursor: cursor-remove key bytes removed",
 	"cursor: cursor-update value bytes updated",
 	"cursor: insert calls",
+	"cursor: insert-batch calls",
 	"cursor: modify calls",
 	"cursor: next calls",
+	"cursor: next-batch calls",
 	"cursor: prev calls",
 	"cursor: remove calls",
 	"cursor: reserve calls",
 	"cursor: reset calls",
 	"cursor: restarted searches",
 	"cursor: search calls",
+	"cursor: search leaf page hash index hits",
+	"cursor: search leaf page hash index misses",
+	"cursor: search leaf page hash indexes built",
 	"cursor: search near calls",
+	"cursor: search-batch calls",
 	"cursor: truncate calls",
 	"cursor: update calls",
 	"reconciliation: dictionary matches",
@@ -200,6 +212,8 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
 	stats->lsm_merge_throttle = 0;
 	stats->bloom_size = 0;
 	stats->block_extension = 0;
+	stats->block_avail_base = 0;
+	stats->block_avail_delta = 0;
 	stats->block_alloc = 0;
 	stats->block_free = 0;
 	stats->block_checkpoint_size = 0;
@@ -230,6 +244,10 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
 		/* not clearing cache_bytes_inuse */
 	stats->cache_bytes_read = 0;
 	stats->cache_bytes_write = 0;
+		/* not clearing cache_change_buffer_bytes */
+	stats->cache_change_buffer_merge = 0;
+	stats->cache_change_buffer_write = 0;
+	stats->cache_change_buffer_skip_full = 0;
 	stats->cache_eviction_checkpoint = 0;
 	stats->cache_eviction_fail = 0;
 	stats->cache_eviction_walk_passes = 0;
@@ -297,15 +315,21 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
 	stats->cursor_remove_bytes = 0;
 	stats->cursor_update_bytes = 0;
 	stats->cursor_insert = 0;
+	stats->cursor_insert_batch = 0;
 	stats->cursor_modify = 0;
 	stats->cursor_next = 0;
+	stats->cursor_next_batch = 0;
 	stats->cursor_prev = 0;
 	stats->cursor_remove = 0;
 	stats->cursor_reserve = 0;
 	stats->cursor_reset = 0;
 	stats->cursor_restart = 0;
 	stats->cursor_search = 0;
+	stats->cursor_search_hash_hit = 0;
+	stats->cursor_search_hash_miss = 0;
+	stats->cursor_search_hash_build = 0;
 	stats->cursor_search_near = 0;
+	stats->cursor_search_batch = 0;
 	stats->cursor_truncate = 0;
 	stats->cursor_update = 0;
 	stats->rec_dictionary = 0;
@@ -354,6 +378,8 @@ __wt_stat_dsrc_aggregate_single(
 	to->lsm_merge_throttle += from->lsm_merge_throttle;
 	to->bloom_size += from->bloom_size;
 	to->block_extension += from->block_extension;
+	to->block_avail_base += from->block_avail_base;
+	to->block_avail_delta += from->block_avail_delta;
 	to->block_alloc += from->block_alloc;
 	to->block_free += from->block_free;
 	to->block_checkpoint_size += from->block_checkpoint_size;
@@ -395,6 +421,11 @@ __wt_stat_dsrc_aggregate_single(
 	to->cache_bytes_inuse += from->cache_bytes_inuse;
 	to->cache_bytes_read += from->cache_bytes_read;
 	to->cache_bytes_write += from->cache_bytes_write;
+	to->cache_change_buffer_bytes += from->cache_change_buffer_bytes;
+	to->cache_change_buffer_merge += from->cache_change_buffer_merge;
+	to->cache_change_buffer_write += from->cache_change_buffer_write;
+	to->cache_change_buffer_skip_full +=
+	    from->cache_change_buffer_skip_full;
 	to->cache_eviction_checkpoint += from->cache_eviction_checkpoint;
 	to->cache_eviction_fail += from->cache_eviction_fail;
 	to->cache_eviction_walk_passes += from->cache_eviction_walk_passes;
@@ -478,15 +509,21 @@ __wt_stat_dsrc_aggregate_single(
 	to->cursor_remove_bytes += from->cursor_remove_bytes;
 	to->cursor_update_bytes += from->cursor_update_bytes;
 	to->cursor_insert += from->cursor_insert;
+	to->cursor_insert_batch += from->cursor_insert_batch;
 	to->cursor_modify += from->cursor_modify;
 	to->cursor_next += from->cursor_next;
+	to->cursor_next_batch += from->cursor_next_batch;
 	to->cursor_prev += from->cursor_prev;
 	to->cursor_remove += from->cursor_remove;
 	to->cursor_reserve += from->cursor_reserve;
 	to->cursor_reset += from->cursor_reset;
 	to->cursor_restart += from->cursor_restart;
 	to->cursor_search += from->cursor_search;
+	to->cursor_search_hash_hit += from->cursor_search_hash_hit;
+	to->cursor_search_hash_miss += from->cursor_search_hash_miss;
+	to->cursor_search_hash_build += from->cursor_search_hash_build;
 	to->cursor_search_near += from->cursor_search_near;
+	to->cursor_search_batch += from->cursor_search_batch;
 	to->cursor_truncate += from->cursor_truncate;
 	to->cursor_update += from->cursor_update;
 	to->rec_dictionary += from->rec_dictionary;
@@ -531,6 +568,8 @@ __wt_stat_dsrc_aggregate(
 	to->lsm_merge_throttle += WT_STAT_READ(from, lsm_merge_throttle);
 	to->bloom_size += WT_STAT_READ(from, bloom_size);
 	to->block_extension += WT_STAT_READ(from, block_extension);
+	to->block_avail_base += WT_STAT_READ(from, block_avail_base);
+	to->block_avail_delta += WT_STAT_READ(from, block_avail_delta);
 	to->block_alloc += WT_STAT_READ(from, block_alloc);
 	to->block_free += WT_STAT_READ(from, block_free);
 	to->block_checkpoint_size +=
@@ -581,6 +620,14 @@ __wt_stat_dsrc_aggregate(
 	to->cache_bytes_inuse += WT_STAT_READ(from, cache_bytes_inuse);
 	to->cache_bytes_read += WT_STAT_READ(from, cache_bytes_read);
 	to->cache_bytes_write += WT_STAT_READ(from, cache_bytes_write);
+	to->cache_change_buffer_bytes +=
+	    WT_STAT_READ(from, cache_change_buffer_bytes);
+	to->cache_change_buffer_merge +=
+	    WT_STAT_READ(from, cache_change_buffer_merge);
+	to->cache_change_buffer_write +=
+	    WT_STAT_READ(from, cache_change_buffer_write);
+	to->cache_change_buffer_skip_full +=
+	    WT_STAT_READ(from, cache_change_buffer_skip_full);
 	to->cache_eviction_checkpoint +=
 	    WT_STAT_READ(from, cache_eviction_checkpoint);
 	to->cache_eviction_fail += WT_STAT_READ(from, cache_eviction_fail);
@@ -691,15 +738,24 @@ __wt_stat_dsrc_aggregate(
 	to->cursor_remove_bytes += WT_STAT_READ(from, cursor_remove_bytes);
 	to->cursor_update_bytes += WT_STAT_READ(from, cursor_update_bytes);
 	to->cursor_insert += WT_STAT_READ(from, cursor_insert);
+	to->cursor_insert_batch += WT_STAT_READ(from, cursor_insert_batch);
 	to->cursor_modify += WT_STAT_READ(from, cursor_modify);
 	to->cursor_next += WT_STAT_READ(from, cursor_next);
+	to->cursor_next_batch += WT_STAT_READ(from, cursor_next_batch);
 	to->cursor_prev += WT_STAT_READ(from, cursor_prev);
 	to->cursor_remove += WT_STAT_READ(from, cursor_remove);
 	to->cursor_reserve += WT_STAT_READ(from, cursor_reserve);
 	to->cursor_reset += WT_STAT_READ(from, cursor_reset);
 	to->cursor_restart += WT_STAT_READ(from, cursor_restart);
 	to->cursor_search += WT_STAT_READ(from, cursor_search);
+	to->cursor_search_hash_hit +=
+	    WT_STAT_READ(from, cursor_search_hash_hit);
+	to->cursor_search_hash_miss +=
+	    WT_STAT_READ(from, cursor_search_hash_miss);
+	to->cursor_search_hash_build +=
+	    WT_STAT_READ(from, cursor_search_hash_build);
 	to->cursor_search_near += WT_STAT_READ(from, cursor_search_near);
+	to->cursor_search_batch += WT_STAT_READ(from, cursor_search_batch);
 	to->cursor_truncate += WT_STAT_READ(from, cursor_truncate);
 	to->cursor_update += WT_STAT_READ(from, cursor_update);
 	to->rec_dictionary += WT_STAT_READ(from, rec_dictionary);
@@ -755,6 +811,19 @@ static const char * const __stats_connection_desc[] = {
 	"async: total remove calls",
 	"async: total search calls",
 	"async: total update calls",
+	"block-manager: I/O scheduler application read time (usecs)",
+	"block-manager: I/O scheduler application reads",
+	"block-manager: I/O scheduler application reads in progress",
+	"block-manager: I/O scheduler checkpoint write rate limit time (usecs)",
+	"block-manager: I/O scheduler checkpoint write time (usecs)",
+	"block-manager: I/O scheduler checkpoint writes",
+	"block-manager: I/O scheduler checkpoint writes in progress",
+	"block-manager: I/O scheduler checkpoint writes rate limited",
+	"block-manager: I/O scheduler eviction write time (usecs)",
+	"block-manager: I/O scheduler eviction writes",
+	"block-manager: I/O scheduler eviction writes in progress",
+	"block-manager: I/O scheduler write delay time for application reads (usecs)",
+	"block-manager: I/O scheduler writes delayed for application reads",
 	"block-manager: blocks pre-loaded",
 	"block-manager: blocks read",
 	"block-manager: blocks written",
@@ -773,18 +842,29 @@ static const char * const __stats_connection_desc[] = {
 	"cache: bytes not belonging to page images in the cache",
 	"cache: bytes read into cache",
 	"cache: bytes written from cache",
+	"cache: change buffer pages merged",
+	"cache: change buffer writes buffered for pages not in the cache",
+	"cache: change buffer writes not buffered because the buffer is full",
 	"cache: checkpoint blocked page eviction",
 	"cache: eviction calls to get a page",
 	"cache: eviction calls to get a page found queue empty",
 	"cache: eviction calls to get a page found queue empty after locking",
+	"cache: eviction calls to get a page took it from another shard",
 	"cache: eviction currently operating in aggressive mode",
 	"cache: eviction empty score",
 	"cache: eviction passes of a file",
+	"cache: eviction policy evicted pages remembered",
+	"cache: eviction policy hot pages currently in cache",
+	"cache: eviction policy hot pages demoted after not being referenced",
+	"cache: eviction policy pages promoted to hot after being referenced again",
+	"cache: eviction policy remembered pages read again",
 	"cache: eviction server candidate queue empty when topping up",
 	"cache: eviction server candidate queue not empty when topping up",
 	"cache: eviction server evicting pages",
 	"cache: eviction server slept, because we did not make progress with eviction",
 	"cache: eviction server unable to reach eviction goal",
+	"cache: eviction shard maximum queued candidates",
+	"cache: eviction shard minimum queued candidates",
 	"cache: eviction state",
 	"cache: eviction walk target pages histogram - 0-9",
 	"cache: eviction walk target pages histogram - 10-31",
@@ -846,6 +926,10 @@ static const char * const __stats_connection_desc[] = {
 	"cache: pages written from cache",
 	"cache: pages written requiring in-memory restoration",
 	"cache: percentage overhead",
+	"cache: read-ahead pages queued",
+	"cache: read-ahead pages searched by read-ahead threads",
+	"cache: read-ahead pages skipped because the cache is full",
+	"cache: read-ahead pages skipped because the queue is full",
 	"cache: tracked bytes belonging to internal pages in the cache",
 	"cache: tracked bytes belonging to leaf pages in the cache",
 	"cache: tracked dirty bytes in the cache",
@@ -866,15 +950,22 @@ static const char * const __stats_connection_desc[] = {
 	"connection: total write I/Os",
 	"cursor: cursor create calls",
 	"cursor: cursor insert calls",
+	"cursor: cursor insert-batch calls",
+	"cursor: cursor insert-batch keys inserted without searching from the root",
 	"cursor: cursor modify calls",
 	"cursor: cursor next calls",
+	"cursor: cursor next-batch calls",
 	"cursor: cursor prev calls",
 	"cursor: cursor remove calls",
 	"cursor: cursor reserve calls",
 	"cursor: cursor reset calls",
 	"cursor: cursor restarted searches",
 	"cursor: cursor search calls",
+	"cursor: cursor search leaf page hash index hits",
+	"cursor: cursor search leaf page hash index misses",
+	"cursor: cursor search leaf page hash indexes built",
 	"cursor: cursor search near calls",
+	"cursor: cursor search-batch calls",
 	"cursor: cursor update calls",
 	"cursor: truncate calls",
 	"data-handle: connection data handles currently active",
@@ -892,6 +983,12 @@ static const char * const __stats_connection_desc[] = {
 	"lock: dhandle lock internal thread time waiting for the dhandle lock (usecs)",
 	"lock: dhandle read lock acquisitions",
 	"lock: dhandle write lock acquisitions",
+	"lock: eviction candidate queue lock acquisitions",
+	"lock: eviction candidate queue lock application thread wait time (usecs)",
+	"lock: eviction candidate queue lock internal thread wait time (usecs)",
+	"lock: eviction shard lock acquisitions",
+	"lock: eviction shard lock application thread wait time (usecs)",
+	"lock: eviction shard lock internal thread wait time (usecs)",
 	"lock: metadata lock acquisitions",
 	"lock: metadata lock application thread wait time (usecs)",
 	"lock: metadata lock internal thread wait time (usecs)",
@@ -904,6 +1001,9 @@ static const char * const __stats_connection_desc[] = {
 	"lock: table write lock acquisitions",
 	"log: busy returns attempting to switch slots",
 	"log: force checkpoint calls slept",
+	"log: group commit delay time (usecs)",
+	"log: group commit delays",
+	"log: log I/O through io_uring",
 	"log: log bytes of payload data",
 	"log: log bytes written",
 	"log: log files manually zero-filled",
@@ -913,21 +1013,28 @@ static const char * const __stats_connection_desc[] = {
 	"log: log records compressed",
 	"log: log records not compressed",
 	"log: log records too small to compress",
+	"log: log records written in order across log streams",
+	"log: log records written to a log stream",
 	"log: log release advances write LSN",
 	"log: log scan operations",
 	"log: log scan records requiring two reads",
 	"log: log server thread advances write LSN",
 	"log: log server thread write LSN walk skipped",
+	"log: log slot buffers compressed",
+	"log: log slot buffers not compressed",
 	"log: log sync operations",
 	"log: log sync time duration (usecs)",
 	"log: log sync_dir operations",
 	"log: log sync_dir time duration (usecs)",
+	"log: log syncs linked to log writes",
 	"log: log write operations",
+	"log: log writes submitted asynchronously",
 	"log: logging bytes consolidated",
 	"log: maximum log file size",
 	"log: number of pre-allocated log files to create",
 	"log: pre-allocated log files not ready and missed",
 	"log: pre-allocated log files prepared",
+	"log: pre-allocated log files recycled",
 	"log: pre-allocated log files used",
 	"log: records processed by log scan",
 	"log: slot close lost race",
@@ -938,11 +1045,26 @@ static const char * const __stats_connection_desc[] = {
 	"log: slot join calls did not yield",
 	"log: slot join calls found active slot closed",
 	"log: slot join calls slept",
+	"log: slot join calls waited for combining",
 	"log: slot join calls yielded",
+	"log: slot join combining passes",
+	"log: slot join combining wait time (usecs)",
 	"log: slot join found active slot closed",
+	"log: slot join retries",
+	"log: slot joins combined",
 	"log: slot joins yield time (usecs)",
 	"log: slot transitions unable to find free slot",
 	"log: slot unbuffered writes",
+	"log: synchronous commit latency histogram - 0-99us",
+	"log: synchronous commit latency histogram - 100-249us",
+	"log: synchronous commit latency histogram - 1000-9999us",
+	"log: synchronous commit latency histogram - 10000us and higher",
+	"log: synchronous commit latency histogram - 250-999us",
+	"log: synchronous commits per log sync histogram - 0-1",
+	"log: synchronous commits per log sync histogram - 16 and higher",
+	"log: synchronous commits per log sync histogram - 2-3",
+	"log: synchronous commits per log sync histogram - 4-7",
+	"log: synchronous commits per log sync histogram - 8-15",
 	"log: total in-memory size of compressed records",
 	"log: total log buffer size",
 	"log: total size of compressed records",
@@ -995,15 +1117,29 @@ static const char * const __stats_connection_desc[] = {
 	"thread-yield: tree descend one level yielded for split page index update",
 	"transaction: number of named snapshots created",
 	"transaction: number of named snapshots dropped",
+	"transaction: recovery operations applied in parallel",
 	"transaction: transaction begins",
 	"transaction: transaction checkpoint currently running",
+	"transaction: transaction checkpoint dirty bytes remaining after pacing",
 	"transaction: transaction checkpoint generation",
+	"transaction: transaction checkpoint leaf pages written in parallel",
 	"transaction: transaction checkpoint max time (msecs)",
 	"transaction: transaction checkpoint min time (msecs)",
 	"transaction: transaction checkpoint most recent time (msecs)",
+	"transaction: transaction checkpoint objects flushed in parallel",
+	"transaction: transaction checkpoint objects written in parallel",
+	"transaction: transaction checkpoint paced bytes written",
+	"transaction: transaction checkpoint paced pages written",
+	"transaction: transaction checkpoint paced write rate (bytes per second)",
 	"transaction: transaction checkpoint scrub dirty target",
 	"transaction: transaction checkpoint scrub time (msecs)",
+	"transaction: transaction checkpoint thread max bytes written",
+	"transaction: transaction checkpoint thread max time (msecs)",
+	"transaction: transaction checkpoint thread min bytes written",
+	"transaction: transaction checkpoint thread min time (msecs)",
 	"transaction: transaction checkpoint total time (msecs)",
+	"transaction: transaction checkpoint tree walk clean subtrees skipped",
+	"transaction: transaction checkpoint tree walk pages visited",
 	"transaction: transaction checkpoints",
 	"transaction: transaction checkpoints skipped because database was clean",
 	"transaction: transaction failures due to cache overflow",
@@ -1090,6 +1226,19 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 	stats->async_op_remove = 0;
 	stats->async_op_search = 0;
 	stats->async_op_update = 0;
+	stats->block_sched_read_time = 0;
+	stats->block_sched_read = 0;
+		/* not clearing block_sched_read_active */
+	stats->block_sched_checkpoint_throttle_time = 0;
+	stats->block_sched_checkpoint_time = 0;
+	stats->block_sched_checkpoint = 0;
+		/* not clearing block_sched_checkpoint_active */
+	stats->block_sched_checkpoint_throttle = 0;
+	stats->block_sched_evict_time = 0;
+	stats->block_sched_evict = 0;
+		/* not clearing block_sched_evict_active */
+	stats->block_sched_write_yield_time = 0;
+	stats->block_sched_write_yield = 0;
 	stats->block_preload = 0;
 	stats->block_read = 0;
 	stats->block_write = 0;
@@ -1108,18 +1257,29 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 		/* not clearing cache_bytes_other */
 	stats->cache_bytes_read = 0;
 	stats->cache_bytes_write = 0;
+	stats->cache_change_buffer_merge = 0;
+	stats->cache_change_buffer_write = 0;
+	stats->cache_change_buffer_skip_full = 0;
 	stats->cache_eviction_checkpoint = 0;
 	stats->cache_eviction_get_ref = 0;
 	stats->cache_eviction_get_ref_empty = 0;
 	stats->cache_eviction_get_ref_empty2 = 0;
+	stats->cache_eviction_shard_steal = 0;
 		/* not clearing cache_eviction_aggressive_set */
 		/* not clearing cache_eviction_empty_score */
 	stats->cache_eviction_walk_passes = 0;
+	stats->cache_eviction_policy_ghost_add = 0;
+		/* not clearing cache_eviction_policy_hot_pages */
+	stats->cache_eviction_policy_demote = 0;
+	stats->cache_eviction_policy_promote = 0;
+	stats->cache_eviction_policy_ghost_hit = 0;
 	stats->cache_eviction_queue_empty = 0;
 	stats->cache_eviction_queue_not_empty = 0;
 	stats->cache_eviction_server_evicting = 0;
 	stats->cache_eviction_server_slept = 0;
 	stats->cache_eviction_slow = 0;
+		/* not clearing cache_eviction_shard_depth_max */
+		/* not clearing cache_eviction_shard_depth_min */
 		/* not clearing cache_eviction_state */
 	stats->cache_eviction_target_page_lt10 = 0;
 	stats->cache_eviction_target_page_lt32 = 0;
@@ -1181,6 +1341,10 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 	stats->cache_write = 0;
 	stats->cache_write_restore = 0;
 		/* not clearing cache_overhead */
+	stats->cache_read_ahead_queued = 0;
+	stats->cache_read_ahead_run = 0;
+	stats->cache_read_ahead_skip_cache = 0;
+	stats->cache_read_ahead_skip_queue = 0;
 		/* not clearing cache_bytes_internal */
 		/* not clearing cache_bytes_leaf */
 		/* not clearing cache_bytes_dirty */
@@ -1201,15 +1365,22 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 	stats->write_io = 0;
 	stats->cursor_create = 0;
 	stats->cursor_insert = 0;
+	stats->cursor_insert_batch = 0;
+	stats->cursor_insert_batch_pinned = 0;
 	stats->cursor_modify = 0;
 	stats->cursor_next = 0;
+	stats->cursor_next_batch = 0;
 	stats->cursor_prev = 0;
 	stats->cursor_remove = 0;
 	stats->cursor_reserve = 0;
 	stats->cursor_reset = 0;
 	stats->cursor_restart = 0;
 	stats->cursor_search = 0;
+	stats->cursor_search_hash_hit = 0;
+	stats->cursor_search_hash_miss = 0;
+	stats->cursor_search_hash_build = 0;
 	stats->cursor_search_near = 0;
+	stats->cursor_search_batch = 0;
 	stats->cursor_update = 0;
 	stats->cursor_truncate = 0;
 		/* not clearing dh_conn_handle_count */
@@ -1227,6 +1398,12 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 	stats->lock_dhandle_wait_internal = 0;
 	stats->lock_dhandle_read_count = 0;
 	stats->lock_dhandle_write_count = 0;
+	stats->lock_evict_queue_count = 0;
+	stats->lock_evict_queue_wait_application = 0;
+	stats->lock_evict_queue_wait_internal = 0;
+	stats->lock_evict_shard_count = 0;
+	stats->lock_evict_shard_wait_application = 0;
+	stats->lock_evict_shard_wait_internal = 0;
 	stats->lock_metadata_count = 0;
 	stats->lock_metadata_wait_application = 0;
 	stats->lock_metadata_wait_internal = 0;
@@ -1239,6 +1416,9 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 	stats->lock_table_write_count = 0;
 	stats->log_slot_switch_busy = 0;
 	stats->log_force_ckpt_sleep = 0;
+		/* not clearing log_group_commit_delay_time */
+	stats->log_group_commit_delay = 0;
+		/* not clearing log_io_uring_enabled */
 	stats->log_bytes_payload = 0;
 	stats->log_bytes_written = 0;
 	stats->log_zero_fills = 0;
@@ -1248,21 +1428,28 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 	stats->log_compress_writes = 0;
 	stats->log_compress_write_fails = 0;
 	stats->log_compress_small = 0;
+	stats->log_stream_ordered = 0;
+	stats->log_stream_writes = 0;
 	stats->log_release_write_lsn = 0;
 	stats->log_scans = 0;
 	stats->log_scan_rereads = 0;
 	stats->log_write_lsn = 0;
 	stats->log_write_lsn_skip = 0;
+	stats->log_compress_slots = 0;
+	stats->log_compress_slot_fails = 0;
 	stats->log_sync = 0;
 		/* not clearing log_sync_duration */
 	stats->log_sync_dir = 0;
 		/* not clearing log_sync_dir_duration */
+	stats->log_io_uring_sync = 0;
 	stats->log_writes = 0;
+	stats->log_io_uring_write = 0;
 	stats->log_slot_consolidated = 0;
 		/* not clearing log_max_filesize */
 		/* not clearing log_prealloc_max */
 	stats->log_prealloc_missed = 0;
 	stats->log_prealloc_files = 0;
+	stats->log_prealloc_recycled = 0;
 	stats->log_prealloc_used = 0;
 	stats->log_scan_records = 0;
 	stats->log_slot_close_race = 0;
@@ -1273,11 +1460,26 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 	stats->log_slot_immediate = 0;
 	stats->log_slot_yield_close = 0;
 	stats->log_slot_yield_sleep = 0;
+	stats->log_slot_combine_wait = 0;
 	stats->log_slot_yield = 0;
+	stats->log_slot_combine = 0;
+		/* not clearing log_slot_combine_wait_duration */
 	stats->log_slot_active_closed = 0;
+	stats->log_slot_join_retries = 0;
+	stats->log_slot_combined = 0;
 		/* not clearing log_slot_yield_duration */
 	stats->log_slot_no_free_slots = 0;
 	stats->log_slot_unbuffered = 0;
+	stats->log_commit_latency_lt100 = 0;
+	stats->log_commit_latency_lt250 = 0;
+	stats->log_commit_latency_lt10000 = 0;
+	stats->log_commit_latency_ge10000 = 0;
+	stats->log_commit_latency_lt1000 = 0;
+	stats->log_sync_commits_lt2 = 0;
+	stats->log_sync_commits_ge16 = 0;
+	stats->log_sync_commits_lt4 = 0;
+	stats->log_sync_commits_lt8 = 0;
+	stats->log_sync_commits_lt16 = 0;
 	stats->log_compress_mem = 0;
 		/* not clearing log_buffer_size */
 	stats->log_compress_len = 0;
@@ -1330,15 +1532,29 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 	stats->tree_descend_blocked = 0;
 	stats->txn_snapshots_created = 0;
 	stats->txn_snapshots_dropped = 0;
+	stats->txn_recover_parallel_ops = 0;
 	stats->txn_begin = 0;
 		/* not clearing txn_checkpoint_running */
+		/* not clearing txn_checkpoint_pace_remaining */
 		/* not clearing txn_checkpoint_generation */
+	stats->txn_checkpoint_leaf_parallel = 0;
 		/* not clearing txn_checkpoint_time_max */
 		/* not clearing txn_checkpoint_time_min */
 		/* not clearing txn_checkpoint_time_recent */
+	stats->txn_checkpoint_fsync_parallel = 0;
+	stats->txn_checkpoint_thread_trees = 0;
+	stats->txn_checkpoint_pace_bytes = 0;
+	stats->txn_checkpoint_pace_pages = 0;
+		/* not clearing txn_checkpoint_pace_rate */
 		/* not clearing txn_checkpoint_scrub_target */
 		/* not clearing txn_checkpoint_scrub_time */
+		/* not clearing txn_checkpoint_thread_bytes_max */
+		/* not clearing txn_checkpoint_thread_time_max */
+		/* not clearing txn_checkpoint_thread_bytes_min */
+		/* not clearing txn_checkpoint_thread_time_min */
 		/* not clearing txn_checkpoint_time_total */
+	stats->txn_checkpoint_walk_skipped = 0;
+	stats->txn_checkpoint_walk_pages = 0;
 	stats->txn_checkpoint = 0;
 	stats->txn_checkpoint_skipped = 0;
 	stats->txn_fail_cache = 0;
@@ -1404,6 +1620,30 @@ __wt_stat_connection_aggregate(
 	to->async_op_remove += WT_STAT_READ(from, async_op_remove);
 	to->async_op_search += WT_STAT_READ(from, async_op_search);
 	to->async_op_update += WT_STAT_READ(from, async_op_update);
+	to->block_sched_read_time +=
+	    WT_STAT_READ(from, block_sched_read_time);
+	to->block_sched_read += WT_STAT_READ(from, block_sched_read);
+	to->block_sched_read_active +=
+	    WT_STAT_READ(from, block_sched_read_active);
+	to->block_sched_checkpoint_throttle_time +=
+	    WT_STAT_READ(from, block_sched_checkpoint_throttle_time);
+	to->block_sched_checkpoint_time +=
+	    WT_STAT_READ(from, block_sched_checkpoint_time);
+	to->block_sched_checkpoint +=
+	    WT_STAT_READ(from, block_sched_checkpoint);
+	to->block_sched_checkpoint_active +=
+	    WT_STAT_READ(from, block_sched_checkpoint_active);
+	to->block_sched_checkpoint_throttle +=
+	    WT_STAT_READ(from, block_sched_checkpoint_throttle);
+	to->block_sched_evict_time +=
+	    WT_STAT_READ(from, block_sched_evict_time);
+	to->block_sched_evict += WT_STAT_READ(from, block_sched_evict);
+	to->block_sched_evict_active +=
+	    WT_STAT_READ(from, block_sched_evict_active);
+	to->block_sched_write_yield_time +=
+	    WT_STAT_READ(from, block_sched_write_yield_time);
+	to->block_sched_write_yield +=
+	    WT_STAT_READ(from, block_sched_write_yield);
 	to->block_preload += WT_STAT_READ(from, block_preload);
 	to->block_read += WT_STAT_READ(from, block_read);
 	to->block_write += WT_STAT_READ(from, block_write);
@@ -1425,6 +1665,12 @@ __wt_stat_connection_aggregate(
 	to->cache_bytes_other += WT_STAT_READ(from, cache_bytes_other);
 	to->cache_bytes_read += WT_STAT_READ(from, cache_bytes_read);
 	to->cache_bytes_write += WT_STAT_READ(from, cache_bytes_write);
+	to->cache_change_buffer_merge +=
+	    WT_STAT_READ(from, cache_change_buffer_merge);
+	to->cache_change_buffer_write +=
+	    WT_STAT_READ(from, cache_change_buffer_write);
+	to->cache_change_buffer_skip_full +=
+	    WT_STAT_READ(from, cache_change_buffer_skip_full);
 	to->cache_eviction_checkpoint +=
 	    WT_STAT_READ(from, cache_eviction_checkpoint);
 	to->cache_eviction_get_ref +=
@@ -1433,12 +1679,24 @@ __wt_stat_connection_aggregate(
 	    WT_STAT_READ(from, cache_eviction_get_ref_empty);
 	to->cache_eviction_get_ref_empty2 +=
 	    WT_STAT_READ(from, cache_eviction_get_ref_empty2);
+	to->cache_eviction_shard_steal +=
+	    WT_STAT_READ(from, cache_eviction_shard_steal);
 	to->cache_eviction_aggressive_set +=
 	    WT_STAT_READ(from, cache_eviction_aggressive_set);
 	to->cache_eviction_empty_score +=
 	    WT_STAT_READ(from, cache_eviction_empty_score);
 	to->cache_eviction_walk_passes +=
 	    WT_STAT_READ(from, cache_eviction_walk_passes);
+	to->cache_eviction_policy_ghost_add +=
+	    WT_STAT_READ(from, cache_eviction_policy_ghost_add);
+	to->cache_eviction_policy_hot_pages +=
+	    WT_STAT_READ(from, cache_eviction_policy_hot_pages);
+	to->cache_eviction_policy_demote +=
+	    WT_STAT_READ(from, cache_eviction_policy_demote);
+	to->cache_eviction_policy_promote +=
+	    WT_STAT_READ(from, cache_eviction_policy_promote);
+	to->cache_eviction_policy_ghost_hit +=
+	    WT_STAT_READ(from, cache_eviction_policy_ghost_hit);
 	to->cache_eviction_queue_empty +=
 	    WT_STAT_READ(from, cache_eviction_queue_empty);
 	to->cache_eviction_queue_not_empty +=
@@ -1448,6 +1706,10 @@ __wt_stat_connection_aggregate(
 	to->cache_eviction_server_slept +=
 	    WT_STAT_READ(from, cache_eviction_server_slept);
 	to->cache_eviction_slow += WT_STAT_READ(from, cache_eviction_slow);
+	to->cache_eviction_shard_depth_max +=
+	    WT_STAT_READ(from, cache_eviction_shard_depth_max);
+	to->cache_eviction_shard_depth_min +=
+	    WT_STAT_READ(from, cache_eviction_shard_depth_min);
 	to->cache_eviction_state += WT_STAT_READ(from, cache_eviction_state);
 	to->cache_eviction_target_page_lt10 +=
 	    WT_STAT_READ(from, cache_eviction_target_page_lt10);
@@ -1553,6 +1815,13 @@ __wt_stat_connection_aggregate(
 	to->cache_write += WT_STAT_READ(from, cache_write);
 	to->cache_write_restore += WT_STAT_READ(from, cache_write_restore);
 	to->cache_overhead += WT_STAT_READ(from, cache_overhead);
+	to->cache_read_ahead_queued +=
+	    WT_STAT_READ(from, cache_read_ahead_queued);
+	to->cache_read_ahead_run += WT_STAT_READ(from, cache_read_ahead_run);
+	to->cache_read_ahead_skip_cache +=
+	    WT_STAT_READ(from, cache_read_ahead_skip_cache);
+	to->cache_read_ahead_skip_queue +=
+	    WT_STAT_READ(from, cache_read_ahead_skip_queue);
 	to->cache_bytes_internal += WT_STAT_READ(from, cache_bytes_internal);
 	to->cache_bytes_leaf += WT_STAT_READ(from, cache_bytes_leaf);
 	to->cache_bytes_dirty += WT_STAT_READ(from, cache_bytes_dirty);
@@ -1573,15 +1842,26 @@ __wt_stat_connection_aggregate(
 	to->write_io += WT_STAT_READ(from, write_io);
 	to->cursor_create += WT_STAT_READ(from, cursor_create);
 	to->cursor_insert += WT_STAT_READ(from, cursor_insert);
+	to->cursor_insert_batch += WT_STAT_READ(from, cursor_insert_batch);
+	to->cursor_insert_batch_pinned +=
+	    WT_STAT_READ(from, cursor_insert_batch_pinned);
 	to->cursor_modify += WT_STAT_READ(from, cursor_modify);
 	to->cursor_next += WT_STAT_READ(from, cursor_next);
+	to->cursor_next_batch += WT_STAT_READ(from, cursor_next_batch);
 	to->cursor_prev += WT_STAT_READ(from, cursor_prev);
 	to->cursor_remove += WT_STAT_READ(from, cursor_remove);
 	to->cursor_reserve += WT_STAT_READ(from, cursor_reserve);
 	to->cursor_reset += WT_STAT_READ(from, cursor_reset);
 	to->cursor_restart += WT_STAT_READ(from, cursor_restart);
 	to->cursor_search += WT_STAT_READ(from, cursor_search);
+	to->cursor_search_hash_hit +=
+	    WT_STAT_READ(from, cursor_search_hash_hit);
+	to->cursor_search_hash_miss +=
+	    WT_STAT_READ(from, cursor_search_hash_miss);
+	to->cursor_search_hash_build +=
+	    WT_STAT_READ(from, cursor_search_hash_build);
 	to->cursor_search_near += WT_STAT_READ(from, cursor_search_near);
+	to->cursor_search_batch += WT_STAT_READ(from, cursor_search_batch);
 	to->cursor_update += WT_STAT_READ(from, cursor_update);
 	to->cursor_truncate += WT_STAT_READ(from, cursor_truncate);
 	to->dh_conn_handle_count += WT_STAT_READ(from, dh_conn_handle_count);
@@ -1606,6 +1886,18 @@ __wt_stat_connection_aggregate(
 	    WT_STAT_READ(from, lock_dhandle_read_count);
 	to->lock_dhandle_write_count +=
 	    WT_STAT_READ(from, lock_dhandle_write_count);
+	to->lock_evict_queue_count +=
+	    WT_STAT_READ(from, lock_evict_queue_count);
+	to->lock_evict_queue_wait_application +=
+	    WT_STAT_READ(from, lock_evict_queue_wait_application);
+	to->lock_evict_queue_wait_internal +=
+	    WT_STAT_READ(from, lock_evict_queue_wait_internal);
+	to->lock_evict_shard_count +=
+	    WT_STAT_READ(from, lock_evict_shard_count);
+	to->lock_evict_shard_wait_application +=
+	    WT_STAT_READ(from, lock_evict_shard_wait_application);
+	to->lock_evict_shard_wait_internal +=
+	    WT_STAT_READ(from, lock_evict_shard_wait_internal);
 	to->lock_metadata_count += WT_STAT_READ(from, lock_metadata_count);
 	to->lock_metadata_wait_application +=
 	    WT_STAT_READ(from, lock_metadata_wait_application);
@@ -1627,6 +1919,11 @@ __wt_stat_connection_aggregate(
 	    WT_STAT_READ(from, lock_table_write_count);
 	to->log_slot_switch_busy += WT_STAT_READ(from, log_slot_switch_busy);
 	to->log_force_ckpt_sleep += WT_STAT_READ(from, log_force_ckpt_sleep);
+	to->log_group_commit_delay_time +=
+	    WT_STAT_READ(from, log_group_commit_delay_time);
+	to->log_group_commit_delay +=
+	    WT_STAT_READ(from, log_group_commit_delay);
+	to->log_io_uring_enabled += WT_STAT_READ(from, log_io_uring_enabled);
 	to->log_bytes_payload += WT_STAT_READ(from, log_bytes_payload);
 	to->log_bytes_written += WT_STAT_READ(from, log_bytes_written);
 	to->log_zero_fills += WT_STAT_READ(from, log_zero_fills);
@@ -1637,24 +1934,33 @@ __wt_stat_connection_aggregate(
 	to->log_compress_write_fails +=
 	    WT_STAT_READ(from, log_compress_write_fails);
 	to->log_compress_small += WT_STAT_READ(from, log_compress_small);
+	to->log_stream_ordered += WT_STAT_READ(from, log_stream_ordered);
+	to->log_stream_writes += WT_STAT_READ(from, log_stream_writes);
 	to->log_release_write_lsn +=
 	    WT_STAT_READ(from, log_release_write_lsn);
 	to->log_scans += WT_STAT_READ(from, log_scans);
 	to->log_scan_rereads += WT_STAT_READ(from, log_scan_rereads);
 	to->log_write_lsn += WT_STAT_READ(from, log_write_lsn);
 	to->log_write_lsn_skip += WT_STAT_READ(from, log_write_lsn_skip);
+	to->log_compress_slots += WT_STAT_READ(from, log_compress_slots);
+	to->log_compress_slot_fails +=
+	    WT_STAT_READ(from, log_compress_slot_fails);
 	to->log_sync += WT_STAT_READ(from, log_sync);
 	to->log_sync_duration += WT_STAT_READ(from, log_sync_duration);
 	to->log_sync_dir += WT_STAT_READ(from, log_sync_dir);
 	to->log_sync_dir_duration +=
 	    WT_STAT_READ(from, log_sync_dir_duration);
+	to->log_io_uring_sync += WT_STAT_READ(from, log_io_uring_sync);
 	to->log_writes += WT_STAT_READ(from, log_writes);
+	to->log_io_uring_write += WT_STAT_READ(from, log_io_uring_write);
 	to->log_slot_consolidated +=
 	    WT_STAT_READ(from, log_slot_consolidated);
 	to->log_max_filesize += WT_STAT_READ(from, log_max_filesize);
 	to->log_prealloc_max += WT_STAT_READ(from, log_prealloc_max);
 	to->log_prealloc_missed += WT_STAT_READ(from, log_prealloc_missed);
 	to->log_prealloc_files += WT_STAT_READ(from, log_prealloc_files);
+	to->log_prealloc_recycled +=
+	    WT_STAT_READ(from, log_prealloc_recycled);
 	to->log_prealloc_used += WT_STAT_READ(from, log_prealloc_used);
 	to->log_scan_records += WT_STAT_READ(from, log_scan_records);
 	to->log_slot_close_race += WT_STAT_READ(from, log_slot_close_race);
@@ -1665,14 +1971,39 @@ __wt_stat_connection_aggregate(
 	to->log_slot_immediate += WT_STAT_READ(from, log_slot_immediate);
 	to->log_slot_yield_close += WT_STAT_READ(from, log_slot_yield_close);
 	to->log_slot_yield_sleep += WT_STAT_READ(from, log_slot_yield_sleep);
+	to->log_slot_combine_wait +=
+	    WT_STAT_READ(from, log_slot_combine_wait);
 	to->log_slot_yield += WT_STAT_READ(from, log_slot_yield);
+	to->log_slot_combine += WT_STAT_READ(from, log_slot_combine);
+	to->log_slot_combine_wait_duration +=
+	    WT_STAT_READ(from, log_slot_combine_wait_duration);
 	to->log_slot_active_closed +=
 	    WT_STAT_READ(from, log_slot_active_closed);
+	to->log_slot_join_retries +=
+	    WT_STAT_READ(from, log_slot_join_retries);
+	to->log_slot_combined += WT_STAT_READ(from, log_slot_combined);
 	to->log_slot_yield_duration +=
 	    WT_STAT_READ(from, log_slot_yield_duration);
 	to->log_slot_no_free_slots +=
 	    WT_STAT_READ(from, log_slot_no_free_slots);
 	to->log_slot_unbuffered += WT_STAT_READ(from, log_slot_unbuffered);
+	to->log_commit_latency_lt100 +=
+	    WT_STAT_READ(from, log_commit_latency_lt100);
+	to->log_commit_latency_lt250 +=
+	    WT_STAT_READ(from, log_commit_latency_lt250);
+	to->log_commit_latency_lt10000 +=
+	    WT_STAT_READ(from, log_commit_latency_lt10000);
+	to->log_commit_latency_ge10000 +=
+	    WT_STAT_READ(from, log_commit_latency_ge10000);
+	to->log_commit_latency_lt1000 +=
+	    WT_STAT_READ(from, log_commit_latency_lt1000);
+	to->log_sync_commits_lt2 += WT_STAT_READ(from, log_sync_commits_lt2);
+	to->log_sync_commits_ge16 +=
+	    WT_STAT_READ(from, log_sync_commits_ge16);
+	to->log_sync_commits_lt4 += WT_STAT_READ(from, log_sync_commits_lt4);
+	to->log_sync_commits_lt8 += WT_STAT_READ(from, log_sync_commits_lt8);
+	to->log_sync_commits_lt16 +=
+	    WT_STAT_READ(from, log_sync_commits_lt16);
 	to->log_compress_mem += WT_STAT_READ(from, log_compress_mem);
 	to->log_buffer_size += WT_STAT_READ(from, log_buffer_size);
 	to->log_compress_len += WT_STAT_READ(from, log_compress_len);
@@ -1756,23 +2087,51 @@ __wt_stat_connection_aggregate(
 	    WT_STAT_READ(from, txn_snapshots_created);
 	to->txn_snapshots_dropped +=
 	    WT_STAT_READ(from, txn_snapshots_dropped);
+	to->txn_recover_parallel_ops +=
+	    WT_STAT_READ(from, txn_recover_parallel_ops);
 	to->txn_begin += WT_STAT_READ(from, txn_begin);
 	to->txn_checkpoint_running +=
 	    WT_STAT_READ(from, txn_checkpoint_running);
+	to->txn_checkpoint_pace_remaining +=
+	    WT_STAT_READ(from, txn_checkpoint_pace_remaining);
 	to->txn_checkpoint_generation +=
 	    WT_STAT_READ(from, txn_checkpoint_generation);
+	to->txn_checkpoint_leaf_parallel +=
+	    WT_STAT_READ(from, txn_checkpoint_leaf_parallel);
 	to->txn_checkpoint_time_max +=
 	    WT_STAT_READ(from, txn_checkpoint_time_max);
 	to->txn_checkpoint_time_min +=
 	    WT_STAT_READ(from, txn_checkpoint_time_min);
 	to->txn_checkpoint_time_recent +=
 	    WT_STAT_READ(from, txn_checkpoint_time_recent);
+	to->txn_checkpoint_fsync_parallel +=
+	    WT_STAT_READ(from, txn_checkpoint_fsync_parallel);
+	to->txn_checkpoint_thread_trees +=
+	    WT_STAT_READ(from, txn_checkpoint_thread_trees);
+	to->txn_checkpoint_pace_bytes +=
+	    WT_STAT_READ(from, txn_checkpoint_pace_bytes);
+	to->txn_checkpoint_pace_pages +=
+	    WT_STAT_READ(from, txn_checkpoint_pace_pages);
+	to->txn_checkpoint_pace_rate +=
+	    WT_STAT_READ(from, txn_checkpoint_pace_rate);
 	to->txn_checkpoint_scrub_target +=
 	    WT_STAT_READ(from, txn_checkpoint_scrub_target);
 	to->txn_checkpoint_scrub_time +=
 	    WT_STAT_READ(from, txn_checkpoint_scrub_time);
+	to->txn_checkpoint_thread_bytes_max +=
+	    WT_STAT_READ(from, txn_checkpoint_thread_bytes_max);
+	to->txn_checkpoint_thread_time_max +=
+	    WT_STAT_READ(from, txn_checkpoint_thread_time_max);
+	to->txn_checkpoint_thread_bytes_min +=
+	    WT_STAT_READ(from, txn_checkpoint_thread_bytes_min);
+	to->txn_checkpoint_thread_time_min +=
+	    WT_STAT_READ(from, txn_checkpoint_thread_time_min);
 	to->txn_checkpoint_time_total +=
 	    WT_STAT_READ(from, txn_checkpoint_time_total);
+	to->txn_checkpoint_walk_skipped +=
+	    WT_STAT_READ(from, txn_checkpoint_walk_skipped);
+	to->txn_checkpoint_walk_pages +=
+	    WT_STAT_READ(from, txn_checkpoint_walk_pages);
 	to->txn_checkpoint += WT_STAT_READ(from, txn_checkpoint);
 	to->txn_checkpoint_skipped +=
 	    WT_STAT_READ(from, txn_checkpoint_skipped);
@@ -106,6 +106,8 @@ __wt_txn_release_snapshot(WT_SESSION_IMPL *session)
 
     //֤ڴϵͳsnapshotʱ״̬ύ״̬
 	txn_state->metadata_pinned = txn_state->pinned_id = WT_TXN_NONE; //ǰɹ󣬻ָsession״̬Ϣʼ״̬
+	__wt_txn_state_track(
+	    session, S2C(session)->txn_global.states_pinned, false);
 	F_CLR(txn, WT_TXN_HAS_SNAPSHOT);
 }
 
@@ -133,6 +135,9 @@ __wt_txn_get_snapshot(WT_SESSION_IMPL *session)
 	/* We're going to scan the table: wait for the lock. */
 	__wt_readlock(session, &txn_global->rwlock);
 
+	/* Flag we're about to publish IDs before publishing them. */
+	__wt_txn_state_track(session, txn_global->states_pinned, true);
+
 	current_id = pinned_id = txn_global->current;
 	prev_oldest_id = txn_global->oldest_id;
 
@@ -159,7 +164,9 @@ __wt_txn_get_snapshot(WT_SESSION_IMPL *session)
     //transaction_idWT_TNX_NONEΪִ޸Ĳ
 	/* Walk the array of concurrent transactions. */
 	WT_ORDERED_READ(session_cnt, conn->session_cnt);
-	for (i = 0, s = txn_global->states; i < session_cnt; i++, s++) {
+	for (i = 0;
+	    (s = __wt_txn_state_next(session, session_cnt, false, &i)) != NULL;
+	    ++i) {
 		/*
 		 * Build our snapshot of any concurrent transaction IDs.
 		 *
@@ -222,7 +229,9 @@ __txn_oldest_scan(WT_SESSION_IMPL *session,
 
 	/* Walk the array of concurrent transactions. */
 	WT_ORDERED_READ(session_cnt, conn->session_cnt);
-	for (i = 0, s = txn_global->states; i < session_cnt; i++, s++) {
+	for (i = 0;
+	    (s = __wt_txn_state_next(session, session_cnt, true, &i)) != NULL;
+	    ++i) {
 
 		/* Update the last running transaction ID. */
 		//ҲǻȡsessionӦУڵprev_oldest_idСcurrentid
@@ -587,6 +596,7 @@ __wt_txn_release(WT_SESSION_IMPL *session)
 		WT_ASSERT(session, txn_state->id != WT_TXN_NONE &&
 		    txn->id != WT_TXN_NONE);
 		WT_PUBLISH(txn_state->id, WT_TXN_NONE);
+		__wt_txn_state_track(session, txn_global->states_id, false);
 
 		txn->id = WT_TXN_NONE;
 	}
@@ -1071,10 +1081,10 @@ __wt_txn_global_init(WT_SESSION_IMPL *session, const char *cfg[])
 {
 	WT_CONNECTION_IMPL *conn;
 	WT_TXN_GLOBAL *txn_global;
+	WT_CONFIG_ITEM cval;
 	WT_TXN_STATE *s;
 	u_int i;
 
-	WT_UNUSED(cfg);
 	conn = S2C(session);
 
 	txn_global = &conn->txn_global;
@@ -1102,6 +1112,23 @@ __wt_txn_global_init(WT_SESSION_IMPL *session, const char *cfg[])
 	for (i = 0, s = txn_global->states; i < conn->session_size; i++, s++)
 		s->id = s->metadata_pinned = s->pinned_id = WT_TXN_NONE;
 
+	/*
+	 * Optionally track which sessions have published IDs, so scans of the
+	 * table only visit sessions that are running transactions.
+	 */
+	WT_RET(__wt_config_gets(
+	    session, cfg, "transaction_snapshot.method", &cval));
+	if (WT_STRING_MATCH("active", cval.str, cval.len)) {
+		txn_global->states_words = (conn->session_size + 63) / 64;
+		WT_RET(__wt_calloc_def(session, txn_global->states_words *
+		    (WT_CACHE_LINE_ALIGNMENT / sizeof(uint64_t)),
+		    &txn_global->states_id));
+		WT_RET(__wt_calloc_def(session, txn_global->states_words *
+		    (WT_CACHE_LINE_ALIGNMENT / sizeof(uint64_t)),
+		    &txn_global->states_pinned));
+		txn_global->states_track = true;
+	}
+
 	return (0);
 }
 
@@ -1128,6 +1155,8 @@ __wt_txn_global_destroy(WT_SESSION_IMPL *session)
 	__wt_rwlock_destroy(session, &txn_global->nsnap_rwlock);
 	__wt_rwlock_destroy(session, &txn_global->visibility_rwlock);
 	__wt_free(session, txn_global->states);
+	__wt_free(session, txn_global->states_id);
+	__wt_free(session, txn_global->states_pinned);
 }
 
 /*
@@ -13,6 +13,8 @@ static int __checkpoint_lock_dirty_tree(
     WT_SESSION_IMPL *, bool, bool, bool, const char *[]);
 static int __checkpoint_mark_skip(WT_SESSION_IMPL *, WT_CKPT *, bool);
 static int __checkpoint_presync(WT_SESSION_IMPL *, const char *[]);
+static int __checkpoint_apply_sync(WT_SESSION_IMPL *, const char *[]);
+static int __checkpoint_apply_trees(WT_SESSION_IMPL *, const char *[]);
 static int __checkpoint_tree_helper(WT_SESSION_IMPL *, const char *[]);
 
 /*
@@ -711,6 +713,8 @@ __checkpoint_prepare(WT_SESSION_IMPL *session, const char *cfg[])
 	 */ //txn_global->checkpoint_statecheckpointӦsessionͬһidΪ˱ظsessionӦtxn_stateֵΪWT_TXN_NONE
 	txn_state->id = txn_state->pinned_id =
 	    txn_state->metadata_pinned = WT_TXN_NONE;
+	__wt_txn_state_track(session, txn_global->states_id, false);
+	__wt_txn_state_track(session, txn_global->states_pinned, false);
 
 #ifdef HAVE_TIMESTAMPS
 	/*
@@ -882,7 +886,7 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 	__checkpoint_timing_stress(session);
 
 	//btree pageд̣
-	WT_ERR(__checkpoint_apply(session, cfg, __checkpoint_tree_helper)); //滹ִ__wt_checkpoint
+	WT_ERR(__checkpoint_apply_trees(session, cfg)); //滹ִ__wt_checkpoint
 
 	/*
 	 * Clear the dhandle so the visibility check doesn't get confused about
@@ -906,7 +910,7 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 	 */
 	//syncˢ̣֤ϵͳcache
 	__wt_epoch(session, &fsync_start);
-	WT_ERR(__checkpoint_apply(session, cfg, __wt_checkpoint_sync));
+	WT_ERR(__checkpoint_apply_sync(session, cfg));
 	__wt_epoch(session, &fsync_stop);
 	fsync_duration_usecs = WT_TIMEDIFF_US(fsync_stop, fsync_start);
 	WT_STAT_CONN_INCR(session, txn_checkpoint_fsync_post);
@@ -1497,31 +1501,21 @@ __checkpoint_mark_skip(
 }
 
 /*
- * __checkpoint_tree --
- *	Checkpoint a single tree.
+ * __checkpoint_tree_start --
+ *	Start a single tree's checkpoint.
  *	Assumes all necessary locks have been acquired by the caller.
- */ //sessionӦbtreeд
+ */
 static int
-__checkpoint_tree(
-    WT_SESSION_IMPL *session, bool is_checkpoint, const char *cfg[])
+__checkpoint_tree_start(
+    WT_SESSION_IMPL *session, bool is_checkpoint, WT_CKPT_WORK *work)
 {
 	WT_BM *bm;
 	WT_BTREE *btree;
-	WT_CKPT *ckpt, *ckptbase;
 	WT_CONNECTION_IMPL *conn;
-	WT_DATA_HANDLE *dhandle;
-	WT_DECL_RET;
-	WT_LSN ckptlsn;
-	bool fake_ckpt, resolve_bm;
-
-	WT_UNUSED(cfg);
 
 	btree = S2BT(session);
 	bm = btree->bm;
-	ckptbase = btree->ckpt;
 	conn = S2C(session);
-	dhandle = session->dhandle;
-	fake_ckpt = resolve_bm = false;
 
 	/*
 	 * Set the checkpoint LSN to the maximum LSN so that if logging is
@@ -1530,7 +1524,7 @@ __checkpoint_tree(
 	 * real checkpoint LSN will be assigned for this checkpoint and
 	 * overwrite this.
 	 */
-	WT_MAX_LSN(&ckptlsn);
+	WT_MAX_LSN(&work->ckptlsn);
 
 	/*
 	 * If an object has never been used (in other words, if it could become
@@ -1547,8 +1541,8 @@ __checkpoint_tree(
 	 */
 	if (is_checkpoint)
 		if (btree->original) {
-			fake_ckpt = true;
-			goto fake;
+			work->fake_ckpt = true;
+			return (0);
 		}
 
 	/*
@@ -1565,7 +1559,7 @@ __checkpoint_tree(
 	 * Also, marking the btree dirty at this stage will unnecessarily mark
 	 * the connection as dirty causing checkpoint-skip code to fail.
 	 */
-	WT_ERR(__wt_page_modify_init(session, btree->root.page));
+	WT_RET(__wt_page_modify_init(session, btree->root.page));
 	__wt_page_only_modify_set(session, btree->root.page);
 
 	/*
@@ -1582,19 +1576,43 @@ __checkpoint_tree(
 
 	/* Tell logging that a file checkpoint is starting. */
 	if (FLD_ISSET(conn->log_flags, WT_CONN_LOG_ENABLED))
-		WT_ERR(__wt_txn_checkpoint_log(
-		    session, false, WT_TXN_LOG_CKPT_START, &ckptlsn));
+		WT_RET(__wt_txn_checkpoint_log(
+		    session, false, WT_TXN_LOG_CKPT_START, &work->ckptlsn));
 
 	/* Tell the block manager that a file checkpoint is starting. */
 	//__bm_checkpoint_start_readonly  __bm_checkpoint_start
-	WT_ERR(bm->checkpoint_start(bm, session)); //checkpoint startʼ
-	resolve_bm = true;
+	WT_RET(bm->checkpoint_start(bm, session)); //checkpoint startʼ
+	work->resolve_bm = true;
+
+	return (0);
+}
+
+/*
+ * __checkpoint_tree_write --
+ *	Write a single tree's dirty pages, creating the checkpoint.  This is
+ *	the part of a tree's checkpoint done by checkpoint worker threads.
+ */
+static int
+__checkpoint_tree_write(WT_SESSION_IMPL *session, bool is_checkpoint)
+{
+	WT_BTREE *btree;
+	WT_CKPT *ckpt, *ckptbase;
+
+	btree = S2BT(session);
+	ckptbase = btree->ckpt;
+
+	/*
+	 * Merge any buffered writes into their pages so they're written, after
+	 * clearing the modified flag: writes buffered after the merge set the
+	 * flag again.
+	 */
+	WT_RET(__wt_change_buffer_merge_all(session));
 
 	/* Flush the file from the cache, creating the checkpoint. */
 	if (is_checkpoint) //checkpoint
-		WT_ERR(__wt_cache_op(session, WT_SYNC_CHECKPOINT));
+		WT_RET(__wt_cache_op(session, WT_SYNC_CHECKPOINT));
 	else
-		WT_ERR(__wt_cache_op(session, WT_SYNC_CLOSE));
+		WT_RET(__wt_cache_op(session, WT_SYNC_CLOSE));
 
 	/*
 	 * All blocks being written have been written; set the object's write
@@ -1604,13 +1622,37 @@ __checkpoint_tree(
 		if (F_ISSET(ckpt, WT_CKPT_ADD))
 			ckpt->write_gen = btree->write_gen;
 
-fake:	/*
+	return (0);
+}
+
+/*
+ * __checkpoint_tree_finish --
+ *	Update a single tree's metadata once its pages are written, or clean
+ *	up after a failure.
+ */
+static int
+__checkpoint_tree_finish(WT_SESSION_IMPL *session,
+    bool is_checkpoint, WT_CKPT_WORK *work, int ret)
+{
+	WT_BM *bm;
+	WT_BTREE *btree;
+	WT_CONNECTION_IMPL *conn;
+	WT_DATA_HANDLE *dhandle;
+
+	btree = S2BT(session);
+	bm = btree->bm;
+	conn = S2C(session);
+	dhandle = session->dhandle;
+
+	WT_ERR(ret);
+
+	/*
 	 * If we're faking a checkpoint and logging is enabled, recovery should
 	 * roll forward any changes made between now and the next checkpoint,
 	 * so set the checkpoint LSN to the beginning of time.
 	 */
-	if (fake_ckpt && FLD_ISSET(conn->log_flags, WT_CONN_LOG_ENABLED))
-		WT_INIT_LSN(&ckptlsn);
+	if (work->fake_ckpt && FLD_ISSET(conn->log_flags, WT_CONN_LOG_ENABLED))
+		WT_INIT_LSN(&work->ckptlsn);
 
 	/*
 	 * Update the object's metadata.
@@ -1631,7 +1673,7 @@ fake:	/*
 		WT_ERR(__wt_checkpoint_sync(session, NULL));
 
 	WT_ERR(__wt_meta_ckptlist_set(
-	    session, dhandle->name, ckptbase, &ckptlsn));
+	    session, dhandle->name, btree->ckpt, &work->ckptlsn));
 
 	/*
 	 * If we wrote a checkpoint (rather than faking one), we have to resolve
@@ -1640,8 +1682,8 @@ fake:	/*
 	 * in which case the handle will be gone by the time we try to apply or
 	 * unroll the meta tracking event.
 	 */
-	if (!fake_ckpt) {
-		resolve_bm = false;
+	if (!work->fake_ckpt) {
+		work->resolve_bm = false;
 		if (WT_META_TRACKING(session) && is_checkpoint)
 			WT_ERR(__wt_meta_track_checkpoint(session));
 		else
@@ -1654,7 +1696,7 @@ fake:	/*
 		    session, false, WT_TXN_LOG_CKPT_STOP, NULL));
 
 err:	/* Resolved the checkpoint for the block manager in the error path. */
-	if (resolve_bm)
+	if (work->resolve_bm)
 		WT_TRET(bm->checkpoint_resolve(bm, session, ret != 0));
 
 	/*
@@ -1671,6 +1713,27 @@ err:	/* Resolved the checkpoint for the block manager in the error path. */
 	return (ret);
 }
 
+/*
+ * __checkpoint_tree --
+ *	Checkpoint a single tree.
+ *	Assumes all necessary locks have been acquired by the caller.
+ */ //sessionӦbtreeд
+static int
+__checkpoint_tree(
+    WT_SESSION_IMPL *session, bool is_checkpoint, const char *cfg[])
+{
+	WT_CKPT_WORK work;
+	WT_DECL_RET;
+
+	WT_UNUSED(cfg);
+
+	WT_CLEAR(work);
+	ret = __checkpoint_tree_start(session, is_checkpoint, &work);
+	if (ret == 0 && !work.fake_ckpt)
+		ret = __checkpoint_tree_write(session, is_checkpoint);
+	return (__checkpoint_tree_finish(session, is_checkpoint, &work, ret));
+}
+
 /*
  * __checkpoint_presync --
  *	Visit all handles after the checkpoint writes are complete and before
@@ -1745,6 +1808,477 @@ __checkpoint_tree_helper(WT_SESSION_IMPL *session, const char *cfg[])
 	return (ret);
 }
 
+/*
+ * __checkpoint_tree_write_ts --
+ *	Write a single tree's dirty pages, ignoring the checkpoint's read
+ *	timestamp if the tree is immediately durable.
+ */
+static int
+__checkpoint_tree_write_ts(WT_SESSION_IMPL *session)
+{
+	WT_DECL_RET;
+	WT_TXN *txn;
+	bool with_timestamp;
+
+	txn = &session->txn;
+	with_timestamp = F_ISSET(txn, WT_TXN_HAS_TS_READ);
+
+	if (__wt_btree_immediately_durable(session))
+		F_CLR(txn, WT_TXN_HAS_TS_READ);
+
+	ret = __checkpoint_tree_write(session, true);
+
+	if (with_timestamp)
+		F_SET(txn, WT_TXN_HAS_TS_READ);
+	return (ret);
+}
+
+/*
+ * __checkpoint_tree_work --
+ *	Write a tree handed out by the checkpoint, and record how long it took.
+ */
+static void
+__checkpoint_tree_work(
+    WT_SESSION_IMPL *session, u_int thread_id, WT_CKPT_WORK *work)
+{
+	struct timespec start, stop;
+	WT_DECL_RET;
+	uint64_t bytes;
+
+	__wt_epoch(session, &start);
+	bytes = session->ckpt_write_bytes;
+
+	if (!work->fake_ckpt)
+		WT_WITH_DHANDLE(session, work->dhandle,
+		    ret = __checkpoint_tree_write_ts(session));
+
+	__wt_epoch(session, &stop);
+	work->thread_id = thread_id;
+	work->bytes = session->ckpt_write_bytes - bytes;
+	work->usecs = WT_TIMEDIFF_US(stop, start);
+	work->ret = ret;
+}
+
+/*
+ * __checkpoint_sync_work --
+ *	Flush an object written by a checkpoint to stable storage.
+ */
+static void
+__checkpoint_sync_work(WT_SESSION_IMPL *session, WT_CKPT_WORK *work)
+{
+	WT_DECL_RET;
+
+	WT_WITH_DHANDLE(session, work->dhandle,
+	    ret = __wt_checkpoint_sync(session, NULL));
+	work->ret = ret;
+}
+
+/*
+ * __checkpoint_worker_snapshot --
+ *	Copy the checkpoint's snapshot into a checkpoint worker thread's
+ *	transaction, so the worker writes the view of a tree the checkpoint
+ *	would.  The checkpoint's snapshot is pinned until the checkpoint
+ *	resolves, after the workers finish.
+ */
+static void
+__checkpoint_worker_snapshot(WT_SESSION_IMPL *session, WT_TXN *ckpt_txn)
+{
+	WT_TXN *txn;
+
+	txn = &session->txn;
+
+	txn->isolation = WT_ISO_SNAPSHOT;
+	txn->snap_min = ckpt_txn->snap_min;
+	txn->snap_max = ckpt_txn->snap_max;
+	txn->snapshot_count = ckpt_txn->snapshot_count;
+	if (txn->snapshot_count != 0)
+		memcpy(txn->snapshot, ckpt_txn->snapshot,
+		    txn->snapshot_count * sizeof(*txn->snapshot));
+	F_SET(txn, WT_TXN_HAS_SNAPSHOT);
+
+#ifdef HAVE_TIMESTAMPS
+	if (F_ISSET(ckpt_txn, WT_TXN_HAS_TS_READ)) {
+		__wt_timestamp_set(
+		    &txn->read_timestamp, &ckpt_txn->read_timestamp);
+		F_SET(txn, WT_TXN_HAS_TS_READ);
+	}
+#endif
+}
+
+/*
+ * __checkpoint_worker_chk --
+ *	Check to decide if a checkpoint worker thread should continue running.
+ */
+static bool
+__checkpoint_worker_chk(WT_SESSION_IMPL *session)
+{
+	return (S2C(session)->ckpt_workers_running);
+}
+
+/*
+ * __checkpoint_worker_run --
+ *	Entry function for a checkpoint worker thread.  This is called
+ *	repeatedly from the thread group code so it does not need to loop
+ *	itself.
+ */
+static int
+__checkpoint_worker_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+	WT_CKPT_WORK *work;
+	WT_CONNECTION_IMPL *conn;
+	WT_SESSION_IMPL *ckpt_session;
+	WT_TXN *txn;
+	uint32_t i;
+
+	conn = S2C(session);
+	txn = &session->txn;
+
+	/*
+	 * The checkpoint waits for workers to finish with its session and the
+	 * array of trees before it discards them.
+	 */
+	(void)__wt_atomic_addv32(&conn->ckpt_work_active, 1);
+	if ((ckpt_session = conn->ckpt_work_session) != NULL) {
+		__checkpoint_worker_snapshot(session, &ckpt_session->txn);
+		F_SET(session,
+		    WT_SESSION_CHECKPOINT_WORKER | WT_SESSION_IGNORE_CACHE_SIZE);
+
+		/*
+		 * Write any trees handed out by the checkpoint, and leaf pages
+		 * queued by the threads walking trees, until the checkpoint is
+		 * done writing pages.
+		 */
+		while (conn->ckpt_work_session != NULL &&
+		    conn->ckpt_workers_running) {
+			while ((work = conn->ckpt_work) != NULL &&
+			    (i = __wt_atomic_addv32(
+			    &conn->ckpt_work_next, 1) - 1) <
+			    conn->ckpt_work_count) {
+				if (conn->ckpt_work_sync)
+					__checkpoint_sync_work(
+					    session, &work[i]);
+				else
+					__checkpoint_tree_work(
+					    session, thread->id, &work[i]);
+				if (__wt_atomic_addv32(&conn->ckpt_work_done,
+				    1) == conn->ckpt_work_count)
+					__wt_cond_signal(
+					    session, conn->ckpt_work_cond);
+			}
+			if (!__wt_sync_leaf_help(session))
+				__wt_cond_wait(session,
+				    conn->ckpt_workers.wait_cond, 1000, NULL);
+		}
+
+		F_CLR(session,
+		    WT_SESSION_CHECKPOINT_WORKER | WT_SESSION_IGNORE_CACHE_SIZE);
+		F_CLR(txn, WT_TXN_HAS_SNAPSHOT | WT_TXN_HAS_TS_READ);
+		txn->isolation = session->isolation;
+	}
+	(void)__wt_atomic_subv32(&conn->ckpt_work_active, 1);
+
+	__wt_cond_wait(session, conn->ckpt_workers.wait_cond,
+	    10000, __checkpoint_worker_chk);
+	return (0);
+}
+
+/*
+ * __wt_checkpoint_workers_create --
+ *	Start the checkpoint worker threads.
+ */
+int
+__wt_checkpoint_workers_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	WT_ASSERT(session, F_ISSET(session, WT_SESSION_LOCKED_CHECKPOINT));
+
+	/*
+	 * Stop any threads already running, reconfiguration starts from a
+	 * blank slate the same as the checkpoint server.
+	 */
+	WT_RET(__wt_checkpoint_workers_destroy(session));
+
+	WT_RET(__wt_config_gets(session, cfg, "checkpoint.threads", &cval));
+	conn->ckpt_threads = (uint32_t)cval.val;
+
+	/* The thread running the checkpoint is one of the threads. */
+	if (conn->ckpt_threads < 2)
+		return (0);
+
+	WT_RET(__wt_cond_alloc(
+	    session, "checkpoint workers", &conn->ckpt_work_cond));
+
+	/* Set first, the threads might run before we finish up. */
+	conn->ckpt_workers_running = true;
+
+	WT_RET(__wt_thread_group_create(session, &conn->ckpt_workers,
+	    "checkpoint-worker", conn->ckpt_threads - 1, conn->ckpt_threads - 1,
+	    WT_THREAD_CAN_WAIT, __checkpoint_worker_chk,
+	    __checkpoint_worker_run, NULL));
+
+	return (0);
+}
+
+/*
+ * __wt_checkpoint_workers_destroy --
+ *	Destroy the checkpoint worker threads.
+ */
+int
+__wt_checkpoint_workers_destroy(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+
+	conn = S2C(session);
+
+	WT_ASSERT(session, F_ISSET(session, WT_SESSION_LOCKED_CHECKPOINT));
+
+	if (conn->ckpt_workers_running) {
+		__wt_writelock(session, &conn->ckpt_workers.lock);
+
+		conn->ckpt_workers_running = false;
+		__wt_cond_signal(session, conn->ckpt_workers.wait_cond);
+
+		WT_TRET(__wt_thread_group_destroy(session, &conn->ckpt_workers));
+	}
+	__wt_cond_destroy(session, &conn->ckpt_work_cond);
+	conn->ckpt_threads = 1;
+
+	return (ret);
+}
+
+/*
+ * __checkpoint_thread_stats --
+ *	Update the statistics for the threads that wrote a checkpoint's trees.
+ */
+static void
+__checkpoint_thread_stats(
+    WT_SESSION_IMPL *session, WT_CKPT_WORK *work, u_int count)
+{
+	WT_CONNECTION_IMPL *conn;
+	uint64_t bytes[WT_CKPT_THREADS_MAX], usecs[WT_CKPT_THREADS_MAX];
+	uint64_t bytes_max, bytes_min, usecs_max, usecs_min;
+	u_int i;
+
+	conn = S2C(session);
+
+	WT_ASSERT(session, conn->ckpt_threads <= WT_CKPT_THREADS_MAX);
+
+	memset(bytes, 0, sizeof(bytes));
+	memset(usecs, 0, sizeof(usecs));
+	for (i = 0; i < count; ++i) {
+		bytes[work[i].thread_id] += work[i].bytes;
+		usecs[work[i].thread_id] += work[i].usecs;
+	}
+
+	bytes_max = usecs_max = 0;
+	bytes_min = usecs_min = UINT64_MAX;
+	for (i = 0; i < conn->ckpt_threads; ++i) {
+		__wt_verbose(session, WT_VERB_CHECKPOINT,
+		    "checkpoint thread %u wrote %" PRIu64 "B in %" PRIu64 "ms",
+		    i, bytes[i], usecs[i] / WT_THOUSAND);
+		bytes_max = WT_MAX(bytes_max, bytes[i]);
+		bytes_min = WT_MIN(bytes_min, bytes[i]);
+		usecs_max = WT_MAX(usecs_max, usecs[i]);
+		usecs_min = WT_MIN(usecs_min, usecs[i]);
+	}
+
+	WT_STAT_CONN_SET(session, txn_checkpoint_thread_bytes_max, bytes_max);
+	WT_STAT_CONN_SET(session, txn_checkpoint_thread_bytes_min, bytes_min);
+	WT_STAT_CONN_SET(session,
+	    txn_checkpoint_thread_time_max, usecs_max / WT_THOUSAND);
+	WT_STAT_CONN_SET(session,
+	    txn_checkpoint_thread_time_min, usecs_min / WT_THOUSAND);
+	WT_STAT_CONN_INCRV(session, txn_checkpoint_thread_trees, count);
+}
+
+/*
+ * __checkpoint_workers_wait --
+ *	Wait for the checkpoint worker threads to finish with the checkpoint's
+ *	trees.
+ */
+static void
+__checkpoint_workers_wait(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	/*
+	 * Workers increment the count of active workers and then read the
+	 * session, clear the session and then read the count.  A write barrier
+	 * doesn't order the store before the load, a full barrier is needed
+	 * so a worker either sees no session or is seen as active.
+	 */
+	WT_PUBLISH(conn->ckpt_work_session, NULL);
+	WT_FULL_BARRIER();
+	while (conn->ckpt_work_active != 0)
+		__wt_yield();
+	conn->ckpt_work = NULL;
+}
+
+/*
+ * __checkpoint_apply_trees --
+ *	Checkpoint all trees locked for a checkpoint.
+ *
+ *	With checkpoint worker threads configured, the trees' pages are written
+ *	in parallel.  Starting a tree's checkpoint and updating its metadata
+ *	is done by the checkpoint's thread, in the checkpoint's transaction, in
+ *	the same order as a single-threaded checkpoint.  Worker threads also
+ *	help write the dirty leaf pages of each tree, including when there is
+ *	only a single tree to checkpoint.
+ */
+static int
+__checkpoint_apply_trees(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_BTREE *btree;
+	WT_CKPT_WORK *work;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	uint32_t count, i, started;
+
+	conn = S2C(session);
+
+	if (!conn->ckpt_workers_running)
+		return (__checkpoint_apply(
+		    session, cfg, __checkpoint_tree_helper));
+
+	if (session->ckpt_handle_next < 2) {
+		WT_PUBLISH(conn->ckpt_work_session, session);
+		ret = __checkpoint_apply(session, cfg, __checkpoint_tree_helper);
+		__checkpoint_workers_wait(session);
+		return (ret);
+	}
+
+	WT_RET(__wt_calloc_def(session, session->ckpt_handle_next, &work));
+	for (count = i = 0; i < session->ckpt_handle_next; ++i)
+		if (session->ckpt_handle[i] != NULL)
+			work[count++].dhandle = session->ckpt_handle[i];
+
+	/* Start the trees' checkpoints, stopping at the first failure. */
+	for (started = 0; started < count;) {
+		WT_WITH_DHANDLE(session, work[started].dhandle,
+		    ret = __checkpoint_tree_start(
+		    session, true, &work[started]));
+		work[started++].ret = ret;
+		if (ret != 0)
+			break;
+	}
+
+	/*
+	 * Hand the trees out to the worker threads and write trees until there
+	 * are none left, then wait for the workers to finish.
+	 */
+	if (ret == 0) {
+		conn->ckpt_work_count = count;
+		conn->ckpt_work_next = conn->ckpt_work_done = 0;
+		WT_PUBLISH(conn->ckpt_work, work);
+		WT_PUBLISH(conn->ckpt_work_session, session);
+		__wt_cond_signal(session, conn->ckpt_workers.wait_cond);
+
+		while ((i = __wt_atomic_addv32(&conn->ckpt_work_next, 1) - 1) <
+		    count) {
+			__checkpoint_tree_work(
+			    session, conn->ckpt_threads - 1, &work[i]);
+			(void)__wt_atomic_addv32(&conn->ckpt_work_done, 1);
+		}
+		while (conn->ckpt_work_done < count)
+			if (!__wt_sync_leaf_help(session))
+				__wt_cond_wait(
+				    session, conn->ckpt_work_cond, 1000, NULL);
+
+		__checkpoint_workers_wait(session);
+
+		__checkpoint_thread_stats(session, work, count);
+	}
+
+	/*
+	 * Update the trees' metadata in order.  After a failure, the remaining
+	 * trees' checkpoints are resolved as failed.
+	 */
+	for (i = 0; i < started; ++i) {
+		if (ret == 0)
+			ret = work[i].ret;
+		WT_WITH_DHANDLE(session, work[i].dhandle, ret =
+		    __checkpoint_tree_finish(session, true, &work[i], ret));
+
+		/*
+		 * Whatever happened, we aren't visiting this tree again in this
+		 * checkpoint; restore eviction's view of the tree.
+		 */
+		WT_WITH_DHANDLE(session, work[i].dhandle,
+		    __checkpoint_update_generation(session));
+		btree = work[i].dhandle->handle;
+		btree->evict_walk_period = btree->evict_walk_saved;
+	}
+	__wt_evict_server_wake(session);
+
+	__wt_free(session, work);
+	return (ret);
+}
+
+/*
+ * __checkpoint_apply_sync --
+ *	Flush all trees written by a checkpoint to stable storage.
+ *
+ *	With checkpoint worker threads configured, the trees are flushed in
+ *	parallel, so the checkpoint waits for the slowest flush rather than
+ *	the sum of them.  All flushes complete before the checkpoint resolves
+ *	and the metadata is updated.
+ */
+static int
+__checkpoint_apply_sync(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CKPT_WORK *work;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	uint32_t count, i;
+
+	conn = S2C(session);
+
+	if (!conn->ckpt_workers_running || session->ckpt_handle_next < 2 ||
+	    !F_ISSET(conn, WT_CONN_CKPT_SYNC))
+		return (__checkpoint_apply(session, cfg, __wt_checkpoint_sync));
+
+	WT_RET(__wt_calloc_def(session, session->ckpt_handle_next, &work));
+	for (count = i = 0; i < session->ckpt_handle_next; ++i)
+		if (session->ckpt_handle[i] != NULL)
+			work[count++].dhandle = session->ckpt_handle[i];
+
+	/*
+	 * Hand the trees out to the worker threads and flush trees until there
+	 * are none left, then wait for the workers to finish.
+	 */
+	conn->ckpt_work_sync = true;
+	conn->ckpt_work_count = count;
+	conn->ckpt_work_next = conn->ckpt_work_done = 0;
+	WT_PUBLISH(conn->ckpt_work, work);
+	WT_PUBLISH(conn->ckpt_work_session, session);
+	__wt_cond_signal(session, conn->ckpt_workers.wait_cond);
+
+	while ((i = __wt_atomic_addv32(&conn->ckpt_work_next, 1) - 1) < count) {
+		__checkpoint_sync_work(session, &work[i]);
+		(void)__wt_atomic_addv32(&conn->ckpt_work_done, 1);
+	}
+	while (conn->ckpt_work_done < count)
+		__wt_cond_wait(session, conn->ckpt_work_cond, 1000, NULL);
+
+	__checkpoint_workers_wait(session);
+	conn->ckpt_work_sync = false;
+
+	/* Return the first failure, in the order of the trees. */
+	for (i = 0; i < count && ret == 0; ++i)
+		ret = work[i].ret;
+	WT_STAT_CONN_INCRV(session, txn_checkpoint_fsync_parallel, count);
+
+	__wt_free(session, work);
+	return (ret);
+}
+
 /*
  * __wt_checkpoint --
  *	Checkpoint a file.
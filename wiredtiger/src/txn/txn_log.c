@@ -268,6 +268,41 @@ __wt_txn_log_op(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt)
 	return (ret);
 }
 
+/*
+ * __txn_log_stream --
+ *	Choose the log stream for a transaction's commit record.  A file's
+ *	operations always use the same stream, keeping the file's records in
+ *	commit order; transactions modifying the metadata or files in more than
+ *	one stream are written in order across the streams.
+ */
+static uint32_t
+__txn_log_stream(WT_SESSION_IMPL *session)
+{
+	WT_LOG *log;
+	WT_TXN *txn;
+	WT_TXN_OP *op;
+	u_int i;
+	uint32_t stream;
+
+	log = S2C(session)->log;
+	txn = &session->txn;
+
+	stream = WT_LOG_STREAM_ORDERED;
+	if (log->streams == 1)
+		return (stream);
+	for (i = 0, op = txn->mod; i < txn->mod_count; i++, op++) {
+		if (op->type == WT_TXN_OP_INMEM || op->type == WT_TXN_OP_REF)
+			continue;
+		if (op->fileid == WT_METAFILE_ID)
+			return (WT_LOG_STREAM_ORDERED);
+		if (stream == WT_LOG_STREAM_ORDERED)
+			stream = op->fileid % log->streams;
+		else if (op->fileid % log->streams != stream)
+			return (WT_LOG_STREAM_ORDERED);
+	}
+	return (stream);
+}
+
 /*
  * __wt_txn_log_commit --
  *	Write the operations of a transaction to the log at commit time.
@@ -288,7 +323,8 @@ __wt_txn_log_commit(WT_SESSION_IMPL *session, const char *cfg[])
 		return (0);
 
 	/* Write updates to the log. */
-	return (__wt_log_write(session, txn->logrec, NULL, txn->txn_logsync));
+	return (__wt_log_write_stream(session, txn->logrec, NULL,
+	    txn->txn_logsync, __txn_log_stream(session)));
 }
 
 /*
@@ -306,6 +306,8 @@ __wt_txn_named_snapshot_get(WT_SESSION_IMPL *session, WT_CONFIG_ITEM *nameval)
 			 * forward without seeing our pinned ID.
 			 */
 			__wt_readlock(session, &txn_global->rwlock);
+			__wt_txn_state_track(
+			    session, txn_global->states_pinned, true);
 			txn_state->pinned_id = nsnap->pinned_id;
 			__wt_readunlock(session, &txn_global->rwlock);
 
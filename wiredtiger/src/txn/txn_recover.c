@@ -15,7 +15,40 @@ typedef struct {
 	WT_LSN ckpt_lsn;		/* File's checkpoint LSN. */
 } WT_RECOVERY_FILE;
 
+typedef struct __wt_recovery WT_RECOVERY;
+
+/*
+ * Operations are handed to parallel recovery workers in batches: each batch
+ * is a sequence of operations, each preceded by a header with its LSN and
+ * size.
+ */
+#define	WT_RECOVERY_BATCHES	4		/* Batches per worker */
+#define	WT_RECOVERY_BATCH_SIZE	(256 * WT_KILOBYTE)
+
 typedef struct {
+	WT_LSN lsn;			/* Operation's log record LSN */
+	uint32_t size;			/* Operation size */
+} WT_RECOVERY_OP;
+
+/* A thread applying operations during parallel recovery. */
+typedef struct {
+	WT_RECOVERY *r;
+	WT_SESSION_IMPL *session;	/* Worker session */
+	u_int id;			/* Worker ID */
+
+	wt_thread_t tid;		/* Worker thread */
+	bool tid_set;			/* Worker thread set */
+
+	WT_CONDVAR *cond;		/* Batches queued condition */
+	WT_ITEM batch[WT_RECOVERY_BATCHES];
+	volatile uint64_t batch_head;	/* Next batch to apply */
+	volatile uint64_t batch_tail;	/* Next batch to fill */
+
+	volatile bool done;		/* Worker should exit */
+	volatile int ret;		/* Worker error */
+} WT_RECOVERY_WORKER;
+
+struct __wt_recovery {
 	WT_SESSION_IMPL *session;
 
 	/* Files from the metadata, indexed by file ID. */
@@ -32,22 +65,25 @@ typedef struct {
 					 * Set during the first recovery pass,
 					 * when only the metadata is recovered.
 					 */
-} WT_RECOVERY;
+
+	/*
+	 * Parallel recovery: the main recovery loop hands each file's
+	 * operations to the same worker, preserving their order.
+	 */
+	WT_RECOVERY_WORKER *workers;	/* Workers applying operations */
+	u_int nworkers;			/* Number of workers */
+	WT_CONDVAR *apply_cond;		/* Batches applied condition */
+};
 
 /*
- * __recovery_cursor --
- *	Get a cursor for a recovery operation.
+ * __recovery_file_apply --
+ *	Return if an operation on a file is applied in this recovery pass.
  */
-static int
-__recovery_cursor(WT_SESSION_IMPL *session, WT_RECOVERY *r,
-    WT_LSN *lsnp, u_int id, bool duplicate, WT_CURSOR **cp)
+static bool
+__recovery_file_apply(
+    WT_SESSION_IMPL *session, WT_RECOVERY *r, WT_LSN *lsnp, u_int id)
 {
-	WT_CURSOR *c;
 	bool metadata_op;
-	const char *cfg[] = { WT_CONFIG_BASE(
-	    session, WT_SESSION_open_cursor), "overwrite", NULL };
-
-	c = NULL;
 
 	/*
 	 * Metadata operations have an id of 0.  Match operations based
@@ -59,15 +95,38 @@ __recovery_cursor(WT_SESSION_IMPL *session, WT_RECOVERY *r,
 	 */
 	metadata_op = id == WT_METAFILE_ID;
 	if (r->metadata_only != metadata_op)
-		;
-	else if (id >= r->nfiles || r->files[id].uri == NULL) {
+		return (false);
+	if (id >= r->nfiles || r->files[id].uri == NULL) {
 		/* If a file is missing, output a verbose message once. */
 		if (!r->missing)
 			__wt_verbose(session, WT_VERB_RECOVERY,
 			    "No file found with ID %u (max %u)",
 			    id, r->nfiles);
 		r->missing = true;
-	} else if (__wt_log_cmp(lsnp, &r->files[id].ckpt_lsn) >= 0) {
+		return (false);
+	}
+	return (__wt_log_cmp(lsnp, &r->files[id].ckpt_lsn) >= 0);
+}
+
+/*
+ * __recovery_cursor --
+ *	Get a cursor for a recovery operation.
+ */
+static int
+__recovery_cursor(WT_SESSION_IMPL *session, WT_RECOVERY *r,
+    WT_LSN *lsnp, u_int id, bool duplicate, WT_CURSOR **cp)
+{
+	WT_CURSOR *c;
+	const char *cfg[] = { WT_CONFIG_BASE(
+	    session, WT_SESSION_open_cursor), "overwrite", NULL };
+
+	c = NULL;
+
+	/*
+	 * With parallel recovery, a file's cursor is only used by the worker
+	 * applying the file's operations, and is opened in its session.
+	 */
+	if (__recovery_file_apply(session, r, lsnp, id)) {
 		/*
 		 * We're going to apply the operation.  Get the cursor, opening
 		 * one if none is cached.
@@ -105,17 +164,15 @@ __recovery_cursor(WT_SESSION_IMPL *session, WT_RECOVERY *r,
  *	Apply a transactional operation during recovery.
  */
 static int
-__txn_op_apply(
+__txn_op_apply(WT_SESSION_IMPL *session,
     WT_RECOVERY *r, WT_LSN *lsnp, const uint8_t **pp, const uint8_t *end)
 {
 	WT_CURSOR *cursor, *start, *stop;
 	WT_DECL_RET;
 	WT_ITEM key, start_key, stop_key, value;
-	WT_SESSION_IMPL *session;
 	uint64_t recno, start_recno, stop_recno;
 	uint32_t fileid, mode, optype, opsize;
 
-	session = r->session;
 	cursor = NULL;
 
 	/* Peek at the size and the type. */
@@ -281,6 +338,249 @@ err:	__wt_err(session, ret,
 	return (ret);
 }
 
+/*
+ * __recovery_worker --
+ *	Thread applying batches of operations during parallel recovery.
+ */
+static WT_THREAD_RET
+__recovery_worker(void *arg)
+{
+	WT_CURSOR *c;
+	WT_DECL_RET;
+	WT_ITEM *batch;
+	WT_RECOVERY *r;
+	WT_RECOVERY_OP op;
+	WT_RECOVERY_WORKER *worker;
+	WT_SESSION_IMPL *session;
+	uint64_t ops;
+	u_int i;
+	const uint8_t *end, *p, *opp;
+
+	worker = arg;
+	r = worker->r;
+	session = worker->session;
+
+	while (!worker->done) {
+		if (worker->batch_head == worker->batch_tail) {
+			__wt_cond_wait(session, worker->cond, 10000, NULL);
+			continue;
+		}
+
+		/* Apply the operations in the batch, in log order. */
+		WT_READ_BARRIER();
+		batch = &worker->batch[worker->batch_head % WT_RECOVERY_BATCHES];
+		ops = 0;
+		for (p = batch->mem, end = p + batch->size; p < end;
+		    p += WT_ALIGN(sizeof(op) + op.size, sizeof(uint64_t))) {
+			memcpy(&op, p, sizeof(op));
+			opp = p + sizeof(op);
+			WT_ERR(__txn_op_apply(
+			    session, r, &op.lsn, &opp, opp + op.size));
+			++ops;
+		}
+		WT_STAT_CONN_INCRV(session, txn_recover_parallel_ops, ops);
+
+		batch->size = 0;
+		WT_PUBLISH(worker->batch_head, worker->batch_head + 1);
+		__wt_cond_signal(session, r->apply_cond);
+	}
+
+	if (0) {
+err:		WT_PUBLISH(worker->ret, ret);
+		__wt_cond_signal(session, r->apply_cond);
+	}
+
+	/* Close the cursors opened for this worker's files. */
+	for (i = worker->id; i < r->nfiles; i += r->nworkers)
+		if ((c = r->files[i].c) != NULL) {
+			r->files[i].c = NULL;
+			WT_TRET(c->close(c));
+		}
+	if (ret != 0 && worker->ret == 0)
+		WT_PUBLISH(worker->ret, ret);
+
+	return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __recovery_worker_wait --
+ *	Wait until a worker has at most a number of batches queued.
+ */
+static int
+__recovery_worker_wait(
+    WT_RECOVERY *r, WT_RECOVERY_WORKER *worker, uint64_t queued)
+{
+	while (worker->ret == 0 &&
+	    worker->batch_tail - worker->batch_head > queued)
+		__wt_cond_wait(r->session, r->apply_cond, 10000, NULL);
+	return (worker->ret);
+}
+
+/*
+ * __recovery_worker_publish --
+ *	Hand the batch being filled to a worker.
+ */
+static void
+__recovery_worker_publish(WT_RECOVERY *r, WT_RECOVERY_WORKER *worker)
+{
+	WT_PUBLISH(worker->batch_tail, worker->batch_tail + 1);
+	__wt_cond_signal(r->session, worker->cond);
+}
+
+/*
+ * __recovery_dispatch --
+ *	Queue an operation for the worker applying its file's operations.
+ */
+static int
+__recovery_dispatch(
+    WT_RECOVERY *r, WT_LSN *lsnp, const uint8_t **pp, const uint8_t *end)
+{
+	WT_ITEM *batch;
+	WT_RECOVERY_OP op;
+	WT_RECOVERY_WORKER *worker;
+	WT_SESSION_IMPL *session;
+	size_t len;
+	uint32_t fileid, optype, opsize;
+	uint8_t *p;
+
+	session = r->session;
+
+	/* Every operation in a commit record starts with its file ID. */
+	WT_RET(__wt_struct_unpack(session, *pp, WT_PTRDIFF(end, *pp),
+	    "III", &optype, &opsize, &fileid));
+	if (opsize > WT_PTRDIFF(end, *pp))
+		WT_RET_MSG(session, WT_ERROR,
+		    "operation size overflow during recovery: operation type %"
+		    PRIu32 " at LSN %" PRIu32 "/%" PRIu32,
+		    optype, lsnp->l.file, lsnp->l.offset);
+
+	if (!__recovery_file_apply(session, r, lsnp, fileid)) {
+		__wt_verbose(session, WT_VERB_RECOVERY,
+		    "Skipping op %" PRIu32 " to file %" PRIu32 " at LSN %"
+		    PRIu32 "/%" PRIu32,
+		    optype, fileid, lsnp->l.file, lsnp->l.offset);
+		*pp += opsize;
+		return (0);
+	}
+
+	/* Wait for the worker to free a batch we can fill. */
+	worker = &r->workers[fileid % r->nworkers];
+	WT_RET(__recovery_worker_wait(r, worker, WT_RECOVERY_BATCHES - 1));
+
+	batch = &worker->batch[worker->batch_tail % WT_RECOVERY_BATCHES];
+	len = WT_ALIGN(sizeof(op) + opsize, sizeof(uint64_t));
+	WT_RET(__wt_buf_grow(session, batch, batch->size + len));
+	op.lsn = *lsnp;
+	op.size = opsize;
+	p = (uint8_t *)batch->mem + batch->size;
+	memcpy(p, &op, sizeof(op));
+	memcpy(p + sizeof(op), *pp, opsize);
+	batch->size += len;
+	*pp += opsize;
+
+	if (batch->size >= WT_RECOVERY_BATCH_SIZE)
+		__recovery_worker_publish(r, worker);
+	return (0);
+}
+
+/*
+ * __recovery_workers_start --
+ *	Start the threads applying operations during parallel recovery.
+ */
+static int
+__recovery_workers_start(WT_RECOVERY *r, u_int nworkers)
+{
+	WT_RECOVERY_WORKER *worker;
+	WT_SESSION_IMPL *session;
+	u_int i;
+
+	session = r->session;
+
+	WT_RET(__wt_cond_alloc(session, "recovery apply", &r->apply_cond));
+	WT_RET(__wt_calloc_def(session, nworkers, &r->workers));
+	r->nworkers = nworkers;
+
+	for (i = 0; i < nworkers; ++i) {
+		worker = &r->workers[i];
+		worker->r = r;
+		worker->id = i;
+		WT_RET(__wt_cond_alloc(
+		    session, "recovery worker", &worker->cond));
+		WT_RET(__wt_open_internal_session(S2C(session),
+		    "txn-recover-worker", false,
+		    WT_SESSION_NO_LOGGING, &worker->session));
+		WT_RET(__wt_thread_create(
+		    session, &worker->tid, __recovery_worker, worker));
+		worker->tid_set = true;
+	}
+
+	__wt_verbose(session, WT_VERB_RECOVERY,
+	    "Applying operations with %u recovery threads", nworkers);
+	return (0);
+}
+
+/*
+ * __recovery_workers_drain --
+ *	Wait for the workers to apply all of the queued operations.
+ */
+static int
+__recovery_workers_drain(WT_RECOVERY *r)
+{
+	WT_RECOVERY_WORKER *worker;
+	u_int i;
+
+	for (i = 0; i < r->nworkers; ++i) {
+		worker = &r->workers[i];
+		if (worker->batch[
+		    worker->batch_tail % WT_RECOVERY_BATCHES].size != 0)
+			__recovery_worker_publish(r, worker);
+	}
+	for (i = 0; i < r->nworkers; ++i)
+		WT_RET(__recovery_worker_wait(r, &r->workers[i], 0));
+	return (0);
+}
+
+/*
+ * __recovery_workers_stop --
+ *	Stop the parallel recovery threads and free their resources.
+ */
+static int
+__recovery_workers_stop(WT_RECOVERY *r)
+{
+	WT_DECL_RET;
+	WT_RECOVERY_WORKER *worker;
+	WT_SESSION *wt_session;
+	WT_SESSION_IMPL *session;
+	u_int i, j;
+
+	session = r->session;
+
+	if (r->workers == NULL)
+		return (0);
+
+	for (i = 0; i < r->nworkers; ++i) {
+		worker = &r->workers[i];
+		if (worker->tid_set) {
+			worker->done = true;
+			__wt_cond_signal(session, worker->cond);
+			WT_TRET(__wt_thread_join(session, worker->tid));
+			worker->tid_set = false;
+		}
+		if (worker->session != NULL) {
+			wt_session = &worker->session->iface;
+			WT_TRET(wt_session->close(wt_session, NULL));
+			worker->session = NULL;
+		}
+		for (j = 0; j < WT_RECOVERY_BATCHES; ++j)
+			__wt_buf_free(session, &worker->batch[j]);
+		__wt_cond_destroy(session, &worker->cond);
+	}
+	__wt_free(session, r->workers);
+	r->nworkers = 0;
+	__wt_cond_destroy(session, &r->apply_cond);
+	return (ret);
+}
+
 /*
  * __txn_commit_apply --
  *	Apply a commit record during recovery.
@@ -291,7 +591,10 @@ __txn_commit_apply(
 {
 	/* The logging subsystem zero-pads records. */
 	while (*pp < end && **pp)
-		WT_RET(__txn_op_apply(r, lsnp, pp, end));
+		if (r->workers != NULL)
+			WT_RET(__recovery_dispatch(r, lsnp, pp, end));
+		else
+			WT_RET(__txn_op_apply(r->session, r, lsnp, pp, end));
 
 	return (0);
 }
@@ -616,6 +919,13 @@ __wt_txn_recover(WT_SESSION_IMPL *session)
 	 */
 	if (needs_rec)
 		FLD_SET(conn->log_flags, WT_CONN_LOG_RECOVER_DIRTY);
+
+	/*
+	 * With more than one recovery thread, this thread reads the log and
+	 * hands the operations to the workers.
+	 */
+	if (conn->log_recover_threads > 1)
+		WT_ERR(__recovery_workers_start(&r, conn->log_recover_threads));
 	if (WT_IS_INIT_LSN(&r.ckpt_lsn))
 		WT_ERR(__wt_log_scan(session, NULL,
 		    WT_LOGSCAN_FIRST | WT_LOGSCAN_RECOVER,
@@ -627,6 +937,10 @@ __wt_txn_recover(WT_SESSION_IMPL *session)
 			ret = 0;
 		WT_ERR(ret);
 	}
+	if (r.workers != NULL) {
+		WT_ERR(__recovery_workers_drain(&r));
+		WT_ERR(__recovery_workers_stop(&r));
+	}
 
 	conn->next_file_id = r.max_fileid;
 
@@ -638,7 +952,8 @@ __wt_txn_recover(WT_SESSION_IMPL *session)
 	 /* ָɣһcheckpoint*/
 ckpt:	WT_ERR(session->iface.checkpoint(&session->iface, "force=1"));
 done:	FLD_SET(conn->log_flags, WT_CONN_LOG_RECOVER_DONE);
-err:	WT_TRET(__recovery_free(&r));
+err:	WT_TRET(__recovery_workers_stop(&r));
+	WT_TRET(__recovery_free(&r));
 	__wt_free(session, config);
 	FLD_CLR(conn->log_flags, WT_CONN_LOG_RECOVER_DIRTY);
 
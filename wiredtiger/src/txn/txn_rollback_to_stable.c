@@ -371,6 +371,9 @@ __txn_rollback_to_stable_btree(WT_SESSION_IMPL *session, const char *cfg[])
 	    __wt_timestamp_set(
 		&rollback_timestamp, &txn_global->stable_timestamp));
 
+	/* Buffered writes must be in their pages to be rolled back. */
+	WT_RET(__wt_change_buffer_merge_all(session));
+
 	/*
 	 * Ensure the eviction server is out of the file - we don't
 	 * want it messing with us. This step shouldn't be required, but
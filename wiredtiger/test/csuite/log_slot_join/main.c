@@ -0,0 +1,190 @@
+/*-
+ * Public Domain 2014-2017 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Log slot join microbenchmark: sweep the number of threads committing small
+ * logged transactions, with and without slot join groups, and report commit
+ * throughput along with the slot join retries and wait times.
+ */
+#define	JOIN_GROUPS	8
+#define	MAX_THREADS	128
+
+typedef struct {
+	TEST_OPTS *opts;
+	uint64_t id;
+} THREAD_ARGS;
+
+static void  run(TEST_OPTS *, u_int);
+static int64_t stat_get(WT_SESSION *, int);
+static void *thread_commit(void *);
+
+int
+main(int argc, char *argv[])
+{
+	TEST_OPTS *opts, _opts;
+
+	/* Ignore unless requested */
+	if (!testutil_is_flag_set("TESTUTIL_ENABLE_LONG_TESTS"))
+		return (EXIT_SUCCESS);
+
+	opts = &_opts;
+	memset(opts, 0, sizeof(*opts));
+	opts->nthreads = 64;
+	opts->nops = 20000; /* per thread */
+	testutil_check(testutil_parse_opts(argc, argv, opts));
+	testutil_assert(opts->nthreads > 0 && opts->nthreads <= MAX_THREADS);
+
+	run(opts, 0);
+	run(opts, JOIN_GROUPS);
+
+	testutil_cleanup(opts);
+	return (EXIT_SUCCESS);
+}
+
+/*
+ * run --
+ *	Run the thread count sweep with a number of slot join groups.
+ */
+static void
+run(TEST_OPTS *opts, u_int join_groups)
+{
+	struct timespec te, ts;
+	THREAD_ARGS args[MAX_THREADS];
+	WT_SESSION *session;
+	pthread_t id[MAX_THREADS];
+	int64_t combine_usecs, retries, yield_usecs;
+	uint64_t commits, i, nthreads;
+	double secs;
+	char config[256];
+
+	testutil_make_work_dir(opts->home);
+	testutil_check(__wt_snprintf(config, sizeof(config),
+	    "create,session_max=%d,statistics=(fast),"
+	    "log=(enabled,join_groups=%u)", MAX_THREADS + 10, join_groups));
+	testutil_check(
+	    wiredtiger_open(opts->home, NULL, config, &opts->conn));
+	testutil_check(
+	    opts->conn->open_session(opts->conn, NULL, NULL, &session));
+	testutil_check(session->create(session,
+	    opts->uri, "key_format=Q,value_format=S"));
+
+	for (nthreads = 1;; nthreads *= 2) {
+		nthreads = WT_MIN(nthreads, opts->nthreads);
+		retries = stat_get(session, WT_STAT_CONN_LOG_SLOT_JOIN_RETRIES);
+		yield_usecs =
+		    stat_get(session, WT_STAT_CONN_LOG_SLOT_YIELD_DURATION);
+		combine_usecs = stat_get(
+		    session, WT_STAT_CONN_LOG_SLOT_COMBINE_WAIT_DURATION);
+
+		__wt_epoch(NULL, &ts);
+		for (i = 0; i < nthreads; ++i) {
+			args[i].opts = opts;
+			args[i].id = i;
+			testutil_check(pthread_create(
+			    &id[i], NULL, thread_commit, &args[i]));
+		}
+		for (i = 0; i < nthreads; ++i)
+			testutil_check(pthread_join(id[i], NULL));
+		__wt_epoch(NULL, &te);
+
+		retries = stat_get(
+		    session, WT_STAT_CONN_LOG_SLOT_JOIN_RETRIES) - retries;
+		yield_usecs = stat_get(session,
+		    WT_STAT_CONN_LOG_SLOT_YIELD_DURATION) - yield_usecs;
+		combine_usecs = stat_get(session,
+		    WT_STAT_CONN_LOG_SLOT_COMBINE_WAIT_DURATION) -
+		    combine_usecs;
+		commits = nthreads * opts->nops;
+		secs = WT_TIMEDIFF_MS(te, ts) / 1000.0;
+		printf("join_groups %2u, %3" PRIu64 " threads: "
+		    "%9.0f commits/sec, %6.3f join retries/commit, "
+		    "%8.3f join wait usecs/commit\n",
+		    join_groups, nthreads, commits / WT_MAX(secs, 0.001),
+		    (double)retries / commits,
+		    (double)(yield_usecs + combine_usecs) / commits);
+
+		if (nthreads == opts->nthreads)
+			break;
+	}
+
+	testutil_check(opts->conn->close(opts->conn, NULL));
+	opts->conn = NULL;
+}
+
+/*
+ * stat_get --
+ *	Return a connection statistic.
+ */
+static int64_t
+stat_get(WT_SESSION *session, int key)
+{
+	WT_CURSOR *cursor;
+	int64_t value;
+	const char *desc, *pvalue;
+
+	testutil_check(session->open_cursor(
+	    session, "statistics:", NULL, NULL, &cursor));
+	cursor->set_key(cursor, key);
+	testutil_check(cursor->search(cursor));
+	testutil_check(cursor->get_value(cursor, &desc, &pvalue, &value));
+	testutil_check(cursor->close(cursor));
+	return (value);
+}
+
+/*
+ * thread_commit --
+ *	Commit single-update transactions, each writing a log record.
+ */
+static void *
+thread_commit(void *arg)
+{
+	THREAD_ARGS *args;
+	TEST_OPTS *opts;
+	WT_CURSOR *cursor;
+	WT_SESSION *session;
+	uint64_t i;
+
+	args = (THREAD_ARGS *)arg;
+	opts = args->opts;
+	testutil_check(
+	    opts->conn->open_session(opts->conn, NULL, NULL, &session));
+	testutil_check(
+	    session->open_cursor(session, opts->uri, NULL, NULL, &cursor));
+
+	for (i = 0; i < opts->nops; ++i) {
+		testutil_check(session->begin_transaction(session, NULL));
+		cursor->set_key(cursor, args->id << 32 | i);
+		cursor->set_value(cursor, "value");
+		testutil_check(cursor->insert(cursor));
+		testutil_check(session->commit_transaction(session, NULL));
+	}
+
+	testutil_check(session->close(session, NULL));
+	return (NULL);
+}
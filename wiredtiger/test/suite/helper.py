@@ -27,7 +27,7 @@
 # OTHER DEALINGS IN THE SOFTWARE.
 #
 
-import glob, os, shutil, string, subprocess
+import glob, os, shutil, string, struct, subprocess
 import wiredtiger
 
 from wtdataset import SimpleDataSet, SimpleIndexDataSet, ComplexDataSet
@@ -123,3 +123,13 @@ def copy_wiredtiger_home(olddir, newdir, aligned=True):
                 cmd_list = ['dd', inpf, outf, 'bs=300']
                 a = subprocess.Popen(cmd_list)
                 a.wait()
+
+# return the version and flags in the header of a WT home's newest log file
+def log_file_header(home):
+    logs = sorted(f for f in os.listdir(home)
+        if f.startswith('WiredTigerLog.'))
+    with open(os.path.join(home, logs[-1]), 'rb') as f:
+        # Skip the log record header to the log file description.
+        f.seek(16)
+        magic, version, flags = struct.unpack('<IHH', f.read(8))
+    return version, flags
@@ -0,0 +1,117 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_alloc01.py
+#   Test the block allocation algorithms reuse freed space.
+#
+
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+class test_alloc01(wttest.WiredTigerTestCase):
+    conn_config = 'statistics=(fast)'
+    uri = 'file:test_alloc01'
+    nentries = 2000
+
+    alloc = [
+        ('best', dict(alloc='best')),
+        ('first', dict(alloc='first')),
+        ('size_class', dict(alloc='size_class')),
+    ]
+    scenarios = make_scenarios(alloc)
+
+    # Values of varying sizes, changing with each generation, some of them
+    # overflow items.
+    def value(self, i, gen):
+        return str(gen) * (1 + (i * 37 + gen * 101) % 700 +
+            (30000 if i % 50 == 0 else 0))
+
+    def load(self, gen, remove=False):
+        cursor = self.session.open_cursor(self.uri, None)
+        for i in range(1, self.nentries):
+            cursor.set_key('%08d' % i)
+            if remove and i % 3 == 0:
+                cursor.remove()
+            else:
+                cursor.set_value(self.value(i, gen))
+                cursor.insert()
+        cursor.close()
+        self.session.checkpoint()
+
+    def check(self, gen):
+        cursor = self.session.open_cursor(self.uri, None)
+        for i in range(1, self.nentries):
+            cursor.set_key('%08d' % i)
+            if i % 3 == 0:
+                self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+            else:
+                self.assertEqual(cursor.search(), 0)
+                self.assertEqual(cursor.get_value(), self.value(i, gen))
+        cursor.close()
+
+    # Rewrite the table repeatedly across checkpoints and reopens, the
+    # blocks freed by each checkpoint are allocated by the next: the file
+    # stops growing rather than growing by each rewrite.
+    def test_alloc(self):
+        self.session.create(self.uri,
+            'key_format=S,value_format=S,allocation_size=512,' +
+            'leaf_page_max=8KB,block_allocation=' + self.alloc)
+        self.load(0)
+        size = self.get_stat(stat.dsrc.block_size, self.uri)
+        for gen in range(1, 6):
+            self.load(gen, True)
+            if gen % 2 == 0:
+                self.reopen_conn()
+            self.check(gen)
+            self.assertLess(
+                self.get_stat(stat.dsrc.block_size, self.uri), size * 2)
+        self.session.verify(self.uri)
+
+        # With most of the table removed, compaction finds the free space
+        # at the start of the file and moves blocks there.
+        cursor = self.session.open_cursor(self.uri, None)
+        for i in range(200, self.nentries):
+            cursor.set_key('%08d' % i)
+            cursor.remove()
+        cursor.close()
+        self.session.checkpoint()
+        size = self.get_stat(stat.dsrc.block_size, self.uri)
+        self.session.compact(self.uri)
+        self.assertLess(
+            self.get_stat(stat.dsrc.block_size, self.uri), size * 3 // 4)
+        self.session.verify(self.uri)
+
+    def test_alloc_invalid(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.create(self.uri,
+            'key_format=S,value_format=S,block_allocation=none'),
+            '/permitted choice/')
+
+if __name__ == '__main__':
+    wttest.run()
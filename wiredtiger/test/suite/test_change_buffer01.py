@@ -0,0 +1,141 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from wtdataset import SimpleDataSet
+from wtscenario import make_scenarios
+from wiredtiger import stat
+
+# test_change_buffer01.py
+#       Blind writes to leaf pages that aren't in the cache are buffered and
+# merged into the pages when they're read or the object is checkpointed.
+class test_change_buffer01(wttest.WiredTigerTestCase):
+    uri = 'file:change_buffer01'
+    nentries = 10000
+    conn_config = 'statistics=(fast)'
+    scenarios = make_scenarios([
+        ('checkpoint', dict(merge='checkpoint')),
+        ('read', dict(merge='read')),
+        ('reopen', dict(merge='reopen')),
+    ])
+
+    def check(self, ds, removed, updated):
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(1, self.nentries + 1):
+            c.set_key(ds.key(i))
+            if i in removed:
+                self.assertEqual(c.search(), wiredtiger.WT_NOTFOUND)
+            else:
+                self.assertEqual(c.search(), 0)
+                if i in updated:
+                    self.assertEqual(c.get_value(), 'updated' + str(i))
+                else:
+                    self.assertEqual(c.get_value(), ds.value(i))
+        c.close()
+
+    def test_change_buffer(self):
+        ds = SimpleDataSet(self, self.uri, self.nentries,
+            config='change_buffer_max=1MB,leaf_page_max=4KB', key_format='S')
+        ds.populate()
+        self.reopen_conn()
+
+        # Overwrite every fifth key and remove every seventh, with the leaf
+        # pages on disk the writes are buffered.
+        c = self.session.open_cursor(self.uri, None)
+        updated = set(range(5, self.nentries + 1, 5))
+        removed = set(range(7, self.nentries + 1, 7))
+        for i in sorted(updated):
+            c[ds.key(i)] = 'updated' + str(i)
+        for i in sorted(removed):
+            c.set_key(ds.key(i))
+            self.assertEqual(c.remove(), 0)
+        c.close()
+        updated -= removed
+        self.assertGreater(
+            self.get_stat(stat.dsrc.cache_change_buffer_write, self.uri), 0)
+
+        # Merge the buffered writes into the pages.
+        if self.merge == 'checkpoint':
+            self.session.checkpoint()
+            self.assertEqual(
+                self.get_stat(
+                stat.dsrc.cache_change_buffer_bytes, self.uri), 0)
+        elif self.merge == 'reopen':
+            self.reopen_conn()
+        self.check(ds, removed, updated)
+        if self.merge != 'reopen':
+            self.assertGreater(
+                self.get_stat(
+                stat.dsrc.cache_change_buffer_merge, self.uri), 0)
+
+        # The merged pages are written by the next checkpoint.
+        self.reopen_conn()
+        self.check(ds, removed, updated)
+        self.session.verify(self.uri)
+
+    # Buffered writes are charged to the cache, the same as writes to pages
+    # in the cache.
+    def test_change_buffer_cache_size(self):
+        ds = SimpleDataSet(self, self.uri, self.nentries,
+            config='change_buffer_max=1MB,leaf_page_max=4KB', key_format='S')
+        ds.populate()
+        self.reopen_conn()
+
+        # The first write reads the internal pages.
+        c = self.session.open_cursor(self.uri, None)
+        c[ds.key(1)] = 'updated'
+        inuse = self.get_stat(stat.dsrc.cache_bytes_inuse, self.uri)
+        buffered = self.get_stat(stat.dsrc.cache_change_buffer_bytes, self.uri)
+        for i in range(2, self.nentries + 1, 3):
+            c[ds.key(i)] = 'updated' + str(i)
+        c.close()
+
+        buffered = self.get_stat(
+            stat.dsrc.cache_change_buffer_bytes, self.uri) - buffered
+        self.assertGreater(buffered, 0)
+        self.assertGreaterEqual(self.get_stat(
+            stat.dsrc.cache_bytes_inuse, self.uri) - inuse, buffered)
+
+    # Writes that aren't blind read the page.
+    def test_change_buffer_no_overwrite(self):
+        ds = SimpleDataSet(self, self.uri, self.nentries,
+            config='change_buffer_max=1MB,leaf_page_max=4KB', key_format='S')
+        ds.populate()
+        self.reopen_conn()
+
+        c = self.session.open_cursor(self.uri, None, 'overwrite=false')
+        c[ds.key(self.nentries + 1)] = ds.value(self.nentries + 1)
+        c.set_key(ds.key(1))
+        self.assertEqual(c.remove(), 0)
+        c.close()
+        self.assertEqual(
+            self.get_stat(stat.dsrc.cache_change_buffer_write, self.uri), 0)
+
+if __name__ == '__main__':
+    wttest.run()
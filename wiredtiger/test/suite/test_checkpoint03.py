@@ -0,0 +1,101 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wtdataset import SimpleDataSet
+from wtscenario import make_scenarios
+from wiredtiger import stat
+
+# test_checkpoint03.py
+#   Checkpoints with objects written in parallel by checkpoint worker threads.
+class test_checkpoint03(wttest.WiredTigerTestCase):
+    nobjects = 20
+    nentries = 1000
+    scenarios = make_scenarios([
+        ('threads-1', dict(threads=1)),
+        ('threads-4', dict(threads=4)),
+        ('threads-20', dict(threads=20)),
+    ])
+
+    def conn_config(self):
+        return 'statistics=(fast),checkpoint=(threads=%d)' % self.threads
+
+    def update(self, datasets, value):
+        for ds in datasets:
+            c = self.session.open_cursor(ds.uri, None)
+            for i in range(1, self.nentries + 1):
+                c[ds.key(i)] = value + str(i)
+            c.close()
+
+    def check(self, datasets, value, ckpt):
+        for ds in datasets:
+            c = self.session.open_cursor(ds.uri, None, 'checkpoint=' + ckpt)
+            for i in range(1, self.nentries + 1):
+                self.assertEqual(c[ds.key(i)], value + str(i))
+            c.close()
+
+    def test_checkpoint03(self):
+        datasets = []
+        for n in range(self.nobjects):
+            ds = SimpleDataSet(self, 'table:checkpoint03.' + str(n),
+                self.nentries, key_format='S')
+            ds.populate()
+            datasets.append(ds)
+
+        # Named and internal checkpoints see the data as of the checkpoint.
+        self.update(datasets, 'first')
+        self.session.checkpoint('name=ckpt1')
+        self.update(datasets, 'second')
+        self.session.checkpoint()
+        self.update(datasets, 'third')
+        self.check(datasets, 'first', 'ckpt1')
+        self.check(datasets, 'second', 'WiredTigerCheckpoint')
+
+        trees = self.get_stat(stat.conn.txn_checkpoint_thread_trees)
+        synced = self.get_stat(stat.conn.txn_checkpoint_fsync_parallel)
+        if self.threads == 1:
+            self.assertEqual(trees, 0)
+            self.assertEqual(synced, 0)
+        else:
+            self.assertGreater(trees, 0)
+            self.assertGreater(synced, 0)
+            self.assertGreater(
+                self.get_stat(stat.conn.txn_checkpoint_thread_bytes_max), 0)
+
+        # The threads can be reconfigured.
+        self.conn.reconfigure('checkpoint=(threads=2)')
+        self.session.checkpoint()
+        self.check(datasets, 'third', 'WiredTigerCheckpoint')
+
+        self.reopen_conn()
+        self.check(datasets, 'third', 'WiredTigerCheckpoint')
+        for ds in datasets:
+            self.session.verify(ds.uri)
+
+if __name__ == '__main__':
+    wttest.run()
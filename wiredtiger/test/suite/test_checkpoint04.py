@@ -0,0 +1,100 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wtdataset import SimpleDataSet
+from wtscenario import make_scenarios
+from wiredtiger import stat
+
+# test_checkpoint04.py
+#   Checkpoints of a single large object, with the object's leaf pages written
+# in parallel by checkpoint worker threads.
+class test_checkpoint04(wttest.WiredTigerTestCase):
+    nentries = 50000
+    scenarios = make_scenarios([
+        ('threads-1', dict(threads=1)),
+        ('threads-4', dict(threads=4)),
+    ])
+
+    def conn_config(self):
+        return 'cache_size=200MB,statistics=(fast),' + \
+            'checkpoint=(threads=%d)' % self.threads
+
+    def update(self, session, ds, value, skip=1):
+        c = session.open_cursor(ds.uri, None)
+        for i in range(skip, self.nentries + 1, skip):
+            c[ds.key(i)] = value + str(i)
+        c.close()
+
+    # Check every key against the expected value, using a checkpoint cursor
+    # if a checkpoint is named.
+    def check(self, ds, expect, ckpt=None):
+        cfg = None if ckpt == None else 'checkpoint=' + ckpt
+        c = self.session.open_cursor(ds.uri, None, cfg)
+        for i in range(1, self.nentries + 1):
+            self.assertEqual(c[ds.key(i)], expect(i))
+        c.close()
+
+    def test_checkpoint04(self):
+        ds = SimpleDataSet(self, 'table:checkpoint04', self.nentries,
+            key_format='S', config='leaf_page_max=4KB')
+        ds.populate()
+        self.update(self.session, ds, 'first')
+        self.session.checkpoint()
+
+        # Dirty a few keys on most leaf pages, leaving other pages clean, and
+        # leave a transaction with updates to other keys running during the
+        # checkpoint: the checkpoint writes the committed updates and skips
+        # the running transaction's updates, whichever thread writes a page.
+        self.update(self.session, ds, 'second', 97)
+        session2 = self.conn.open_session()
+        session2.begin_transaction()
+        self.update(session2, ds, 'running', 89)
+        self.session.checkpoint()
+        session2.commit_transaction()
+        session2.close()
+
+        def committed(i):
+            return ('second' if i % 97 == 0 else 'first') + str(i)
+        def latest(i):
+            return 'running' + str(i) if i % 89 == 0 else committed(i)
+        self.check(ds, committed, 'WiredTigerCheckpoint')
+        if self.threads > 1:
+            self.assertGreater(
+                self.get_stat(stat.conn.txn_checkpoint_leaf_parallel), 0)
+
+        # The pages with the transaction's updates are still dirty, the next
+        # checkpoint writes them.
+        self.session.checkpoint()
+        self.check(ds, latest, 'WiredTigerCheckpoint')
+        self.reopen_conn()
+        self.check(ds, latest)
+        self.session.verify(ds.uri)
+
+if __name__ == '__main__':
+    wttest.run()
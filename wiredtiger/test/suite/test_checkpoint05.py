@@ -0,0 +1,102 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+import time
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_checkpoint05.py
+#    Checkpoint: the checkpoint server paces dirty leaf page writes between
+#    checkpoints, leaving the checkpoint only what was dirtied recently.
+class test_checkpoint05(wttest.WiredTigerTestCase):
+    uri = 'table:test_checkpoint05'
+    nentries = 20000
+    value = 'abcdefghij' * 50
+
+    scenarios = make_scenarios([
+        ('pace', dict(pace='true')),
+        ('nopace', dict(pace='false')),
+    ])
+
+    # A cache large enough that eviction doesn't write the dirty pages, and
+    # a checkpoint interval long enough that the server's checkpoint doesn't
+    # run during the test.
+    def conn_config(self):
+        return 'cache_size=1GB,checkpoint=(pace=%s,wait=60),' \
+            'statistics=(all)' % self.pace
+
+    def test_checkpoint_pace(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri, None)
+        for k in range(self.nentries):
+            cursor[k] = self.value + str(k)
+        cursor.close()
+        dirty = self.get_stat(stat.conn.cache_bytes_dirty)
+
+        # With pacing, the checkpoint server writes the dirty pages out over
+        # the following slices without waiting for the checkpoint.
+        # Otherwise they stay dirty until the checkpoint.
+        for i in range(10):
+            time.sleep(0.5)
+            if self.get_stat(stat.conn.cache_bytes_dirty) < dirty / 10:
+                break
+        self.assertEqual(self.get_stat(stat.conn.txn_checkpoint), 0)
+        remaining = self.get_stat(stat.conn.cache_bytes_dirty)
+        paced = self.get_stat(stat.conn.txn_checkpoint_pace_pages)
+        if self.pace == 'true':
+            self.assertLess(remaining, dirty / 10)
+            self.assertGreater(paced, 0)
+            self.assertGreater(
+                self.get_stat(stat.conn.txn_checkpoint_pace_bytes), 0)
+        else:
+            self.assertGreater(remaining, dirty / 2)
+            self.assertEqual(paced, 0)
+
+        # The checkpoint has only what's still dirty left to write.
+        written = self.get_stat(stat.conn.cache_write)
+        self.session.checkpoint()
+        ckpt_written = self.get_stat(stat.conn.cache_write) - written
+        if self.pace == 'true':
+            self.assertLess(ckpt_written * 10, written)
+        else:
+            self.assertEqual(written, 0)
+            self.assertGreater(ckpt_written, 0)
+
+        # The paced writes don't change what's in the database.
+        self.reopen_conn()
+        cursor = self.session.open_cursor(self.uri, None)
+        n = 0
+        for k, v in cursor:
+            self.assertEqual(v, self.value + str(k))
+            n += 1
+        self.assertEqual(n, self.nentries)
+        cursor.close()
+        self.session.verify(self.uri, None)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,131 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_checkpoint06.py
+#    Checkpoint: checkpoints skip subtrees of the tree with no pages dirtied
+#    since the last checkpoint.
+class test_checkpoint06(wttest.WiredTigerTestCase):
+    conn_config = 'statistics=(all)'
+    uri = 'table:test_checkpoint06'
+    nentries = 100000
+
+    def update(self, keys, value):
+        cursor = self.session.open_cursor(self.uri, None)
+        for k in keys:
+            cursor[k] = value + str(k)
+            self.expected[k] = value + str(k)
+        cursor.close()
+
+    # The last checkpoint has exactly the expected contents.
+    def check_checkpoint(self):
+        cursor = self.session.open_cursor(
+            self.uri, None, 'checkpoint=WiredTigerCheckpoint')
+        n = 0
+        for k, v in cursor:
+            self.assertEqual(v, self.expected[k])
+            n += 1
+        self.assertEqual(n, len(self.expected))
+        cursor.close()
+
+    def checkpoint(self):
+        visited = self.get_stat(stat.conn.txn_checkpoint_walk_pages)
+        skipped = self.get_stat(stat.conn.txn_checkpoint_walk_skipped)
+        self.session.checkpoint()
+        self.check_checkpoint()
+        return self.get_stat(stat.conn.txn_checkpoint_walk_pages) - \
+            visited, self.get_stat(stat.conn.txn_checkpoint_walk_skipped) - \
+            skipped
+
+    def test_checkpoint_skip_clean(self):
+        self.expected = {}
+        self.session.create(self.uri, 'key_format=i,value_format=S,' +
+            'allocation_size=512,internal_page_max=512,leaf_page_max=512')
+        self.update(range(self.nentries), 'abcdefghij')
+
+        # Reopen and read the tree into cache so it has internal pages below
+        # the root.
+        self.reopen_conn()
+        cursor = self.session.open_cursor(self.uri, None)
+        for k, v in cursor:
+            pass
+        cursor.close()
+
+        # Dirty the start of the tree and checkpoint twice: the second
+        # checkpoint skips the subtrees only the first one had to visit.
+        self.update(range(100), 'first')
+        visited, skipped = self.checkpoint()
+        self.update(range(100), 'second')
+        visited2, skipped2 = self.checkpoint()
+        self.assertGreater(skipped2, 0)
+        self.assertLess(visited2, visited)
+
+        # A page the checkpoint can't write clean, because of a running
+        # transaction's update, is visited by the next checkpoint even
+        # though nothing below it changes in between.
+        session2 = self.conn.open_session()
+        session2.begin_transaction()
+        cursor2 = session2.open_cursor(self.uri, None)
+        cursor2[self.nentries // 2] = 'running'
+        self.update(range(self.nentries - 100, self.nentries), 'third')
+        self.checkpoint()
+        session2.commit_transaction()
+        session2.close()
+        self.expected[self.nentries // 2] = 'running'
+        visited, skipped = self.checkpoint()
+        self.assertGreater(skipped, 0)
+
+        # Pages deleted by a truncate are checkpointed, and the rest of
+        # the tree is still skipped.
+        start = self.session.open_cursor(self.uri, None)
+        start.set_key(30000)
+        stop = self.session.open_cursor(self.uri, None)
+        stop.set_key(30999)
+        self.session.truncate(None, start, stop, None)
+        start.close()
+        stop.close()
+        for k in range(30000, 31000):
+            del self.expected[k]
+        visited, skipped = self.checkpoint()
+        self.assertGreater(skipped, 0)
+
+        # Skipped subtrees don't lose updates.
+        self.reopen_conn()
+        cursor = self.session.open_cursor(self.uri, None)
+        n = 0
+        for k, v in cursor:
+            self.assertEqual(v, self.expected[k])
+            n += 1
+        self.assertEqual(n, len(self.expected))
+        cursor.close()
+        self.session.verify(self.uri, None)
+
+if __name__ == '__main__':
+    wttest.run()
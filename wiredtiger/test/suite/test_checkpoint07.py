@@ -0,0 +1,132 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import os, shutil
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_checkpoint07.py
+#    Checkpoint: avail extent lists written as changes to a base list are
+#    read back after a restart.
+class test_checkpoint07(wttest.WiredTigerTestCase):
+    conn_config = 'statistics=(all)'
+    uri = 'file:test_checkpoint07'
+    nentries = 40000
+
+    def rewritten(self, k):
+        return (k / 32) % 2 == 0
+
+    def update(self, keys, value):
+        cursor = self.session.open_cursor(self.uri, None)
+        for k in keys:
+            cursor[k] = value + str(k)
+        cursor.close()
+
+    def check(self, updated, value):
+        cursor = self.session.open_cursor(self.uri, None)
+        for k in range(self.nentries):
+            if k in updated:
+                self.assertEqual(cursor[k], value + str(k))
+            elif self.rewritten(k):
+                self.assertEqual(cursor[k], 'ABCDEFGHIJ' + str(k))
+            else:
+                self.assertEqual(cursor[k], 'abcdefghij' + str(k))
+        cursor.close()
+
+    def fragment(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S,' +
+            'allocation_size=512,leaf_page_max=512,block_avail_delta=true')
+        self.update(range(self.nentries), 'abcdefghij')
+        self.session.checkpoint()
+
+        # Reopen so pages are read from disk individually, then rewrite every
+        # other run of pages to leave a fragmented file with a long avail
+        # list.
+        self.reopen_conn()
+        self.update([k for k in range(self.nentries) if self.rewritten(k)],
+            'ABCDEFGHIJ')
+        self.session.checkpoint()
+        self.session.checkpoint()
+
+    def test_checkpoint_avail_delta(self):
+        self.fragment()
+
+        # Checkpoints updating a few pages write the avail list as changes.
+        updated = range(0, self.nentries, 1999)
+        for i in range(5):
+            self.update(updated, 'update' + str(i))
+            if i == 2:
+                self.session.checkpoint('name=ckpt07')
+            else:
+                self.session.checkpoint()
+        self.assertGreater(
+            self.get_stat(stat.dsrc.block_avail_delta, self.uri), 0)
+
+        # Restart from the changes, then drop the named checkpoint and keep
+        # going.
+        self.reopen_conn()
+        self.check(updated, 'update4')
+        self.session.checkpoint('drop=(ckpt07)')
+        for i in range(5, 8):
+            self.update(updated, 'update' + str(i))
+            self.session.checkpoint()
+        self.reopen_conn()
+        self.check(updated, 'update7')
+        self.session.verify(self.uri)
+
+    # Checkpoints during a hot backup, that would otherwise replace the base
+    # list, keep the base list referenced by the checkpoint being copied.
+    def test_checkpoint_avail_delta_backup(self):
+        self.fragment()
+        updated = range(0, self.nentries, 1999)
+        self.update(updated, 'update')
+        self.session.checkpoint()
+
+        # Rewrite a lot of pages between starting the backup and copying the
+        # files, so blocks freed by the checkpoints are reused.
+        deltas = self.get_stat(stat.dsrc.block_avail_delta, self.uri)
+        bkp_cursor = self.session.open_cursor('backup:', None, None)
+        for i in range(6):
+            self.update(range(i, self.nentries, 3), 'churn' + str(i))
+            self.session.checkpoint()
+        self.assertGreater(
+            self.get_stat(stat.dsrc.block_avail_delta, self.uri), deltas)
+        os.mkdir('BACKUP')
+        while bkp_cursor.next() == 0:
+            shutil.copy(bkp_cursor.get_key(), 'BACKUP')
+        bkp_cursor.close()
+
+        # The backup restores the checkpoint at the start of the backup.
+        self.reopen_conn('BACKUP')
+        self.check(updated, 'update')
+        self.update(updated, 'restored')
+        self.session.checkpoint()
+        self.session.verify(self.uri)
+
+if __name__ == '__main__':
+    wttest.run()
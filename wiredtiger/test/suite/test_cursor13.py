@@ -0,0 +1,126 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import time
+import wiredtiger, wttest
+
+# test_cursor13.py
+#    Log cursors: only return the operations on the configured targets,
+#    return batches of operations and wait at the end of the log.
+class test_cursor13(wttest.WiredTigerTestCase):
+    conn_config = 'log=(enabled)'
+    uri1 = 'table:test_cursor13_1'
+    uri2 = 'table:test_cursor13_2'
+    nentries = 100
+
+    def populate(self):
+        for uri in (self.uri1, self.uri2):
+            self.session.create(uri, 'key_format=i,value_format=S')
+        c1 = self.session.open_cursor(self.uri1, None)
+        c2 = self.session.open_cursor(self.uri2, None)
+        for i in range(self.nentries):
+            self.session.begin_transaction()
+            c1[i] = 'one' + str(i)
+            c2[i] = 'two' + str(i)
+            self.session.commit_transaction()
+        self.session.log_printf('test_cursor13')
+        c1.close()
+        c2.close()
+
+    def check_ops(self, ops):
+        self.assertEqual(len(ops), self.nentries)
+        fileid = ops[0][1][3]
+        for i, (key, value) in enumerate(ops):
+            self.assertGreater(key[2], 0)
+            self.assertEqual(value[3], fileid)
+            self.assertEqual(value[5], 'one' + str(i) + '\x00')
+
+    def test_log_target(self):
+        self.populate()
+        c = self.session.open_cursor(
+            'log:', None, 'target=("%s")' % self.uri1)
+        ops = []
+        while c.next() == 0:
+            ops.append((c.get_key(), c.get_value()))
+        c.close()
+        self.check_ops(ops)
+
+        msg = '/log cursor targets must be/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor(
+            'log:', None, 'target=("lsm:test_cursor13")'), msg)
+
+    def test_log_next_batch(self):
+        self.populate()
+        c = self.session.open_cursor('log:', None, None)
+        count = 0
+        while c.next() == 0:
+            count += 1
+        c.close()
+
+        # Batches return the same operations as iterating with next.
+        c = self.session.open_cursor('log:', None, None)
+        batched = 0
+        while True:
+            records = c.next_batch(7)
+            if len(records) == 0:
+                break
+            self.assertLessEqual(len(records), 7)
+            batched += len(records)
+        self.assertEqual(batched, count)
+        c.close()
+
+        c = self.session.open_cursor(
+            'log:', None, 'target=("%s")' % self.uri1)
+        ops = []
+        while True:
+            records = c.next_batch(10)
+            if len(records) == 0:
+                break
+            ops.extend(records)
+        c.close()
+        self.check_ops(ops)
+
+    def test_log_tail_wait(self):
+        self.populate()
+        c = self.session.open_cursor('log:', None, 'tail_wait=500')
+        while c.next() == 0:
+            pass
+
+        # At the end of the log, the cursor waits for new records.
+        start = time.time()
+        self.assertEqual(c.next(), wiredtiger.WT_NOTFOUND)
+        self.assertGreaterEqual(time.time() - start, 0.4)
+
+        # New records are returned once they're written.
+        self.session.log_printf('test_cursor13 tail')
+        self.assertEqual(c.next(), 0)
+        c.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,188 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_cursor_batch01.py
+#    Check the batched cursor methods: next_batch returns the same records as
+#    iterating with next, search_batch returns the same values as a search
+#    for each key, insert_batch inserts the same records as insert.
+class test_cursor_batch01(wttest.WiredTigerTestCase):
+    conn_config = 'statistics=(fast)'
+    nentries = 1000
+
+    types = [
+        ('row', dict(key_format='S')),
+        ('var', dict(key_format='r')),
+    ]
+    batch = [
+        ('1', dict(batch=1)),
+        ('7', dict(batch=7)),
+        ('100', dict(batch=100)),
+        ('all', dict(batch=5000)),
+    ]
+    scenarios = make_scenarios(types, batch)
+
+    def make_key(self, i):
+        if self.key_format == 'r':
+            return i + 1
+        return '%010d' % i
+
+    def make_value(self, i):
+        return str(i) * 3
+
+    def populate(self, uri):
+        self.session.create(uri,
+            'key_format=' + self.key_format + ',value_format=S')
+        c = self.session.open_cursor(uri, None)
+        for i in range(self.nentries):
+            c[self.make_key(i)] = self.make_value(i)
+        c.close()
+
+    def test_next_batch(self):
+        uri = 'table:test_cursor_batch01'
+        self.populate(uri)
+
+        c = self.session.open_cursor(uri, None)
+        count = 0
+        while True:
+            records = c.next_batch(self.batch)
+            if len(records) == 0:
+                break
+            self.assertLessEqual(len(records), self.batch)
+            for k, v in records:
+                self.assertEqual(k, self.make_key(count))
+                self.assertEqual(v, self.make_value(count))
+                count += 1
+            # The cursor is positioned on the last record returned.
+            self.assertEqual(c.get_key(), self.make_key(count - 1))
+        self.assertEqual(count, self.nentries)
+
+        # A batch continues from the current cursor position.
+        c.set_key(self.make_key(500))
+        self.assertEqual(c.search(), 0)
+        records = c.next_batch(self.batch)
+        self.assertEqual(records[0][0], self.make_key(501))
+
+        self.assertRaises(
+            wiredtiger.WiredTigerError, lambda: c.next_batch(0))
+        c.close()
+        self.assertGreater(self.get_stat(stat.conn.cursor_next_batch), 0)
+
+    def test_search_batch(self):
+        uri = 'table:test_cursor_batch01'
+        self.populate(uri)
+
+        # Search for existing keys, interleaved with missing keys.
+        keys = []
+        expect = []
+        for i in range(0, self.nentries + 20, 3):
+            keys.append(self.make_key(i))
+            expect.append(
+                self.make_value(i) if i < self.nentries else None)
+        c = self.session.open_cursor(uri, None)
+        for i in range(0, len(keys), self.batch):
+            self.assertEqual(c.search_batch(keys[i:i + self.batch]),
+                expect[i:i + self.batch])
+        self.assertEqual(c.search_batch([]), [])
+        c.close()
+        self.assertGreater(self.get_stat(stat.conn.cursor_search_batch), 0)
+
+    # Searching a batch of sorted, missing keys keeps each leaf page pinned:
+    # the batch visits each page once, not once per key.
+    def test_search_batch_miss(self):
+        if self.key_format == 'r':
+            self.skipTest('missing keys are only kept in range in row-stores')
+        uri = 'table:test_cursor_batch01'
+        self.session.create(uri,
+            'key_format=S,value_format=S,leaf_page_max=4k')
+        c = self.session.open_cursor(uri, None)
+        for i in range(0, self.nentries * 10, 2):
+            c[self.make_key(i)] = self.make_value(i)
+        c.close()
+        self.session.checkpoint()
+        self.reopen_conn()
+
+        keys = [self.make_key(i) for i in range(1, self.nentries * 10, 2)]
+        c = self.session.open_cursor(uri, None)
+        before = self.get_stat(stat.dsrc.cache_pages_requested, uri)
+        for i in range(0, len(keys), self.batch):
+            self.assertEqual(c.search_batch(keys[i:i + self.batch]),
+                [None] * len(keys[i:i + self.batch]))
+        requested = \
+            self.get_stat(stat.dsrc.cache_pages_requested, uri) - before
+        c.close()
+        if self.batch >= 100:
+            self.assertLess(requested, len(keys) / 4)
+
+    def test_insert_batch(self):
+        uri = 'table:test_cursor_batch01'
+        self.session.create(uri,
+            'key_format=' + self.key_format + ',value_format=S')
+
+        # Insert even keys one at a time, then the odd keys in sorted batches.
+        c = self.session.open_cursor(uri, None)
+        for i in range(0, self.nentries, 2):
+            c[self.make_key(i)] = self.make_value(i)
+        odd = [(self.make_key(i), self.make_value(i))
+            for i in range(1, self.nentries, 2)]
+        for i in range(0, len(odd), self.batch):
+            c.insert_batch(odd[i:i + self.batch])
+
+        count = 0
+        for k, v in c:
+            self.assertEqual(k, self.make_key(count))
+            self.assertEqual(v, self.make_value(count))
+            count += 1
+        self.assertEqual(count, self.nentries)
+        c.close()
+        self.assertGreater(self.get_stat(stat.conn.cursor_insert_batch), 0)
+
+        # Without overwrite, existing keys fail the batch.
+        c = self.session.open_cursor(uri, None, 'overwrite=false')
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: c.insert_batch([(self.make_key(10), 'new value')]))
+        self.assertEqual(c[self.make_key(10)], self.make_value(10))
+        c.close()
+
+# Cursors other than btree cursors don't support batches.
+class test_cursor_batch02(wttest.WiredTigerTestCase):
+    def test_cursor_batch_notsup(self):
+        c = self.session.open_cursor('metadata:', None)
+        msg = '/Operation not supported/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: c.next_batch(10), msg)
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: c.search_batch(['table:']), msg)
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: c.insert_batch([('table:', '')]), msg)
+        c.close()
+
+if __name__ == '__main__':
+    wttest.run()
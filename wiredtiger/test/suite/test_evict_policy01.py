@@ -0,0 +1,99 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import random
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_evict_policy01.py
+#    Check the scan-resistant eviction policy: a working set referenced
+#    repeatedly stays in the cache while tables larger than the cache are
+#    scanned, and reads return the right data throughout.
+class test_evict_policy01(wttest.WiredTigerTestCase):
+    uri = 'table:test_evict_policy01'
+    conn_base = 'cache_size=10MB,statistics=(fast),'
+    nentries = 200000
+    value = 'v' * 200
+
+    # Alternate point reads of a small hot set with full scans of a table
+    # several times larger than the cache, and return the number of pages
+    # read back in by the point reads after the first scan.
+    def hot_reads(self, policy):
+        self.conn_config = self.conn_base + 'eviction=(policy=%s)' % policy
+        self.reopen_conn()
+        uri = self.uri + '_' + policy
+        self.session.create(uri,
+            'key_format=i,value_format=S,leaf_page_max=16k')
+        c = self.session.open_cursor(uri, None)
+        for i in range(self.nentries):
+            c[i] = self.value
+        c.close()
+        self.session.checkpoint()
+
+        r = random.Random(1)
+        reads = 0
+        c = self.session.open_cursor(uri, None)
+        for i in range(4):
+            before = self.get_stat(stat.conn.cache_read)
+            for j in range(20000):
+                k = r.randrange(self.nentries // 20)
+                c.set_key(k)
+                self.assertEqual(c.search(), 0)
+                self.assertEqual(c.get_value(), self.value)
+            if i > 0:
+                reads += self.get_stat(stat.conn.cache_read) - before
+            c.reset()
+            count = 0
+            for k, v in c:
+                self.assertEqual(k, count)
+                count += 1
+            self.assertEqual(count, self.nentries)
+        c.close()
+        return reads
+
+    def test_evict_policy(self):
+        lru = self.hot_reads('lru')
+        scan_resistant = self.hot_reads('scan_resistant')
+        self.assertGreater(
+            self.get_stat(stat.conn.cache_eviction_policy_promote), 0)
+
+        # The scans push the hot set out of the cache with LRU eviction, the
+        # scan-resistant policy keeps most of it.
+        self.pr('hot pages read: lru %d, scan_resistant %d' %
+            (lru, scan_resistant))
+        self.assertGreater(lru, 0)
+        self.assertLess(scan_resistant * 2, lru)
+
+        # Switching back to LRU is allowed at any time.
+        self.conn.reconfigure('eviction=(policy=lru)')
+        c = self.session.open_cursor(self.uri + '_scan_resistant', None)
+        self.assertEqual(sum(1 for k, v in c), self.nentries)
+        c.close()
+
+if __name__ == '__main__':
+    wttest.run()
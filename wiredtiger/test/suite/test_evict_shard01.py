@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import os
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_evict_shard01.py
+#    Check eviction with the candidate queues split into shards: pages are
+#    evicted from every configuration and reads return the right data.
+class test_evict_shard01(wttest.WiredTigerTestCase):
+    uri = 'table:test_evict_shard01'
+    nentries = 100000
+    value = 'v' * 200
+
+    shards = [
+        ('default', dict(shard_config='')),
+        ('shards-4', dict(shard_config='eviction_queues=(shards=4)')),
+        ('shards-4-numa',
+            dict(shard_config='eviction_queues=(numa=true,shards=4)')),
+        ('shards-64', dict(shard_config='eviction_queues=(shards=64)')),
+    ]
+    scenarios = make_scenarios(shards)
+
+    def conn_config(self):
+        return 'cache_size=5MB,statistics=(fast),' + \
+            'eviction=(threads_min=4,threads_max=4),' + self.shard_config
+
+    def test_evict_shard(self):
+        self.session.create(self.uri,
+            'key_format=i,value_format=S,leaf_page_max=16k')
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(self.nentries):
+            c[i] = self.value
+        c.close()
+        self.session.checkpoint()
+
+        # Read the table back twice, it is several times larger than the
+        # cache.
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(2):
+            count = 0
+            for k, v in c:
+                self.assertEqual(k, count)
+                self.assertEqual(v, self.value)
+                count += 1
+            self.assertEqual(count, self.nentries)
+        c.close()
+
+        self.assertGreater(self.get_stat(stat.conn.cache_eviction_clean), 0)
+        self.assertGreater(self.get_stat(stat.conn.lock_evict_queue_count), 0)
+
+class test_evict_shard02(wttest.WiredTigerTestCase):
+    # The number of shards is checked when the connection is opened.
+    def test_evict_shard_config(self):
+        os.mkdir('shard')
+        for config in ('shards=0', 'shards=65'):
+            self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+                lambda: self.wiredtiger_open('shard',
+                'create,eviction_queues=(' + config + ')'),
+                '/Value too (small|large)/')
+
+if __name__ == '__main__':
+    wttest.run()
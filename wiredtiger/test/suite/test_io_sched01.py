@@ -0,0 +1,96 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_io_sched01.py
+#    Check the block manager I/O scheduler: application reads and checkpoint
+#    writes are counted separately, and checkpoint writes are rate limited.
+class test_io_sched01(wttest.WiredTigerTestCase):
+    rate = 1024 * 1024
+    conn_config = 'statistics=(fast),' + \
+        'io_scheduler=(checkpoint_rate=1MB,read_priority=true)'
+    uri = 'table:test_io_sched01'
+    nentries = 2000
+    value = 'abcdefghij' * 100
+
+    def test_io_sched(self):
+        self.session.create(self.uri,
+            'key_format=i,value_format=S,block_compressor=')
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(self.nentries):
+            c[i] = self.value
+        c.close()
+
+        # Around 2MB of pages written at 1MB a second have to wait: apart
+        # from a burst of a tenth of a second of writes, the time spent
+        # writing is made up to the time the bytes take at that rate.  The
+        # time waited is what the writes owed, not a measurement, so it can't
+        # be more than the bytes take at that rate.  Allow for the time
+        # spent writing and reconciling the pages at the other end.
+        self.session.checkpoint()
+        written = self.get_stat(stat.conn.block_byte_write_checkpoint)
+        throttle_time = \
+            self.get_stat(stat.conn.block_sched_checkpoint_throttle_time)
+        self.assertGreater(self.get_stat(stat.conn.block_sched_checkpoint), 0)
+        self.assertGreater(
+            self.get_stat(stat.conn.block_sched_checkpoint_throttle), 0)
+        self.assertGreater(written, self.rate)
+        self.assertLessEqual(throttle_time, written * 1000000 // self.rate)
+        self.assertGreaterEqual(throttle_time * 2,
+            (written - self.rate // 10) * 1000000 // self.rate)
+
+        # Without a rate, checkpoints don't wait.
+        self.conn.reconfigure('io_scheduler=(checkpoint_rate=0)')
+        throttled = self.get_stat(stat.conn.block_sched_checkpoint_throttle)
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(self.nentries):
+            c[i] = self.value + 'x'
+        c.close()
+        self.session.checkpoint()
+        self.assertEqual(throttled,
+            self.get_stat(stat.conn.block_sched_checkpoint_throttle))
+
+        # Reads by the application after a restart are scheduled.
+        self.reopen_conn()
+        c = self.session.open_cursor(self.uri, None)
+        count = 0
+        for k, v in c:
+            self.assertEqual(v, self.value + 'x')
+            count += 1
+        c.close()
+        self.assertEqual(count, self.nentries)
+        # Only application reads are scheduled, not internal threads' reads.
+        self.assertGreater(self.get_stat(stat.conn.block_sched_read), 0)
+        self.assertLessEqual(self.get_stat(stat.conn.block_sched_read),
+            self.get_stat(stat.conn.block_read))
+        self.assertEqual(self.get_stat(stat.conn.block_sched_read_active), 0)
+
+if __name__ == '__main__':
+    wttest.run()
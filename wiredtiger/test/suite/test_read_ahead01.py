@@ -0,0 +1,116 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_read_ahead01.py
+#    Check scans with asynchronous leaf-page read-ahead: pages following the
+#    cursor are queued and read, and the scan returns the right data in both
+#    directions.
+class test_read_ahead01(wttest.WiredTigerTestCase):
+    conn_config = 'statistics=(fast),read_ahead=(pages=16,threads=2)'
+    nentries = 50000
+
+    types = [
+        ('row', dict(key_format='S')),
+        ('var', dict(key_format='r')),
+    ]
+    cursor_config = [
+        ('detect', dict(cursor_config=None)),
+        ('immediate', dict(cursor_config='read_ahead=true')),
+    ]
+    scenarios = make_scenarios(types, cursor_config)
+
+    def make_key(self, i):
+        if self.key_format == 'r':
+            return i + 1
+        return '%010d' % i
+
+    def make_value(self, i):
+        return str(i) * 10
+
+    def test_read_ahead(self):
+        uri = 'table:test_read_ahead01'
+        self.session.create(uri, 'key_format=' + self.key_format +
+            ',value_format=S,leaf_page_max=4k')
+        c = self.session.open_cursor(uri, None, 'bulk')
+        for i in range(self.nentries):
+            c[self.make_key(i)] = self.make_value(i)
+        c.close()
+
+        # Re-open the connection so the leaf pages are only on disk.
+        self.reopen_conn()
+
+        c = self.session.open_cursor(uri, None, self.cursor_config)
+        count = 0
+        while c.next() == 0:
+            self.assertEqual(c.get_key(), self.make_key(count))
+            self.assertEqual(c.get_value(), self.make_value(count))
+            count += 1
+        self.assertEqual(count, self.nentries)
+        c.close()
+        self.assertGreater(self.get_stat(stat.conn.cache_read_ahead_queued), 0)
+
+        self.reopen_conn()
+
+        c = self.session.open_cursor(uri, None, self.cursor_config)
+        while c.prev() == 0:
+            count -= 1
+            self.assertEqual(c.get_key(), self.make_key(count))
+            self.assertEqual(c.get_value(), self.make_value(count))
+        self.assertEqual(count, 0)
+        c.close()
+        self.assertGreater(self.get_stat(stat.conn.cache_read_ahead_queued), 0)
+
+# Read-ahead is disabled by default: scans don't queue any pages.
+class test_read_ahead02(wttest.WiredTigerTestCase):
+    conn_config = 'statistics=(fast)'
+    nentries = 50000
+
+    def test_read_ahead_disabled(self):
+        uri = 'table:test_read_ahead02'
+        self.session.create(uri,
+            'key_format=S,value_format=S,leaf_page_max=4k')
+        c = self.session.open_cursor(uri, None, 'bulk')
+        for i in range(self.nentries):
+            c['%010d' % i] = str(i)
+        c.close()
+        self.reopen_conn()
+
+        c = self.session.open_cursor(uri, None, 'read_ahead=true')
+        count = 0
+        while c.next() == 0:
+            count += 1
+        self.assertEqual(count, self.nentries)
+        c.close()
+
+        self.assertEqual(self.get_stat(stat.conn.cache_read_ahead_queued), 0)
+
+if __name__ == '__main__':
+    wttest.run()
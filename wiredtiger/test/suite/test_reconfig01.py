@@ -75,6 +75,10 @@ class test_reconfig01(wttest.WiredTigerTestCase):
         self.conn.reconfigure("eviction=(threads_min=2)")
         # Set min and max the same.
         self.conn.reconfigure("eviction=(threads_min=6,threads_max=6)")
+        # Switch eviction policies and back.
+        self.conn.reconfigure("eviction=(policy=scan_resistant)")
+        self.conn.reconfigure("eviction=(policy=lru)")
+        self.conn.reconfigure("eviction=(policy=scan_resistant)")
 
     def test_reconfig_lsm_manager(self):
         # We create and populate a tiny LSM so that we can start off with
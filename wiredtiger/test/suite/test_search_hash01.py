@@ -0,0 +1,91 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wtdataset import SimpleDataSet
+from wtscenario import make_scenarios
+from wiredtiger import stat
+
+# test_search_hash01.py
+#       Row-store leaf page hash indexes: exact-match searches must return the
+# same results with and without the index, including for keys inserted after
+# the index was built.
+class test_search_hash01(wttest.WiredTigerTestCase):
+    uri = 'file:search_hash01'
+    nentries = 10000
+    conn_config = 'statistics=(fast)'
+    scenarios = make_scenarios([
+        ('no-prefix', dict(config='prefix_compression=false')),
+        ('prefix', dict(config='prefix_compression=true')),
+    ], [
+        ('first', dict(searches=1)),
+        ('tenth', dict(searches=10)),
+    ])
+
+    def check(self, c, ds, notfound):
+        for i in range(1, self.nentries + 1):
+            c.set_key(ds.key(i))
+            if i in notfound:
+                self.assertEqual(c.search(), wiredtiger.WT_NOTFOUND)
+            else:
+                self.assertEqual(c.search(), 0)
+                self.assertEqual(c.get_key(), ds.key(i))
+                self.assertEqual(c.get_value(), ds.value(i))
+
+    def test_search_hash(self):
+        config = self.config + ',leaf_page_max=4KB' + \
+            ',leaf_hash_search=' + str(self.searches)
+        ds = SimpleDataSet(self, self.uri, self.nentries,
+            config=config, key_format='S')
+        ds.populate()
+
+        # Remove every seventh key, then read the file back in from disk so
+        # the keys are on the original pages, not in the insert lists.
+        c = self.session.open_cursor(self.uri, None)
+        removed = list(range(7, self.nentries + 1, 7))
+        for i in removed:
+            c.set_key(ds.key(i))
+            self.assertEqual(c.remove(), 0)
+        c.close()
+        self.reopen_conn()
+
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(0, self.searches + 1):
+            self.check(c, ds, removed)
+        self.assertGreater(
+            self.get_stat(stat.dsrc.cursor_search_hash_build, self.uri), 0)
+        self.assertGreater(
+            self.get_stat(stat.dsrc.cursor_search_hash_hit, self.uri), 0)
+
+        # Re-insert the removed keys, they're found in the insert lists.
+        for i in removed:
+            c[ds.key(i)] = ds.value(i)
+        self.check(c, ds, [])
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,110 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wtscenario import make_scenarios
+
+# test_txn19.py
+#    Transactions: snapshot visibility with each transaction_snapshot method,
+#    with running transactions spread across many sessions.
+class test_txn19(wttest.WiredTigerTestCase):
+    uri = 'table:test_txn19'
+    nsessions = 150
+
+    scenarios = make_scenarios([
+        ('active', dict(method='active')),
+        ('scan', dict(method='scan')),
+    ])
+
+    def conn_config(self):
+        return 'session_max=200,transaction_snapshot=(method=%s)' % \
+            self.method
+
+    # Return the number of records visible to a new snapshot transaction.
+    def visible_count(self):
+        s = self.conn.open_session()
+        s.begin_transaction('isolation=snapshot')
+        cursor = s.open_cursor(self.uri, None)
+        count = sum(1 for r in cursor)
+        s.rollback_transaction()
+        s.close()
+        return count
+
+    def test_snapshot_method(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+
+        # Start a reader before any of the writers.
+        reader = self.conn.open_session()
+        reader.begin_transaction('isolation=snapshot')
+        rcursor = reader.open_cursor(self.uri, None)
+
+        # Open many sessions, with idle sessions interleaved with writers so
+        # running transactions are scattered across the session table.
+        idle = []
+        writers = []
+        for i in range(self.nsessions):
+            s = self.conn.open_session()
+            if i % 3 == 0:
+                s.begin_transaction()
+                c = s.open_cursor(self.uri, None)
+                c[i] = 'value %d' % i
+                writers.append((s, c))
+            else:
+                idle.append(s)
+
+        # None of the uncommitted updates are visible.
+        self.assertEqual(self.visible_count(), 0)
+
+        # Commit the writers from the end of the table, each commit becomes
+        # visible to new snapshots but not to the old reader.
+        committed = 0
+        for s, c in reversed(writers):
+            c.close()
+            s.commit_transaction()
+            committed += 1
+            if committed % 10 == 0:
+                self.assertEqual(self.visible_count(), committed)
+        self.assertEqual(self.visible_count(), len(writers))
+        self.assertEqual(sum(1 for r in rcursor), 0)
+        reader.rollback_transaction()
+
+        # With everything resolved, the oldest ID can move forward and a
+        # checkpoint sees all of the data.
+        self.session.checkpoint()
+        cursor = self.session.open_cursor(
+            self.uri, None, 'checkpoint=WiredTigerCheckpoint')
+        self.assertEqual(sum(1 for r in cursor), len(writers))
+        cursor.close()
+
+        for s, c in writers:
+            s.close()
+        for s in idle:
+            s.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,125 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import threading, wiredtiger, wttest
+from helper import copy_wiredtiger_home
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_txn20.py
+#    Transactions: concurrent commits written to multiple log streams are
+#    recovered in each file's commit order, including transactions spanning
+#    files in different streams, with and without slot join groups.
+class test_txn20(wttest.WiredTigerTestCase):
+    ntables = 6
+    nentries = 500
+    nthreads = 4
+    nrounds = 3
+
+    scenarios = make_scenarios([
+        ('streams-1', dict(streams=1)),
+        ('streams-4', dict(streams=4)),
+    ], [
+        ('groups-0', dict(join_groups=0)),
+        ('groups-4', dict(join_groups=4)),
+    ])
+
+    def conn_config(self):
+        return 'log=(enabled,file_max=100KB,streams=%d,join_groups=%d),' % \
+            (self.streams, self.join_groups) + 'statistics=(all)'
+
+    def uri(self, i):
+        return 'table:test_txn20_%d' % i
+
+    def value(self, i, k, r):
+        return 'value %d.%d.%d' % (i, k, r)
+
+    # Each thread overwrites its own keys in every round, alternating between
+    # transactions on a single file and transactions spanning all of the
+    # files: each key ends up with the last round's value only if the log
+    # has each file's records in commit order.
+    def writer(self, t):
+        session = self.conn.open_session()
+        cursors = [session.open_cursor(self.uri(i), None)
+            for i in range(self.ntables)]
+        for r in range(self.nrounds):
+            for k in range(t, self.nentries, self.nthreads):
+                spanning = (k + r) % 2 == 0
+                if spanning:
+                    session.begin_transaction(
+                        'sync=true' if k % 10 == 1 else None)
+                for i in range(self.ntables):
+                    cursors[i][k] = self.value(i, k, r)
+                if spanning:
+                    session.commit_transaction()
+        session.close()
+
+    def check(self, session):
+        for i in range(self.ntables):
+            cursor = session.open_cursor(self.uri(i), None)
+            for k in range(self.nentries):
+                self.assertEqual(
+                    cursor[k], self.value(i, k, self.nrounds - 1))
+            self.assertEqual(sum(1 for r in cursor), self.nentries)
+            cursor.close()
+
+    def test_log_streams(self):
+        for i in range(self.ntables):
+            self.session.create(self.uri(i), 'key_format=i,value_format=S')
+
+        # Checkpoint while the threads are committing.
+        threads = [threading.Thread(target=self.writer, args=(t,))
+            for t in range(self.nthreads)]
+        for t in threads:
+            t.start()
+        self.session.checkpoint()
+        for t in threads:
+            t.join()
+        self.check(self.session)
+        if self.streams > 1:
+            self.assertGreater(self.get_stat(stat.conn.log_stream_writes), 0)
+
+        # Copy the database without shutting down: recovery applies the
+        # committed transactions from the log.
+        self.session.log_flush('sync=on')
+        copy_wiredtiger_home('.', 'RESTART')
+        conn = self.wiredtiger_open('RESTART', 'log=(enabled)')
+        self.check(conn.open_session())
+        conn.close()
+
+        # Reopen the original with a different number of streams.
+        self.close_conn()
+        conn = self.wiredtiger_open('.', 'log=(enabled,streams=2)')
+        session = conn.open_session()
+        self.check(session)
+        for i in range(self.ntables):
+            session.verify(self.uri(i), None)
+        conn.close()
+
+if __name__ == '__main__':
+    wttest.run()
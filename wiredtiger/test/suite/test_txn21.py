@@ -0,0 +1,101 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from helper import copy_wiredtiger_home
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_txn21.py
+#    Transactions: commits written and synced through an io_uring are
+#    recovered.  Where io_uring isn't available, log I/O is synchronous.
+class test_txn21(wttest.WiredTigerTestCase):
+    nentries = 2000
+    uri = 'table:test_txn21'
+
+    scenarios = make_scenarios([
+        ('streams-1', dict(streams=1)),
+        ('streams-4', dict(streams=4)),
+    ])
+
+    def conn_config(self):
+        return 'log=(enabled,file_max=100KB,io_uring=true,streams=%d),' % \
+            self.streams + 'statistics=(all)'
+
+    def check(self, session):
+        cursor = session.open_cursor(self.uri, None)
+        for k in range(self.nentries):
+            self.assertEqual(cursor[k], 'value %d' % k)
+        self.assertEqual(sum(1 for r in cursor), self.nentries)
+        cursor.close()
+
+    # Commit the records, every fiftieth and the last synchronously.
+    def populate(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri, None)
+        for k in range(self.nentries):
+            if k % 50 == 0 or k == self.nentries - 1:
+                self.session.begin_transaction('sync=true')
+            else:
+                self.session.begin_transaction()
+            cursor[k] = 'value %d' % k
+            self.session.commit_transaction()
+            if k == self.nentries // 2:
+                self.session.checkpoint()
+        cursor.close()
+
+    def test_log_io_uring(self):
+        self.populate()
+        self.check(self.session)
+
+        # Copy the database without shutting down or flushing the log: a
+        # synchronous commit returns once its linked sync completes, so the
+        # copy's recovery applies every committed transaction.
+        copy_wiredtiger_home('.', 'RESTART')
+        conn = self.wiredtiger_open('RESTART', 'log=(enabled)')
+        self.check(conn.open_session())
+        conn.close()
+
+        self.close_conn()
+        conn = self.wiredtiger_open('.', 'log=(enabled,io_uring=true)')
+        session = conn.open_session()
+        self.check(session)
+        session.verify(self.uri, None)
+        conn.close()
+
+    # Log writes go through the io_uring, and synchronous commits link their
+    # sync to their write.
+    def test_log_io_uring_stats(self):
+        if self.get_stat(stat.conn.log_io_uring_enabled) == 0:
+            self.skipTest('io_uring not available')
+        self.populate()
+        self.assertGreater(self.get_stat(stat.conn.log_io_uring_write), 0)
+        self.assertGreater(self.get_stat(stat.conn.log_io_uring_sync), 0)
+
+if __name__ == '__main__':
+    wttest.run()
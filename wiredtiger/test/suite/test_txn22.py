@@ -0,0 +1,123 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import threading, wiredtiger, wttest
+from helper import copy_wiredtiger_home
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_txn22.py
+#    Transactions: concurrent synchronous commits with group commit delays
+#    share log syncs, stay durable, and are counted in the commit latency and
+#    commits per log sync histograms.
+class test_txn22(wttest.WiredTigerTestCase):
+    nthreads = 8
+    nentries = 2000
+    uri = 'table:test_txn22'
+
+    scenarios = make_scenarios([
+        ('delay-0', dict(delay=0)),
+        ('delay-2000', dict(delay=2000)),
+    ])
+
+    def conn_config(self):
+        return 'log=(enabled,group_commit_delay=%d),' % self.delay + \
+            'statistics=(all)'
+
+    # Each thread commits its share of the keys, every commit synchronous.
+    def committer(self, t):
+        session = self.conn.open_session()
+        cursor = session.open_cursor(self.uri, None)
+        for k in range(t, self.nentries, self.nthreads):
+            session.begin_transaction('sync=true')
+            cursor[k] = 'value %d' % k
+            session.commit_transaction()
+        session.close()
+
+    def check(self, session):
+        cursor = session.open_cursor(self.uri, None)
+        for k in range(self.nentries):
+            self.assertEqual(cursor[k], 'value %d' % k)
+        self.assertEqual(sum(1 for r in cursor), self.nentries)
+        cursor.close()
+
+    def test_group_commit(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        syncs = self.get_stat(stat.conn.log_sync)
+        threads = [threading.Thread(target=self.committer, args=(t,))
+            for t in range(self.nthreads)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        syncs = self.get_stat(stat.conn.log_sync) - syncs
+        self.check(self.session)
+
+        # Every synchronous commit is in the latency histogram, log syncs
+        # of synchronous slots in the commits per sync histogram.
+        latency = sum(self.get_stat(s) for s in [
+            stat.conn.log_commit_latency_lt100,
+            stat.conn.log_commit_latency_lt250,
+            stat.conn.log_commit_latency_lt1000,
+            stat.conn.log_commit_latency_lt10000,
+            stat.conn.log_commit_latency_ge10000])
+        self.assertGreaterEqual(latency, self.nentries)
+        per_sync = sum(self.get_stat(s) for s in [
+            stat.conn.log_sync_commits_lt2,
+            stat.conn.log_sync_commits_lt4,
+            stat.conn.log_sync_commits_lt8,
+            stat.conn.log_sync_commits_lt16,
+            stat.conn.log_sync_commits_ge16])
+        self.assertGreater(per_sync, 0)
+        self.assertLessEqual(per_sync, self.get_stat(stat.conn.log_sync))
+
+        # A commit returns once it's durable, delayed or not: recovery of a
+        # copy taken without flushing the log finds every commit.
+        copy_wiredtiger_home('.', 'RESTART')
+        conn = self.wiredtiger_open('RESTART', 'log=(enabled)')
+        self.check(conn.open_session())
+        conn.close()
+
+        delays = self.get_stat(stat.conn.log_group_commit_delay)
+        if self.delay == 0:
+            self.assertEqual(delays, 0)
+            return
+
+        # Commits are only worth delaying if a log sync takes long enough
+        # for other commits to join the slot.
+        if self.get_stat(stat.conn.log_sync_duration) < \
+            10 * self.get_stat(stat.conn.log_sync):
+            self.skipTest('log syncs are too fast to delay commits')
+
+        # The threads wait for each other's syncs, so commits are delayed
+        # and share log syncs.
+        self.assertGreater(delays, 0)
+        self.assertLess(syncs, self.nentries // 2)
+
+if __name__ == '__main__':
+    wttest.run()
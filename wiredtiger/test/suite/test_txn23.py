@@ -0,0 +1,121 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from helper import copy_wiredtiger_home
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_txn23.py
+#    Transactions: recovery with parallel recovery threads applies each
+#    file's operations in log order: overwrites, removes, and truncates
+#    followed by inserts into the truncated range.
+class test_txn23(wttest.WiredTigerTestCase):
+    conn_config = 'log=(enabled),statistics=(all)'
+    nentries = 1000
+    ntables = 5
+    nrounds = 4
+
+    scenarios = make_scenarios([
+        ('threads-1', dict(threads=1)),
+        ('threads-2', dict(threads=2)),
+        ('threads-8', dict(threads=8)),
+    ])
+
+    def uri(self, i):
+        return 'table:test_txn23_%d' % i
+
+    def check(self, session, expect):
+        for i in range(self.ntables):
+            cursor = session.open_cursor(self.uri(i), None)
+            self.assertEqual([(k, v) for k, v in cursor],
+                sorted(expect[i].items()))
+            cursor.close()
+            session.verify(self.uri(i), None)
+
+    def test_recover_threads(self):
+        expect = [dict() for i in range(self.ntables)]
+        cursors = []
+        for i in range(self.ntables):
+            self.session.create(self.uri(i), 'key_format=i,value_format=S')
+            cursor = self.session.open_cursor(self.uri(i), None)
+            for k in range(self.nentries):
+                cursor[k] = expect[i][k] = 'value %d %d' % (i, k)
+            cursors.append(cursor)
+
+        # Operations before the checkpoint are skipped by recovery.
+        self.session.checkpoint()
+
+        # Each round overwrites and removes keys in transactions spanning
+        # the files, truncates a range of keys, and inserts keys into the
+        # range truncated by the previous round.
+        for r in range(self.nrounds):
+            self.session.begin_transaction()
+            for i, cursor in enumerate(cursors):
+                for k in range(r, self.nentries, 3):
+                    cursor[k] = expect[i][k] = 'update %d %d %d' % (i, k, r)
+                for k in range(r * 10, self.nentries, 97):
+                    if k in expect[i]:
+                        cursor.set_key(k)
+                        self.assertEqual(cursor.remove(), 0)
+                        del expect[i][k]
+            self.session.commit_transaction()
+
+            first = 200 + r * 100
+            for i, cursor in enumerate(cursors):
+                start = self.session.open_cursor(self.uri(i), None)
+                start.set_key(first)
+                stop = self.session.open_cursor(self.uri(i), None)
+                stop.set_key(first + 49)
+                self.session.truncate(None, start, stop, None)
+                start.close()
+                stop.close()
+                for k in range(first, first + 50):
+                    expect[i].pop(k, None)
+                if r > 0:
+                    for k in range(first - 100, first - 50, 5):
+                        cursor[k] = expect[i][k] = \
+                            'again %d %d %d' % (i, k, r)
+        for cursor in cursors:
+            cursor.close()
+        self.check(self.session, expect)
+
+        # Copy the database without shutting down, and recover the copy.
+        self.session.log_flush('sync=on')
+        copy_wiredtiger_home('.', 'RESTART')
+        conn = self.wiredtiger_open('RESTART',
+            'log=(enabled,recover_threads=%d),statistics=(all)' % self.threads)
+        session = conn.open_session()
+        self.check(session, expect)
+        if self.threads > 1:
+            self.assertGreater(self.get_stat(
+                stat.conn.txn_recover_parallel_ops, session=session), 0)
+        conn.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,152 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import os, shutil, time
+import wiredtiger, wttest
+from helper import copy_wiredtiger_home, log_file_header
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_txn24.py
+#    Transactions: archived log files are recycled as pre-allocated log files
+#    and recovery ignores the old records they contain.
+class test_txn24(wttest.WiredTigerTestCase):
+    uri = 'table:test_txn24'
+    nentries = 500
+    value = 'abcdefghij' * 20
+
+    scenarios = make_scenarios([
+        ('recycle', dict(recycle='true')),
+        ('remove', dict(recycle='false')),
+    ])
+
+    def conn_config(self):
+        return 'log=(archive=true,enabled,file_max=100K,prealloc=true,' + \
+            'recycle=%s),statistics=(all)' % self.recycle
+
+    def insert(self, session, first):
+        cursor = session.open_cursor(self.uri, None)
+        for k in range(first, first + self.nentries):
+            cursor[k] = self.value + str(k)
+        cursor.close()
+
+    def test_log_recycle(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+
+        # Checkpoints let the log server archive the earlier log files, wait
+        # for it to run.
+        first = 0
+        for i in range(10):
+            self.insert(self.session, first)
+            first += self.nentries
+            self.session.checkpoint()
+            if self.get_stat(stat.conn.log_prealloc_recycled) > 0:
+                break
+            time.sleep(1)
+        recycled = self.get_stat(stat.conn.log_prealloc_recycled)
+        if self.recycle == 'true':
+            self.assertGreater(recycled, 0)
+        else:
+            self.assertEqual(recycled, 0)
+
+        # Remove the first round of keys and write into the recycled log
+        # files.  Their old records insert those keys again: recovering a
+        # copy of the database must only read the records written since the
+        # files were recycled, so the removed keys stay removed.
+        cursor = self.session.open_cursor(self.uri, None)
+        for k in range(self.nentries):
+            cursor.set_key(k)
+            self.assertEqual(cursor.remove(), 0)
+        cursor.close()
+        self.insert(self.session, first)
+        first += self.nentries
+        self.session.log_flush('sync=on')
+        copy_wiredtiger_home('.', 'RESTART')
+
+        # Recycled files are written with salted record checksums, which
+        # needs the newer log file version.
+        version, flags = log_file_header('RESTART')
+        if self.recycle == 'true':
+            self.assertEqual(version, 3)
+            self.assertEqual(flags, 0x01)
+        else:
+            self.assertEqual(version, 2)
+            self.assertEqual(flags, 0)
+
+        conn = self.wiredtiger_open('RESTART', self.conn_config())
+        session = conn.open_session()
+        cursor = session.open_cursor(self.uri, None)
+        k = self.nentries
+        for key, v in cursor:
+            self.assertEqual(key, k)
+            self.assertEqual(v, self.value + str(k))
+            k += 1
+        self.assertEqual(k, first)
+        cursor.close()
+        session.verify(self.uri, None)
+        conn.close()
+
+    # Recycling needs both archiving and pre-allocated log files.
+    def test_log_recycle_config(self):
+        msg = '/requires log=\(archive=true,prealloc=true\)/'
+        for cfg in ['archive=false,prealloc=true',
+            'archive=true,prealloc=false']:
+            os.mkdir('RECYCLE')
+            self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+                lambda: self.wiredtiger_open('RECYCLE',
+                'create,log=(enabled,recycle=true,%s)' % cfg), msg)
+            shutil.rmtree('RECYCLE')
+
+# test_txn24_compat
+#    Log files written with an older release's compatibility setting, or
+#    without recycling, are at a version that release can read.
+class test_txn24_compat(wttest.WiredTigerTestCase):
+    uri = 'table:test_txn24_compat'
+
+    scenarios = make_scenarios([
+        ('default', dict(compat='', version=2)),
+        ('release30', dict(compat='compatibility=(release=3.0),', version=2)),
+        ('release29', dict(compat='compatibility=(release=2.9),', version=1)),
+    ])
+
+    def conn_config(self):
+        return self.compat + 'log=(enabled)'
+
+    def test_log_version(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri, None)
+        for k in range(100):
+            cursor[k] = str(k)
+        cursor.close()
+        self.session.log_flush('sync=on')
+        version, flags = log_file_header('.')
+        self.assertEqual(version, self.version)
+        self.assertEqual(flags, 0)
+
+if __name__ == '__main__':
+    wttest.run()
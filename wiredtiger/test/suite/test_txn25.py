@@ -0,0 +1,120 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2017 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from helper import copy_wiredtiger_home, log_file_header
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_txn25.py
+#    Transactions: log slot buffers compressed as single frames are read by
+#    log cursors and recovery.
+class test_txn25(wttest.WiredTigerTestCase):
+    uri = 'table:test_txn25'
+    nentries = 2000
+    value = 'abcdefghij' * 20
+
+    scenarios = make_scenarios([
+        ('slots', dict(compress_slots='true')),
+        ('records', dict(compress_slots='false')),
+    ])
+
+    def conn_config(self, compress_slots=None):
+        if compress_slots is None:
+            compress_slots = self.compress_slots
+        return 'log=(archive=false,enabled,file_max=1M,compressor=zlib,' + \
+            'compress_slots=%s),statistics=(all)' % compress_slots
+
+    def conn_extensions(self, extlist):
+        extlist.skip_if_missing = True
+        extlist.extension('compressors', 'zlib')
+
+    def test_log_compress_slots(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri, None)
+        for k in range(self.nentries):
+            cursor[k] = self.value + str(k)
+        cursor.close()
+        self.session.log_flush('sync=on')
+
+        # Slot frames replace the per-record compression, and compress the
+        # similar records in a slot much better than one at a time.  Only
+        # files written with frames are written at the newer log version.
+        slots = self.get_stat(stat.conn.log_compress_slots)
+        writes = self.get_stat(stat.conn.log_compress_writes)
+        version, flags = log_file_header('.')
+        if self.compress_slots == 'true':
+            self.assertGreater(slots, 0)
+            self.assertEqual(writes, 0)
+            self.assertLess(self.get_stat(stat.conn.log_compress_len) * 8,
+                self.get_stat(stat.conn.log_compress_mem))
+            self.assertEqual(version, 3)
+            self.assertEqual(flags, 0x02)
+        else:
+            self.assertEqual(slots, 0)
+            self.assertGreaterEqual(writes, self.nentries)
+            self.assertEqual(version, 2)
+            self.assertEqual(flags, 0)
+
+        # Every record is returned by a log cursor, and can be found again
+        # by its LSN.
+        c = self.session.open_cursor('log:', None)
+        lsns = []
+        count = 0
+        while c.next() == 0:
+            lsn = c.get_key()
+            if self.value in str(c.get_value()[5]):
+                count += 1
+            if lsn[2] <= 1:
+                lsns.append(lsn)
+        self.assertEqual(count, self.nentries)
+        for lsn in lsns[::7]:
+            c.set_key(lsn[0], lsn[1], 0)
+            self.assertEqual(c.search(), 0)
+            self.assertEqual(c.get_key()[:2], lsn[:2])
+        c.close()
+
+        # Recover a copy of the database from the log with the setting
+        # switched: how records are read depends on the log file header,
+        # not on the configuration.
+        copy_wiredtiger_home('.', 'RESTART')
+        other = 'false' if self.compress_slots == 'true' else 'true'
+        conn = self.wiredtiger_open('RESTART',
+            self.conn_config(other) + self.extensionsConfig())
+        session = conn.open_session()
+        cursor = session.open_cursor(self.uri, None)
+        count = 0
+        for k, v in cursor:
+            self.assertEqual(v, self.value + str(k))
+            count += 1
+        self.assertEqual(count, self.nentries)
+        cursor.close()
+        conn.close()
+
+if __name__ == '__main__':
+    wttest.run()
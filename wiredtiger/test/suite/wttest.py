@@ -450,6 +450,18 @@ class WiredTigerTestCase(unittest.TestCase):
         self.assertEqual(ret, wiredtiger.WT_NOTFOUND)
         bkp_cursor.close()
 
+    def get_stat(self, stat, uri='', session=None):
+        """
+        Return a statistic's value, from the connection's statistics or,
+        given a URI, from the object's statistics.
+        """
+        if session is None:
+            session = self.session
+        stat_cursor = session.open_cursor('statistics:' + uri, None, None)
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
     @contextmanager
     def expectedStdout(self, expect):
         self.captureout.check(self)